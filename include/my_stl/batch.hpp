@@ -0,0 +1,324 @@
+/*
+    关键特性说明
+    1. pair 批量内核
+        hash:        对 pair<uint32_t, uint32_t> / pair<uint64_t, uint64_t> 数组逐个计算
+                     detail::hash_combine64(first, second)，与整数成员的 pair_hash 结果一致
+                     (std::hash 对整数为恒等映射的标准库上，如 libstdc++ 与 libc++)
+        count_less:  统计字典序小于 key 的元素个数
+        count_equal: 统计等于 key 的元素个数
+
+    2. 运行时分派
+        每个内核在 cpu_dispatch.hpp 的 dispatch_table 中登记 scalar/SSE4.2/AVX2/AVX-512 实现，
+        第一次调用时按 simd::active_isa() 解析函数指针；各等级的结果逐位相同
+
+    3. 比较的向量化
+        小端序下 pair<uint32_t, uint32_t> 的 64 位内存表示为 second:first，
+        交换两个 32 位半字后得到 first:second，字典序即为 64 位无符号整数的大小关系
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "cpu_dispatch.hpp"
+#include "detail/hash.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace my_stl::batch {
+
+using pair_u32 = pair<std::uint32_t, std::uint32_t>;
+using pair_u64 = pair<std::uint64_t, std::uint64_t>;
+
+static_assert(sizeof(pair_u32) == 8 && std::is_standard_layout_v<pair_u32>,
+              "batch kernels assume pair<uint32_t, uint32_t> is two packed 32-bit members");
+static_assert(sizeof(pair_u64) == 16 && std::is_standard_layout_v<pair_u64>,
+              "batch kernels assume pair<uint64_t, uint64_t> is two packed 64-bit members");
+
+namespace detail {
+
+using hash_u32_fn = void (*)(const pair_u32*, std::size_t, std::uint64_t*);
+using hash_u64_fn = void (*)(const pair_u64*, std::size_t, std::uint64_t*);
+using count_u32_fn = std::size_t (*)(const pair_u32*, std::size_t, pair_u32);
+
+// first:second 组成的 64 位键，按无符号比较等价于字典序
+inline std::uint64_t lex_key(const pair_u32& p) noexcept {
+    return (static_cast<std::uint64_t>(p.first) << 32) | p.second;
+}
+
+// 内存中的 64 位表示 (second:first)
+inline std::uint64_t raw_key(const pair_u32& p) noexcept {
+    return (static_cast<std::uint64_t>(p.second) << 32) | p.first;
+}
+
+// ============================================================================
+// scalar
+// ============================================================================
+
+inline void hash_u32_scalar(const pair_u32* in, std::size_t n, std::uint64_t* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = ::my_stl::detail::hash_combine64(in[i].first, in[i].second);
+}
+
+inline void hash_u64_scalar(const pair_u64* in, std::size_t n, std::uint64_t* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = ::my_stl::detail::hash_combine64(in[i].first, in[i].second);
+}
+
+inline std::size_t count_less_u32_scalar(const pair_u32* in, std::size_t n, pair_u32 key) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += in[i] < key;
+    return count;
+}
+
+inline std::size_t count_equal_u32_scalar(const pair_u32* in, std::size_t n, pair_u32 key) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += in[i] == key;
+    return count;
+}
+
+#if MYSTL_X86_DISPATCH
+
+// ============================================================================
+// SSE4.2: 两个元素一组，pcmpgtq 比较 64 位键
+// ============================================================================
+
+MYSTL_TARGET_SSE42 inline std::size_t count_less_u32_sse42(const pair_u32* in, std::size_t n, pair_u32 key) {
+    const __m128i sign = _mm_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+    const __m128i k = _mm_xor_si128(_mm_set1_epi64x(static_cast<long long>(lex_key(key))), sign);
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        v = _mm_xor_si128(_mm_shuffle_epi32(v, 0xb1), sign);
+        __m128i lt = _mm_cmpgt_epi64(k, v);
+        count += static_cast<std::size_t>(_mm_popcnt_u32(static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(lt)))));
+    }
+    return count + count_less_u32_scalar(in + i, n - i, key);
+}
+
+MYSTL_TARGET_SSE42 inline std::size_t count_equal_u32_sse42(const pair_u32* in, std::size_t n, pair_u32 key) {
+    const __m128i k = _mm_set1_epi64x(static_cast<long long>(raw_key(key)));
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i eq = _mm_cmpeq_epi64(v, k);
+        count += static_cast<std::size_t>(_mm_popcnt_u32(static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(eq)))));
+    }
+    return count + count_equal_u32_scalar(in + i, n - i, key);
+}
+
+// ============================================================================
+// AVX2: 四个元素一组；64 位乘法用三次 32 位乘法拼出
+// ============================================================================
+
+MYSTL_TARGET_AVX2 inline __m256i mullo64_avx2(__m256i a, __m256i b) {
+    __m256i lo = _mm256_mul_epu32(a, b);
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                     _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+
+MYSTL_TARGET_AVX2 inline __m256i mix64_avx2(__m256i x) {
+    const __m256i m1 = _mm256_set1_epi64x(static_cast<long long>(0xbf58476d1ce4e5b9ULL));
+    const __m256i m2 = _mm256_set1_epi64x(static_cast<long long>(0x94d049bb133111ebULL));
+    x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 30));
+    x = mullo64_avx2(x, m1);
+    x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 27));
+    x = mullo64_avx2(x, m2);
+    return _mm256_xor_si256(x, _mm256_srli_epi64(x, 31));
+}
+
+MYSTL_TARGET_AVX2 inline __m256i combine64_avx2(__m256i first, __m256i second) {
+    const __m256i golden = _mm256_set1_epi64x(static_cast<long long>(0x9e3779b97f4a7c15ULL));
+    return mix64_avx2(_mm256_xor_si256(first, mix64_avx2(_mm256_add_epi64(second, golden))));
+}
+
+MYSTL_TARGET_AVX2 inline void hash_u32_avx2(const pair_u32* in, std::size_t n, std::uint64_t* out) {
+    const __m256i low = _mm256_set1_epi64x(0xffffffffLL);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i h = combine64_avx2(_mm256_and_si256(v, low), _mm256_srli_epi64(v, 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), h);
+    }
+    hash_u32_scalar(in + i, n - i, out + i);
+}
+
+MYSTL_TARGET_AVX2 inline void hash_u64_avx2(const pair_u64* in, std::size_t n, std::uint64_t* out) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));      // f0 s0 f1 s1
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 2));  // f2 s2 f3 s3
+        // unpack 在 128 位通道内进行，得到 f0 f2 f1 f3，再调整为 f0 f1 f2 f3
+        __m256i first = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xd8);
+        __m256i second = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), 0xd8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), combine64_avx2(first, second));
+    }
+    hash_u64_scalar(in + i, n - i, out + i);
+}
+
+MYSTL_TARGET_AVX2 inline std::size_t count_less_u32_avx2(const pair_u32* in, std::size_t n, pair_u32 key) {
+    const __m256i sign = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+    const __m256i k = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(lex_key(key))), sign);
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        v = _mm256_xor_si256(_mm256_shuffle_epi32(v, 0xb1), sign);
+        __m256i lt = _mm256_cmpgt_epi64(k, v);
+        count += static_cast<std::size_t>(_mm_popcnt_u32(static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(lt)))));
+    }
+    return count + count_less_u32_scalar(in + i, n - i, key);
+}
+
+MYSTL_TARGET_AVX2 inline std::size_t count_equal_u32_avx2(const pair_u32* in, std::size_t n, pair_u32 key) {
+    const __m256i k = _mm256_set1_epi64x(static_cast<long long>(raw_key(key)));
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i eq = _mm256_cmpeq_epi64(v, k);
+        count += static_cast<std::size_t>(_mm_popcnt_u32(static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)))));
+    }
+    return count + count_equal_u32_scalar(in + i, n - i, key);
+}
+
+// ============================================================================
+// AVX-512: 八个元素一组；vpmullq 与无符号比较掩码
+// ============================================================================
+
+MYSTL_TARGET_AVX512 inline __m512i mix64_avx512(__m512i x) {
+    const __m512i m1 = _mm512_set1_epi64(static_cast<long long>(0xbf58476d1ce4e5b9ULL));
+    const __m512i m2 = _mm512_set1_epi64(static_cast<long long>(0x94d049bb133111ebULL));
+    x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 30));
+    x = _mm512_mullo_epi64(x, m1);
+    x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 27));
+    x = _mm512_mullo_epi64(x, m2);
+    return _mm512_xor_si512(x, _mm512_srli_epi64(x, 31));
+}
+
+MYSTL_TARGET_AVX512 inline __m512i combine64_avx512(__m512i first, __m512i second) {
+    const __m512i golden = _mm512_set1_epi64(static_cast<long long>(0x9e3779b97f4a7c15ULL));
+    return mix64_avx512(_mm512_xor_si512(first, mix64_avx512(_mm512_add_epi64(second, golden))));
+}
+
+MYSTL_TARGET_AVX512 inline void hash_u32_avx512(const pair_u32* in, std::size_t n, std::uint64_t* out) {
+    const __m512i low = _mm512_set1_epi64(0xffffffffLL);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i v = _mm512_loadu_si512(in + i);
+        __m512i h = combine64_avx512(_mm512_and_si512(v, low), _mm512_srli_epi64(v, 32));
+        _mm512_storeu_si512(out + i, h);
+    }
+    hash_u32_scalar(in + i, n - i, out + i);
+}
+
+MYSTL_TARGET_AVX512 inline void hash_u64_avx512(const pair_u64* in, std::size_t n, std::uint64_t* out) {
+    const __m512i even = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i odd = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i a = _mm512_loadu_si512(in + i);
+        __m512i b = _mm512_loadu_si512(in + i + 4);
+        __m512i first = _mm512_permutex2var_epi64(a, even, b);
+        __m512i second = _mm512_permutex2var_epi64(a, odd, b);
+        _mm512_storeu_si512(out + i, combine64_avx512(first, second));
+    }
+    hash_u64_scalar(in + i, n - i, out + i);
+}
+
+MYSTL_TARGET_AVX512 inline std::size_t count_less_u32_avx512(const pair_u32* in, std::size_t n, pair_u32 key) {
+    const __m512i k = _mm512_set1_epi64(static_cast<long long>(lex_key(key)));
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i v = _mm512_shuffle_epi32(_mm512_loadu_si512(in + i), _MM_PERM_CDAB);
+        count += static_cast<std::size_t>(_mm_popcnt_u32(_mm512_cmplt_epu64_mask(v, k)));
+    }
+    return count + count_less_u32_scalar(in + i, n - i, key);
+}
+
+MYSTL_TARGET_AVX512 inline std::size_t count_equal_u32_avx512(const pair_u32* in, std::size_t n, pair_u32 key) {
+    const __m512i k = _mm512_set1_epi64(static_cast<long long>(raw_key(key)));
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i v = _mm512_loadu_si512(in + i);
+        count += static_cast<std::size_t>(_mm_popcnt_u32(_mm512_cmpeq_epu64_mask(v, k)));
+    }
+    return count + count_equal_u32_scalar(in + i, n - i, key);
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+// ============================================================================
+// 分派表
+// ============================================================================
+
+inline const simd::dispatch_table<hash_u32_fn>& hash_u32_table() {
+    static const simd::dispatch_table<hash_u32_fn> table =
+        MYSTL_DISPATCH_TABLE(hash_u32_scalar, nullptr, hash_u32_avx2, hash_u32_avx512);
+    return table;
+}
+
+inline const simd::dispatch_table<hash_u64_fn>& hash_u64_table() {
+    static const simd::dispatch_table<hash_u64_fn> table =
+        MYSTL_DISPATCH_TABLE(hash_u64_scalar, nullptr, hash_u64_avx2, hash_u64_avx512);
+    return table;
+}
+
+inline const simd::dispatch_table<count_u32_fn>& count_less_u32_table() {
+    static const simd::dispatch_table<count_u32_fn> table =
+        MYSTL_DISPATCH_TABLE(count_less_u32_scalar, count_less_u32_sse42, count_less_u32_avx2, count_less_u32_avx512);
+    return table;
+}
+
+inline const simd::dispatch_table<count_u32_fn>& count_equal_u32_table() {
+    static const simd::dispatch_table<count_u32_fn> table =
+        MYSTL_DISPATCH_TABLE(count_equal_u32_scalar, count_equal_u32_sse42, count_equal_u32_avx2, count_equal_u32_avx512);
+    return table;
+}
+
+} // namespace detail
+
+// ============================================================================
+// 公共接口
+// ============================================================================
+
+inline void hash(const pair_u32* in, std::size_t n, std::uint64_t* out) {
+    static const auto fn = detail::hash_u32_table().resolve();
+    fn(in, n, out);
+}
+
+inline void hash(const pair_u64* in, std::size_t n, std::uint64_t* out) {
+    static const auto fn = detail::hash_u64_table().resolve();
+    fn(in, n, out);
+}
+
+inline std::size_t count_less(const pair_u32* in, std::size_t n, const pair_u32& key) {
+    static const auto fn = detail::count_less_u32_table().resolve();
+    return fn(in, n, key);
+}
+
+inline std::size_t count_equal(const pair_u32* in, std::size_t n, const pair_u32& key) {
+    static const auto fn = detail::count_equal_u32_table().resolve();
+    return fn(in, n, key);
+}
+
+// 每个内核实际选中的实现，例如 "hash_u32=avx512 hash_u64=avx512 ..."
+inline std::string describe_kernels() {
+    const auto level = simd::active_isa();
+    std::string s;
+    s += "hash_u32=";
+    s += simd::isa_name(detail::hash_u32_table().resolved_level(level));
+    s += " hash_u64=";
+    s += simd::isa_name(detail::hash_u64_table().resolved_level(level));
+    s += " count_less_u32=";
+    s += simd::isa_name(detail::count_less_u32_table().resolved_level(level));
+    s += " count_equal_u32=";
+    s += simd::isa_name(detail::count_equal_u32_table().resolved_level(level));
+    return s;
+}
+
+} // namespace my_stl::batch
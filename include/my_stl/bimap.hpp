@@ -0,0 +1,168 @@
+/*
+    关键特性说明
+    1. 每个关联只存一次
+        bimap<L, R> 把一对一关联 pair<L, R> 连续存放在一个数组中，两个方向各有一张
+        开放寻址表，表项只是 32 位的条目下标 (空位为 0xFFFFFFFF)，键不重复存储；
+        插入不单独分配节点，表按装载率 1/2 成倍扩容
+
+    2. 查找
+        right_of(l) / left_of(r) 返回对应另一侧的指针 (不存在时为 nullptr)，
+        探测时比较条目数组中的键，不需要额外的哈希或标签存储
+
+    3. 删除
+        erase_left / erase_right 把最后一个条目移到空出的位置，只需改写两张表中指向它的表项；
+        表中的空位由后面同一探测链上的表项前移填补，没有墓碑，
+        因此删除后条目顺序会改变，迭代器与指针失效
+
+    4. 插入语义
+        insert(l, r) 在任一侧已存在时不插入并返回 false；
+        insert_or_assign(l, r) 先删除与 l 或 r 关联的条目 (最多两个) 再插入
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "detail/hash.hpp"
+#include "detail/slot_table.hpp"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace my_stl {
+
+template <typename L, typename R, typename LeftHash = std::hash<L>, typename RightHash = std::hash<R>,
+          typename LeftEqual = std::equal_to<L>, typename RightEqual = std::equal_to<R>>
+class bimap {
+public:
+    using left_type = L;
+    using right_type = R;
+    using value_type = pair<L, R>;
+    using size_type = std::size_t;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    bimap() { rebuild(8); }
+
+    explicit bimap(size_type expected) : bimap() { reserve(expected); }
+
+    // 按哈希表装载率不超过 1/2 预留空间
+    void reserve(size_type n) {
+        assert(n < detail::slot_nil);
+        entries_.reserve(n);
+        std::size_t buckets = left_.buckets();
+        while (buckets < n * 2) buckets <<= 1;
+        if (buckets != left_.buckets()) rebuild(buckets);
+    }
+
+    bool insert(const L& l, const R& r) {
+        if (contains_left(l) || contains_right(r)) return false;
+        append(value_type(l, r));
+        return true;
+    }
+
+    bool insert(const value_type& v) { return insert(v.first, v.second); }
+
+    // 返回是否删除了旧的关联
+    bool insert_or_assign(const L& l, const R& r) {
+        // 先拷贝，l 或 r 可能引用即将被删除的条目
+        value_type v(l, r);
+        bool replaced = erase_left(v.first);
+        replaced = erase_right(v.second) || replaced;
+        append(std::move(v));
+        return replaced;
+    }
+
+    const R* right_of(const L& l) const {
+        std::uint32_t s = find_left(l);
+        return s == detail::slot_nil ? nullptr : &entries_[s].second;
+    }
+
+    const L* left_of(const R& r) const {
+        std::uint32_t s = find_right(r);
+        return s == detail::slot_nil ? nullptr : &entries_[s].first;
+    }
+
+    bool contains_left(const L& l) const { return find_left(l) != detail::slot_nil; }
+    bool contains_right(const R& r) const { return find_right(r) != detail::slot_nil; }
+
+    bool erase_left(const L& l) {
+        std::uint32_t s = find_left(l);
+        if (s == detail::slot_nil) return false;
+        erase_at(s);
+        return true;
+    }
+
+    bool erase_right(const R& r) {
+        std::uint32_t s = find_right(r);
+        if (s == detail::slot_nil) return false;
+        erase_at(s);
+        return true;
+    }
+
+    void clear() {
+        entries_.clear();
+        rebuild(left_.buckets());
+    }
+
+    const_iterator begin() const noexcept { return entries_.begin(); }
+    const_iterator end() const noexcept { return entries_.end(); }
+
+    size_type size() const noexcept { return entries_.size(); }
+    bool empty() const noexcept { return entries_.empty(); }
+
+    // 条目数组与两张表占用的字节数 (不含条目内部的堆内存)
+    size_type memory_usage() const noexcept {
+        return entries_.capacity() * sizeof(value_type) + left_.memory_usage() + right_.memory_usage();
+    }
+
+private:
+    static std::uint64_t left_hash(const L& l) { return detail::hash_mix64(static_cast<std::uint64_t>(LeftHash{}(l))); }
+    static std::uint64_t right_hash(const R& r) { return detail::hash_mix64(static_cast<std::uint64_t>(RightHash{}(r))); }
+
+    std::uint32_t find_left(const L& l) const {
+        return left_.find(left_hash(l), [&](std::uint32_t s) { return LeftEqual{}(entries_[s].first, l); });
+    }
+
+    std::uint32_t find_right(const R& r) const {
+        return right_.find(right_hash(r), [&](std::uint32_t s) { return RightEqual{}(entries_[s].second, r); });
+    }
+
+    void append(value_type&& v) {
+        assert(entries_.size() + 1 < detail::slot_nil);
+        if ((entries_.size() + 1) * 2 > left_.buckets()) rebuild(left_.buckets() * 2);
+        entries_.push_back(std::move(v));
+        auto s = static_cast<std::uint32_t>(entries_.size() - 1);
+        left_.insert(left_hash(entries_[s].first), s);
+        right_.insert(right_hash(entries_[s].second), s);
+    }
+
+    // 从两张表删除条目 s，再把最后一个条目移到 s
+    void erase_at(std::uint32_t s) {
+        left_.erase(left_hash(entries_[s].first), s, [&](std::uint32_t t) { return left_hash(entries_[t].first); });
+        right_.erase(right_hash(entries_[s].second), s, [&](std::uint32_t t) { return right_hash(entries_[t].second); });
+        auto last = static_cast<std::uint32_t>(entries_.size() - 1);
+        if (s != last) {
+            left_.relabel(left_hash(entries_[last].first), last, s);
+            right_.relabel(right_hash(entries_[last].second), last, s);
+            entries_[s] = std::move(entries_[last]);
+        }
+        entries_.pop_back();
+    }
+
+    void rebuild(std::size_t buckets) {
+        left_.reset(buckets);
+        right_.reset(buckets);
+        for (std::size_t i = 0; i < entries_.size(); ++i) {
+            left_.insert(left_hash(entries_[i].first), static_cast<std::uint32_t>(i));
+            right_.insert(right_hash(entries_[i].second), static_cast<std::uint32_t>(i));
+        }
+    }
+
+    std::vector<value_type> entries_;
+    detail::slot_table left_;
+    detail::slot_table right_;
+};
+
+} // namespace my_stl
@@ -0,0 +1,518 @@
+/*
+    关键特性说明
+    1. 连续存储的有界缓存
+        条目 pair<const K, V> 放在构造时一次分配的槽位数组中，之后插入和淘汰都不再分配内存，
+        条目的地址在被淘汰或删除之前保持不变；
+        键索引是 32 位槽位下标的开放寻址表 (线性探测，装载率不超过 1/2，删除时后移填补，没有墓碑)，
+        每个索引项带 32 位哈希标签，大多数不匹配的探测不需要访问条目
+
+    2. lru_cache
+        最近最少使用淘汰，侵入式双向链表的 prev/next 是 32 位下标，与条目分开存放；
+        get 命中时把条目移到最近使用端，peek 不改变顺序；所有操作 O(1)
+
+    3. clock_cache
+        CLOCK (second chance) 淘汰：get 命中只设置条目的访问位，指针扫过时清除访问位，
+        淘汰第一个访问位为 0 的条目；命中路径不修改任何共享结构，
+        因此分片并发模式下 get 只需要读锁
+
+    4. sharded_cache
+        按混合哈希的高位把键分配到若干个独立缓存，每个分片一把读写锁，分片按缓存行对齐；
+        get 返回值的拷贝 (std::optional)，LRU 分片的 get 取写锁，CLOCK 分片取读锁；
+        concurrent_lru_cache / concurrent_clock_cache 为对应的别名
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "concurrent.hpp"
+#include "detail/hash.hpp"
+#include "detail/slot_table.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace my_stl {
+
+namespace detail {
+
+inline constexpr std::uint32_t cache_nil = 0xFFFFFFFFu;
+
+// ==================== 槽位数组 + 开放寻址索引 ====================
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+class cache_storage {
+public:
+    using value_type = pair<const K, V>;
+
+    explicit cache_storage(std::size_t capacity)
+        : slots_(new slot[capacity]), hashes_(capacity) {
+        assert(capacity > 0 && capacity < cache_nil);
+        std::size_t n = 8;
+        while (n < capacity * 2) n <<= 1;
+        index_.assign(n, entry{0, cache_nil});
+        mask_ = n - 1;
+    }
+
+    cache_storage(const cache_storage&) = delete;
+    cache_storage& operator=(const cache_storage&) = delete;
+
+    ~cache_storage() { clear(); }
+
+    static std::uint64_t hash_of(const K& key) {
+        return hash_mix64(static_cast<std::uint64_t>(Hash{}(key)));
+    }
+
+    value_type& at(std::uint32_t slot) noexcept {
+        return *std::launder(reinterpret_cast<value_type*>(slots_[slot].bytes));
+    }
+
+    const value_type& at(std::uint32_t slot) const noexcept {
+        return *std::launder(reinterpret_cast<const value_type*>(slots_[slot].bytes));
+    }
+
+    std::uint32_t find(const K& key, std::uint64_t h) const {
+        const auto tag = static_cast<std::uint32_t>(h >> 32);
+        for (std::size_t i = h & mask_;; i = (i + 1) & mask_) {
+            const entry& e = index_[i];
+            if (e.slot == cache_nil) return cache_nil;
+            if (e.tag == tag && KeyEqual{}(at(e.slot).first, key)) return e.slot;
+        }
+    }
+
+    // 在空槽位上构造条目并加入索引，构造抛出异常时索引不变
+    template <typename... Args>
+    void construct(std::uint32_t slot, std::uint64_t h, Args&&... args) {
+        ::new (static_cast<void*>(slots_[slot].bytes)) value_type(std::forward<Args>(args)...);
+        hashes_[slot] = h;
+        std::size_t i = h & mask_;
+        while (index_[i].slot != cache_nil) i = (i + 1) & mask_;
+        index_[i] = entry{static_cast<std::uint32_t>(h >> 32), slot};
+    }
+
+    // 从索引中删除并析构条目，后面同一探测链上的索引项前移填补空位
+    void destroy(std::uint32_t slot) {
+        std::size_t i = hashes_[slot] & mask_;
+        while (index_[i].slot != slot) i = (i + 1) & mask_;
+        i = backshift(index_.data(), mask_, i, [](const entry& e) { return e.slot == cache_nil; },
+                      [this](const entry& e) { return hashes_[e.slot]; });
+        index_[i].slot = cache_nil;
+        at(slot).~value_type();
+    }
+
+    void clear() noexcept {
+        for (auto& e : index_) {
+            if (e.slot != cache_nil) {
+                at(e.slot).~value_type();
+                e.slot = cache_nil;
+            }
+        }
+    }
+
+private:
+    struct slot {
+        alignas(value_type) unsigned char bytes[sizeof(value_type)];
+    };
+
+    struct entry {
+        std::uint32_t tag;
+        std::uint32_t slot;
+    };
+
+    std::unique_ptr<slot[]> slots_;
+    std::vector<std::uint64_t> hashes_;
+    std::vector<entry> index_;
+    std::size_t mask_ = 0;
+};
+
+} // namespace detail
+
+// ============================================================================
+// lru_cache: 最近最少使用淘汰
+// ============================================================================
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class lru_cache {
+    using storage_type = detail::cache_storage<K, V, Hash, KeyEqual>;
+    static constexpr std::uint32_t nil = detail::cache_nil;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = pair<const K, V>;
+    using hasher = Hash;
+
+    // 命中会修改链表，并发时 get 需要独占
+    static constexpr bool shared_lookup = false;
+
+    explicit lru_cache(std::size_t capacity)
+        : storage_(capacity), prev_(capacity), next_(capacity), capacity_(capacity) {}
+
+    lru_cache(const lru_cache&) = delete;
+    lru_cache& operator=(const lru_cache&) = delete;
+
+    // 命中时移到最近使用端
+    V* get(const K& key) {
+        std::uint32_t s = storage_.find(key, storage_type::hash_of(key));
+        if (s == nil) return nullptr;
+        move_to_front(s);
+        return &storage_.at(s).second;
+    }
+
+    const V* peek(const K& key) const {
+        std::uint32_t s = storage_.find(key, storage_type::hash_of(key));
+        return s == nil ? nullptr : &storage_.at(s).second;
+    }
+
+    bool contains(const K& key) const { return peek(key) != nullptr; }
+
+    // 插入或覆盖并移到最近使用端，已满时淘汰最久未使用的条目；返回是否插入了新键
+    template <typename M>
+    bool put(const K& key, M&& value) {
+        const std::uint64_t h = storage_type::hash_of(key);
+        std::uint32_t s = storage_.find(key, h);
+        if (s != nil) {
+            storage_.at(s).second = std::forward<M>(value);
+            move_to_front(s);
+            return false;
+        }
+        s = acquire_slot();
+        try {
+            storage_.construct(s, h, key, std::forward<M>(value));
+        } catch (...) {
+            release_slot(s);
+            throw;
+        }
+        link_front(s);
+        ++size_;
+        return true;
+    }
+
+    bool erase(const K& key) {
+        std::uint32_t s = storage_.find(key, storage_type::hash_of(key));
+        if (s == nil) return false;
+        unlink(s);
+        storage_.destroy(s);
+        release_slot(s);
+        --size_;
+        return true;
+    }
+
+    void clear() noexcept {
+        storage_.clear();
+        head_ = tail_ = free_ = nil;
+        used_ = 0;
+        size_ = 0;
+    }
+
+    // 从最近使用到最久未使用遍历
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (std::uint32_t s = head_; s != nil; s = next_[s]) fn(storage_.at(s));
+    }
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+    std::size_t evictions() const noexcept { return evictions_; }
+
+private:
+    // 依次取空闲链表、从未使用过的槽位，最后淘汰链表尾
+    std::uint32_t acquire_slot() {
+        if (free_ != nil) {
+            std::uint32_t s = free_;
+            free_ = next_[s];
+            return s;
+        }
+        if (used_ < capacity_) return static_cast<std::uint32_t>(used_++);
+        std::uint32_t s = tail_;
+        unlink(s);
+        storage_.destroy(s);
+        --size_;
+        ++evictions_;
+        return s;
+    }
+
+    void release_slot(std::uint32_t s) noexcept {
+        next_[s] = free_;
+        free_ = s;
+    }
+
+    void link_front(std::uint32_t s) noexcept {
+        prev_[s] = nil;
+        next_[s] = head_;
+        if (head_ != nil) prev_[head_] = s;
+        else tail_ = s;
+        head_ = s;
+    }
+
+    void unlink(std::uint32_t s) noexcept {
+        if (prev_[s] != nil) next_[prev_[s]] = next_[s];
+        else head_ = next_[s];
+        if (next_[s] != nil) prev_[next_[s]] = prev_[s];
+        else tail_ = prev_[s];
+    }
+
+    void move_to_front(std::uint32_t s) noexcept {
+        if (s == head_) return;
+        unlink(s);
+        link_front(s);
+    }
+
+    storage_type storage_;
+    std::vector<std::uint32_t> prev_;
+    std::vector<std::uint32_t> next_;
+    std::size_t capacity_;
+    std::size_t used_ = 0;
+    std::size_t size_ = 0;
+    std::size_t evictions_ = 0;
+    std::uint32_t head_ = nil;
+    std::uint32_t tail_ = nil;
+    std::uint32_t free_ = nil;
+};
+
+// ============================================================================
+// clock_cache: CLOCK (second chance) 淘汰
+// ============================================================================
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class clock_cache {
+    using storage_type = detail::cache_storage<K, V, Hash, KeyEqual>;
+    static constexpr std::uint32_t nil = detail::cache_nil;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = pair<const K, V>;
+    using hasher = Hash;
+
+    // 命中只写访问位 (relaxed 原子)，多个读者可以同时 get
+    static constexpr bool shared_lookup = true;
+
+    explicit clock_cache(std::size_t capacity)
+        : storage_(capacity), referenced_(new std::atomic<std::uint8_t>[capacity]()), live_(capacity, 0),
+          capacity_(capacity) {}
+
+    clock_cache(const clock_cache&) = delete;
+    clock_cache& operator=(const clock_cache&) = delete;
+
+    V* get(const K& key) {
+        std::uint32_t s = storage_.find(key, storage_type::hash_of(key));
+        if (s == nil) return nullptr;
+        touch(s);
+        return &storage_.at(s).second;
+    }
+
+    const V* peek(const K& key) const {
+        std::uint32_t s = storage_.find(key, storage_type::hash_of(key));
+        return s == nil ? nullptr : &storage_.at(s).second;
+    }
+
+    bool contains(const K& key) const { return peek(key) != nullptr; }
+
+    // 插入或覆盖，已满时由指针选出淘汰的条目；新条目的访问位为 0，返回是否插入了新键
+    template <typename M>
+    bool put(const K& key, M&& value) {
+        const std::uint64_t h = storage_type::hash_of(key);
+        std::uint32_t s = storage_.find(key, h);
+        if (s != nil) {
+            storage_.at(s).second = std::forward<M>(value);
+            touch(s);
+            return false;
+        }
+        s = acquire_slot();
+        try {
+            storage_.construct(s, h, key, std::forward<M>(value));
+        } catch (...) {
+            free_.push_back(s);
+            throw;
+        }
+        live_[s] = 1;
+        referenced_[s].store(0, std::memory_order_relaxed);
+        ++size_;
+        return true;
+    }
+
+    bool erase(const K& key) {
+        std::uint32_t s = storage_.find(key, storage_type::hash_of(key));
+        if (s == nil) return false;
+        storage_.destroy(s);
+        live_[s] = 0;
+        free_.push_back(s);
+        --size_;
+        return true;
+    }
+
+    void clear() noexcept {
+        storage_.clear();
+        std::fill(live_.begin(), live_.end(), std::uint8_t(0));
+        free_.clear();
+        used_ = 0;
+        size_ = 0;
+        hand_ = 0;
+    }
+
+    // 按槽位顺序遍历
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (std::size_t s = 0; s < used_; ++s) {
+            if (live_[s]) fn(storage_.at(static_cast<std::uint32_t>(s)));
+        }
+    }
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+    std::size_t evictions() const noexcept { return evictions_; }
+
+private:
+    // 已经置位时不再写，避免热点条目的缓存行在读者之间来回失效
+    void touch(std::uint32_t s) noexcept {
+        if (referenced_[s].load(std::memory_order_relaxed) == 0) referenced_[s].store(1, std::memory_order_relaxed);
+    }
+
+    std::uint32_t acquire_slot() {
+        if (!free_.empty()) {
+            std::uint32_t s = free_.back();
+            free_.pop_back();
+            return s;
+        }
+        if (used_ < capacity_) return static_cast<std::uint32_t>(used_++);
+        // 已满时所有槽位都有条目，最多扫两圈
+        for (;;) {
+            auto s = static_cast<std::uint32_t>(hand_);
+            hand_ = hand_ + 1 == capacity_ ? 0 : hand_ + 1;
+            if (referenced_[s].load(std::memory_order_relaxed) != 0) {
+                referenced_[s].store(0, std::memory_order_relaxed);
+                continue;
+            }
+            storage_.destroy(s);
+            live_[s] = 0;
+            --size_;
+            ++evictions_;
+            return s;
+        }
+    }
+
+    storage_type storage_;
+    std::unique_ptr<std::atomic<std::uint8_t>[]> referenced_;
+    std::vector<std::uint8_t> live_;
+    std::vector<std::uint32_t> free_;
+    std::size_t capacity_;
+    std::size_t used_ = 0;
+    std::size_t size_ = 0;
+    std::size_t evictions_ = 0;
+    std::size_t hand_ = 0;
+};
+
+// ============================================================================
+// sharded_cache: 分片加锁的并发缓存
+// ============================================================================
+
+template <typename Cache>
+class sharded_cache {
+public:
+    using key_type = typename Cache::key_type;
+    using mapped_type = typename Cache::mapped_type;
+    using hasher = typename Cache::hasher;
+
+    // 总容量均分到各分片 (向上取整)，分片数取不小于 shard_count 的 2 的幂
+    explicit sharded_cache(std::size_t capacity, std::size_t shard_count = 16) {
+        std::size_t n = 1;
+        while (n < shard_count) n <<= 1;
+        const std::size_t per_shard = std::max<std::size_t>(1, (capacity + n - 1) / n);
+        shards_.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) shards_.push_back(std::make_unique<shard>(per_shard));
+        shard_mask_ = n - 1;
+    }
+
+    std::optional<mapped_type> get(const key_type& key) {
+        auto& s = shard_for(key);
+        if constexpr (Cache::shared_lookup) {
+            std::shared_lock<std::shared_mutex> lock(s.mutex);
+            return copy_of(s.cache.get(key));
+        } else {
+            std::unique_lock<std::shared_mutex> lock(s.mutex);
+            return copy_of(s.cache.get(key));
+        }
+    }
+
+    template <typename M>
+    bool put(const key_type& key, M&& value) {
+        auto& s = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(s.mutex);
+        return s.cache.put(key, std::forward<M>(value));
+    }
+
+    bool erase(const key_type& key) {
+        auto& s = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(s.mutex);
+        return s.cache.erase(key);
+    }
+
+    bool contains(const key_type& key) const {
+        const auto& s = shard_for(key);
+        std::shared_lock<std::shared_mutex> lock(s.mutex);
+        return s.cache.contains(key);
+    }
+
+    void clear() {
+        for (auto& s : shards_) {
+            std::unique_lock<std::shared_mutex> lock(s->mutex);
+            s->cache.clear();
+        }
+    }
+
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (const auto& s : shards_) {
+            std::shared_lock<std::shared_mutex> lock(s->mutex);
+            total += s->cache.size();
+        }
+        return total;
+    }
+
+    std::size_t capacity() const noexcept { return shards_.size() * shards_[0]->cache.capacity(); }
+    std::size_t shard_count() const noexcept { return shard_mask_ + 1; }
+
+private:
+    struct alignas(detail::cache_line_size) shard {
+        explicit shard(std::size_t capacity) : cache(capacity) {}
+
+        mutable std::shared_mutex mutex;
+        Cache cache;
+    };
+
+    static std::optional<mapped_type> copy_of(const mapped_type* v) {
+        return v ? std::optional<mapped_type>(*v) : std::nullopt;
+    }
+
+    // 索引的起始位置用混合哈希的低位、标签用高 32 位，分片取第 40 位以上
+    std::size_t shard_index(const key_type& key) const {
+        auto h = detail::hash_mix64(static_cast<std::uint64_t>(hasher{}(key)));
+        return static_cast<std::size_t>(h >> 40) & shard_mask_;
+    }
+
+    shard& shard_for(const key_type& key) { return *shards_[shard_index(key)]; }
+    const shard& shard_for(const key_type& key) const { return *shards_[shard_index(key)]; }
+
+    std::vector<std::unique_ptr<shard>> shards_;
+    std::size_t shard_mask_ = 0;
+};
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+using concurrent_lru_cache = sharded_cache<lru_cache<K, V, Hash, KeyEqual>>;
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+using concurrent_clock_cache = sharded_cache<clock_cache<K, V, Hash, KeyEqual>>;
+
+} // namespace my_stl
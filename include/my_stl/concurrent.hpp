@@ -0,0 +1,422 @@
+/*
+    关键特性说明
+    1. atomic_pair
+        两个成员合计不超过 8 字节时打包进 std::atomic<uint64_t>
+        提供无锁的 load/store/exchange/compare_exchange
+
+    2. seqlock_pair
+        任意平凡可拷贝成员的顺序锁 pair，读者无锁且不写共享缓存行
+        数据按 64 位字以 relaxed 原子操作读写，避免数据竞争的未定义行为
+        写者之间通过 CAS 抢占奇数序号互斥
+
+    3. sharded_map
+        按哈希高位分片的并发哈希表，每个分片一把读写锁，分片按缓存行对齐
+        默认使用 std::hash，my_stl::pair 键自动使用改进后的组合哈希
+
+    4. mpmc_queue
+        有界多生产者多消费者环形队列 (Vyukov)，每个槽位带序号，无需全局锁
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "detail/hash.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define MYSTL_CPU_RELAX() _mm_pause()
+#elif defined(__aarch64__)
+#define MYSTL_CPU_RELAX() asm volatile("yield" ::: "memory")
+#else
+#define MYSTL_CPU_RELAX() ((void)0)
+#endif
+
+namespace my_stl {
+
+namespace detail {
+
+// 避免伪共享的缓存行大小
+inline constexpr std::size_t cache_line_size = 64;
+
+} // namespace detail
+
+// ============================================================================
+// atomic_pair: 打包到单个 64 位原子变量
+// ============================================================================
+
+template <typename T1, typename T2>
+class atomic_pair {
+    static_assert(std::is_trivially_copyable_v<T1> && std::is_trivially_copyable_v<T2>,
+                  "atomic_pair requires trivially copyable members");
+    static_assert(sizeof(T1) + sizeof(T2) <= sizeof(std::uint64_t),
+                  "atomic_pair members must fit in 64 bits; use seqlock_pair for larger members");
+
+public:
+    using value_type = pair<T1, T2>;
+
+    atomic_pair() noexcept : word_(0) {}
+    explicit atomic_pair(const value_type& v) noexcept : word_(pack(v)) {}
+
+    atomic_pair(const atomic_pair&) = delete;
+    atomic_pair& operator=(const atomic_pair&) = delete;
+
+    static constexpr bool is_always_lock_free = std::atomic<std::uint64_t>::is_always_lock_free;
+
+    value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+        return unpack(word_.load(order));
+    }
+
+    void store(const value_type& v, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        word_.store(pack(v), order);
+    }
+
+    value_type exchange(const value_type& v, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        return unpack(word_.exchange(pack(v), order));
+    }
+
+    // 按成员的对象表示比较
+    bool compare_exchange_strong(value_type& expected, const value_type& desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept {
+        std::uint64_t old_word = pack(expected);
+        bool ok = word_.compare_exchange_strong(old_word, pack(desired), order);
+        if (!ok) expected = unpack(old_word);
+        return ok;
+    }
+
+    bool compare_exchange_weak(value_type& expected, const value_type& desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept {
+        std::uint64_t old_word = pack(expected);
+        bool ok = word_.compare_exchange_weak(old_word, pack(desired), order);
+        if (!ok) expected = unpack(old_word);
+        return ok;
+    }
+
+private:
+    static std::uint64_t pack(const value_type& v) noexcept {
+        std::uint64_t word = 0;
+        std::memcpy(reinterpret_cast<unsigned char*>(&word), &v.first, sizeof(T1));
+        std::memcpy(reinterpret_cast<unsigned char*>(&word) + sizeof(T1), &v.second, sizeof(T2));
+        return word;
+    }
+
+    static value_type unpack(std::uint64_t word) noexcept {
+        T1 a;
+        T2 b;
+        std::memcpy(&a, reinterpret_cast<const unsigned char*>(&word), sizeof(T1));
+        std::memcpy(&b, reinterpret_cast<const unsigned char*>(&word) + sizeof(T1), sizeof(T2));
+        return value_type(a, b);
+    }
+
+    std::atomic<std::uint64_t> word_;
+};
+
+// ============================================================================
+// seqlock_pair: 顺序锁保护的 pair
+// ============================================================================
+
+template <typename T1, typename T2>
+class seqlock_pair {
+    static_assert(std::is_trivially_copyable_v<T1> && std::is_trivially_copyable_v<T2>,
+                  "seqlock_pair requires trivially copyable members");
+
+    static constexpr std::size_t payload_bytes = sizeof(T1) + sizeof(T2);
+    static constexpr std::size_t word_count = (payload_bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+public:
+    using value_type = pair<T1, T2>;
+
+    seqlock_pair() noexcept : seq_(0) {
+        for (auto& w : words_) w.store(0, std::memory_order_relaxed);
+    }
+
+    explicit seqlock_pair(const value_type& v) noexcept : seqlock_pair() {
+        write_words(v);
+    }
+
+    seqlock_pair(const seqlock_pair&) = delete;
+    seqlock_pair& operator=(const seqlock_pair&) = delete;
+
+    value_type load() const noexcept {
+        std::uint64_t buffer[word_count];
+        for (;;) {
+            std::uint64_t before = seq_.load(std::memory_order_acquire);
+            if (MYSTL_UNLIKELY(before & 1)) {
+                MYSTL_CPU_RELAX();
+                continue;
+            }
+            for (std::size_t i = 0; i < word_count; ++i) {
+                buffer[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (MYSTL_LIKELY(seq_.load(std::memory_order_relaxed) == before)) break;
+        }
+        return unpack(buffer);
+    }
+
+    void store(const value_type& v) noexcept {
+        std::uint64_t s = lock();
+        write_words(v);
+        seq_.store(s + 2, std::memory_order_release);
+    }
+
+    // 在写锁内基于当前值计算新值
+    template <typename Fn>
+    value_type update(Fn&& fn) {
+        std::uint64_t s = lock();
+        std::uint64_t buffer[word_count];
+        for (std::size_t i = 0; i < word_count; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        value_type next = std::forward<Fn>(fn)(unpack(buffer));
+        write_words(next);
+        seq_.store(s + 2, std::memory_order_release);
+        return next;
+    }
+
+    // 当前序号（偶数表示没有写者），可用于观察写入次数
+    std::uint64_t sequence() const noexcept {
+        return seq_.load(std::memory_order_acquire);
+    }
+
+private:
+    // 写者把序号从偶数改成奇数以获得独占权
+    std::uint64_t lock() noexcept {
+        std::uint64_t s = seq_.load(std::memory_order_relaxed);
+        for (;;) {
+            if (!(s & 1) && seq_.compare_exchange_weak(s, s + 1, std::memory_order_acquire,
+                                                       std::memory_order_relaxed)) {
+                break;
+            }
+            MYSTL_CPU_RELAX();
+            s = seq_.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        return s;
+    }
+
+    void write_words(const value_type& v) noexcept {
+        std::uint64_t buffer[word_count] = {};
+        std::memcpy(reinterpret_cast<unsigned char*>(buffer), &v.first, sizeof(T1));
+        std::memcpy(reinterpret_cast<unsigned char*>(buffer) + sizeof(T1), &v.second, sizeof(T2));
+        for (std::size_t i = 0; i < word_count; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+
+    static value_type unpack(const std::uint64_t* buffer) noexcept {
+        T1 a;
+        T2 b;
+        std::memcpy(&a, reinterpret_cast<const unsigned char*>(buffer), sizeof(T1));
+        std::memcpy(&b, reinterpret_cast<const unsigned char*>(buffer) + sizeof(T1), sizeof(T2));
+        return value_type(a, b);
+    }
+
+    alignas(detail::cache_line_size) std::atomic<std::uint64_t> seq_;
+    std::atomic<std::uint64_t> words_[word_count];
+};
+
+// ============================================================================
+// sharded_map: 分片加锁的并发哈希表
+// ============================================================================
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class sharded_map {
+public:
+    using key_type = K;
+    using mapped_type = V;
+
+    explicit sharded_map(std::size_t shard_count = 64) {
+        std::size_t n = 1;
+        while (n < shard_count) n <<= 1;
+        shards_ = std::make_unique<shard[]>(n);
+        shard_mask_ = n - 1;
+    }
+
+    // 插入或覆盖，返回是否为新键
+    bool insert_or_assign(const K& key, V value) {
+        auto& s = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(s.mutex);
+        return s.map.insert_or_assign(key, std::move(value)).second;
+    }
+
+    // 仅在键不存在时插入
+    bool insert(const K& key, V value) {
+        auto& s = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(s.mutex);
+        return s.map.emplace(key, std::move(value)).second;
+    }
+
+    std::optional<V> find(const K& key) const {
+        const auto& s = shard_for(key);
+        std::shared_lock<std::shared_mutex> lock(s.mutex);
+        auto it = s.map.find(key);
+        if (it == s.map.end()) return std::nullopt;
+        return it->second;
+    }
+
+    bool contains(const K& key) const {
+        const auto& s = shard_for(key);
+        std::shared_lock<std::shared_mutex> lock(s.mutex);
+        return s.map.find(key) != s.map.end();
+    }
+
+    bool erase(const K& key) {
+        auto& s = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(s.mutex);
+        return s.map.erase(key) != 0;
+    }
+
+    // 在分片锁内修改值，键不存在时先值初始化
+    template <typename Fn>
+    void update(const K& key, Fn&& fn) {
+        auto& s = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(s.mutex);
+        std::forward<Fn>(fn)(s.map[key]);
+    }
+
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i <= shard_mask_; ++i) {
+            std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+            total += shards_[i].map.size();
+        }
+        return total;
+    }
+
+    std::size_t shard_count() const noexcept { return shard_mask_ + 1; }
+
+private:
+    struct alignas(detail::cache_line_size) shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<K, V, Hash, KeyEqual> map;
+    };
+
+    // 用混合后的高位选分片，分片内的 unordered_map 使用低位选桶
+    std::size_t shard_index(const K& key) const {
+        auto h = detail::hash_mix64(static_cast<std::uint64_t>(Hash{}(key)));
+        return static_cast<std::size_t>(h >> 32) & shard_mask_;
+    }
+
+    shard& shard_for(const K& key) { return shards_[shard_index(key)]; }
+    const shard& shard_for(const K& key) const { return shards_[shard_index(key)]; }
+
+    std::unique_ptr<shard[]> shards_;
+    std::size_t shard_mask_ = 0;
+};
+
+// ============================================================================
+// mpmc_queue: 有界多生产者多消费者队列
+// ============================================================================
+
+template <typename T>
+class mpmc_queue {
+public:
+    using value_type = T;
+
+    explicit mpmc_queue(std::size_t capacity) {
+        std::size_t n = 2;
+        while (n < capacity) n <<= 1;
+        mask_ = n - 1;
+        cells_ = std::make_unique<cell[]>(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+    }
+
+    mpmc_queue(const mpmc_queue&) = delete;
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+    ~mpmc_queue() {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for (std::size_t pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            cell& c = cells_[pos & mask_];
+            if (c.sequence.load(std::memory_order_relaxed) == pos + 1) {
+                std::launder(reinterpret_cast<T*>(&c.storage))->~T();
+            }
+        }
+    }
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        cell* c;
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            c = &cells_[pos & mask_];
+            std::size_t seq = c->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // 队列已满
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        ::new (static_cast<void*>(&c->storage)) T(std::forward<Args>(args)...);
+        c->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value) { return try_emplace(value); }
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    bool try_pop(T& out) {
+        cell* c;
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            c = &cells_[pos & mask_];
+            std::size_t seq = c->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // 队列为空
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        T* item = std::launder(reinterpret_cast<T*>(&c->storage));
+        out = std::move(*item);
+        item->~T();
+        c->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t capacity() const noexcept { return mask_ + 1; }
+
+    // 近似元素个数（并发修改时仅供参考）
+    std::size_t size_approx() const noexcept {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        return tail >= head ? tail - head : 0;
+    }
+
+private:
+    struct cell {
+        std::atomic<std::size_t> sequence;
+        std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+    };
+
+    std::unique_ptr<cell[]> cells_;
+    std::size_t mask_ = 0;
+    alignas(detail::cache_line_size) std::atomic<std::size_t> head_;
+    alignas(detail::cache_line_size) std::atomic<std::size_t> tail_;
+};
+
+} // namespace my_stl
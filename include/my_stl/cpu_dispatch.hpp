@@ -0,0 +1,245 @@
+/*
+    关键特性说明
+    1. 运行时 CPU 特性检测
+        启动后第一次调用时用 cpuid/xgetbv 检测 SSE4.2、AVX2、AVX-512 和 BMI2，
+        同时确认操作系统保存了 YMM/ZMM 寄存器状态，结果缓存在静态变量中
+
+    2. 指令集等级
+        isa::scalar < sse42 < avx2 (含 BMI1/BMI2) < avx512 (F/BW/VL/DQ)
+        环境变量 MYSTL_ISA=scalar|sse42|avx2|avx512 可以把等级调低，用于测试和排查问题
+
+    3. 函数指针分派
+        dispatch_table 按等级登记内核实现，resolve 返回不高于给定等级的最高实现；
+        各批量内核在第一次调用时解析一次函数指针，之后只有一次间接调用的开销
+        因此同一个二进制可以部署到指令集不同的机器上，无需 -march=native
+
+    4. 目标属性
+        MYSTL_TARGET_SSE42 / AVX2 / AVX512 用 __attribute__((target)) 为单个函数开启指令集，
+        其余代码仍按基线指令集编译
+*/
+
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MYSTL_X86_DISPATCH 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#else
+#define MYSTL_X86_DISPATCH 0
+#endif
+
+#if MYSTL_X86_DISPATCH && (defined(__GNUC__) || defined(__clang__))
+#define MYSTL_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#define MYSTL_TARGET_AVX2 __attribute__((target("avx2,bmi,bmi2,popcnt")))
+#define MYSTL_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl,avx512dq,avx2,bmi,bmi2,popcnt")))
+#else
+#define MYSTL_TARGET_SSE42
+#define MYSTL_TARGET_AVX2
+#define MYSTL_TARGET_AVX512
+#endif
+
+// 登记各等级实现；非 x86 平台上 SIMD 实现不存在，只登记 scalar
+#if MYSTL_X86_DISPATCH
+#define MYSTL_DISPATCH_TABLE(scalar_fn, sse42_fn, avx2_fn, avx512_fn) {scalar_fn, sse42_fn, avx2_fn, avx512_fn}
+#else
+#define MYSTL_DISPATCH_TABLE(scalar_fn, sse42_fn, avx2_fn, avx512_fn) {scalar_fn}
+#endif
+
+namespace my_stl::simd {
+
+enum class isa : int {
+    scalar = 0,
+    sse42 = 1,
+    avx2 = 2,
+    avx512 = 3,
+};
+
+inline const char* isa_name(isa level) noexcept {
+    switch (level) {
+    case isa::sse42: return "sse4.2";
+    case isa::avx2: return "avx2";
+    case isa::avx512: return "avx512";
+    default: return "scalar";
+    }
+}
+
+struct cpu_features {
+    bool sse42 = false;
+    bool popcnt = false;
+    bool avx = false;
+    bool avx2 = false;
+    bool bmi1 = false;
+    bool bmi2 = false;
+    bool avx512f = false;
+    bool avx512dq = false;
+    bool avx512bw = false;
+    bool avx512vl = false;
+    bool os_ymm = false;   // XCR0 保存 YMM 状态
+    bool os_zmm = false;   // XCR0 保存 ZMM/opmask 状态
+};
+
+namespace detail {
+
+#if MYSTL_X86_DISPATCH
+inline void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int r[4];
+    __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) regs[i] = static_cast<unsigned>(r[i]);
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+inline unsigned long long xgetbv0() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    unsigned eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+inline cpu_features detect_cpu_features() noexcept {
+    cpu_features f;
+#if MYSTL_X86_DISPATCH
+    unsigned r[4];
+    cpuid(0, 0, r);
+    const unsigned max_leaf = r[0];
+    if (max_leaf < 1) return f;
+
+    cpuid(1, 0, r);
+    f.sse42 = (r[2] >> 20) & 1;
+    f.popcnt = (r[2] >> 23) & 1;
+    f.avx = (r[2] >> 28) & 1;
+    const bool osxsave = (r[2] >> 27) & 1;
+    if (osxsave) {
+        auto xcr0 = xgetbv0();
+        f.os_ymm = (xcr0 & 0x6) == 0x6;
+        f.os_zmm = (xcr0 & 0xe6) == 0xe6;
+    }
+
+    if (max_leaf >= 7) {
+        cpuid(7, 0, r);
+        f.bmi1 = (r[1] >> 3) & 1;
+        f.avx2 = (r[1] >> 5) & 1;
+        f.bmi2 = (r[1] >> 8) & 1;
+        f.avx512f = (r[1] >> 16) & 1;
+        f.avx512dq = (r[1] >> 17) & 1;
+        f.avx512bw = (r[1] >> 30) & 1;
+        f.avx512vl = (r[1] >> 31) & 1;
+    }
+#endif
+    return f;
+}
+
+inline isa level_of(const cpu_features& f) noexcept {
+    if (!(f.sse42 && f.popcnt)) return isa::scalar;
+    if (!(f.avx && f.avx2 && f.bmi1 && f.bmi2 && f.os_ymm)) return isa::sse42;
+    if (!(f.avx512f && f.avx512dq && f.avx512bw && f.avx512vl && f.os_zmm)) return isa::avx2;
+    return isa::avx512;
+}
+
+inline bool parse_isa(const char* text, isa& out) noexcept {
+    if (!text) return false;
+    if (std::strcmp(text, "scalar") == 0) out = isa::scalar;
+    else if (std::strcmp(text, "sse42") == 0 || std::strcmp(text, "sse4.2") == 0) out = isa::sse42;
+    else if (std::strcmp(text, "avx2") == 0) out = isa::avx2;
+    else if (std::strcmp(text, "avx512") == 0) out = isa::avx512;
+    else return false;
+    return true;
+}
+
+} // namespace detail
+
+// ============================================================================
+// 查询
+// ============================================================================
+
+inline const cpu_features& cpu() noexcept {
+    static const cpu_features features = detail::detect_cpu_features();
+    return features;
+}
+
+// CPU 与操作系统支持的最高等级
+inline isa detected_isa() noexcept {
+    static const isa level = detail::level_of(cpu());
+    return level;
+}
+
+// 实际使用的等级：detected_isa()，可由 MYSTL_ISA 环境变量调低
+inline isa active_isa() noexcept {
+    static const isa level = [] {
+        isa requested;
+        isa detected = detected_isa();
+        if (detail::parse_isa(std::getenv("MYSTL_ISA"), requested) &&
+            static_cast<int>(requested) < static_cast<int>(detected)) {
+            return requested;
+        }
+        return detected;
+    }();
+    return level;
+}
+
+inline std::string describe_cpu() {
+    const auto& f = cpu();
+    std::string s = "isa=";
+    s += isa_name(active_isa());
+    s += " detected=";
+    s += isa_name(detected_isa());
+    s += " features:";
+    if (f.sse42) s += " sse4.2";
+    if (f.popcnt) s += " popcnt";
+    if (f.avx2 && f.os_ymm) s += " avx2";
+    if (f.bmi2) s += " bmi2";
+    if (f.avx512f && f.os_zmm) s += " avx512f";
+    if (f.avx512bw && f.os_zmm) s += " avx512bw";
+    if (f.avx512vl && f.os_zmm) s += " avx512vl";
+    if (f.avx512dq && f.os_zmm) s += " avx512dq";
+    return s;
+}
+
+// ============================================================================
+// dispatch_table: 按等级登记的内核实现
+// ============================================================================
+
+template <typename Fn>
+struct dispatch_table {
+    Fn scalar;
+    Fn sse42 = nullptr;
+    Fn avx2 = nullptr;
+    Fn avx512 = nullptr;
+
+    // 不高于 level 的最高已登记等级，总能退回到 scalar
+    isa resolved_level(isa level) const noexcept {
+        switch (level) {
+        case isa::avx512: if (avx512) return isa::avx512; [[fallthrough]];
+        case isa::avx2: if (avx2) return isa::avx2; [[fallthrough]];
+        case isa::sse42: if (sse42) return isa::sse42; [[fallthrough]];
+        default: return isa::scalar;
+        }
+    }
+
+    Fn resolve(isa level) const noexcept {
+        switch (resolved_level(level)) {
+        case isa::avx512: return avx512;
+        case isa::avx2: return avx2;
+        case isa::sse42: return sse42;
+        default: return scalar;
+        }
+    }
+
+    Fn resolve() const noexcept { return resolve(active_isa()); }
+};
+
+} // namespace my_stl::simd
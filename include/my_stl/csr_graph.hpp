@@ -0,0 +1,354 @@
+/*
+    关键特性说明
+    1. 压缩稀疏行 (CSR) 图
+        csr_graph<W> 用 offsets (n + 1 个 64 位下标) 和 targets (每条弧的目标顶点) 存储有向图，
+        顶点 v 的邻居为 targets[offsets[v], offsets[v + 1])；W 不为 void 时 weights 与 targets 一一对应
+
+    2. 计数 + 前缀和放置的并行构建
+        build_csr(edges, m, options) 从未排序的边 pair<uint32_t, uint32_t> (u → v) 构建 CSR，
+        带权的边写作 pair<pair<uint32_t, uint32_t>, W>：
+            1) 各线程统计出度 (原子计数，单线程时退化为普通自增)
+            2) 按顶点分段并行前缀和得到 offsets
+            3) 各线程把自己那段边写入目标顶点所在行的游标位置
+        全程没有对边做比较排序，时间复杂度 O(n + m)；多线程时行内顺序不确定，
+        需要确定的顺序时打开 sort_neighbors
+
+    3. 可选的后处理
+        symmetrize         每条边 (u, v) 同时加入 (v, u)，自环只加入一次
+        remove_self_loops  丢弃 u == v 的边
+        sort_neighbors     每行按目标顶点升序 (长行用基数排序)，之后 has_edge 使用二分查找
+        dedup              去掉重复的弧 (隐含 sort_neighbors)，带权时保留最小的权重
+        num_vertices       顶点数，为 0 时取最大顶点编号 + 1
+        threads            线程数，为 0 时使用所有硬件线程；边数不足 csr_parallel_grain 时减少线程数
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "radix_sort.hpp"
+#include "detail/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace my_stl {
+
+struct csr_options {
+    std::uint32_t num_vertices = 0;
+    bool symmetrize = false;
+    bool remove_self_loops = false;
+    bool sort_neighbors = false;
+    bool dedup = false;
+    unsigned threads = 0;
+};
+
+template <typename W = void>
+class csr_graph;
+
+namespace detail {
+
+// 每个线程至少处理的边数 (或行内弧数)
+inline constexpr std::size_t csr_parallel_grain = std::size_t(1) << 16;
+
+struct csr_no_weights {};
+
+template <typename W>
+struct csr_weight_storage { using type = std::vector<W>; };
+
+template <>
+struct csr_weight_storage<void> { using type = csr_no_weights; };
+
+template <typename W>
+struct csr_builder;
+
+} // namespace detail
+
+// ==================== CSR 图 ====================
+
+template <typename W>
+class csr_graph {
+public:
+    using vertex_type = std::uint32_t;
+    using edge_index = std::uint64_t;
+    using weight_type = W;
+    using neighbor_range = pair<const vertex_type*, const vertex_type*>;
+
+    csr_graph() = default;
+
+    std::size_t num_vertices() const noexcept { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+    std::size_t num_edges() const noexcept { return targets_.size(); }
+    bool empty() const noexcept { return num_vertices() == 0; }
+    // 每行是否按目标顶点升序
+    bool sorted() const noexcept { return sorted_; }
+
+    std::size_t degree(vertex_type v) const {
+        assert(v < num_vertices());
+        return static_cast<std::size_t>(offsets_[v + 1] - offsets_[v]);
+    }
+
+    neighbor_range neighbors(vertex_type v) const {
+        assert(v < num_vertices());
+        const vertex_type* base = targets_.data();
+        return neighbor_range(base + offsets_[v], base + offsets_[v + 1]);
+    }
+
+    template <typename U = W, typename = std::enable_if_t<!std::is_void_v<U>>>
+    pair<const U*, const U*> edge_weights(vertex_type v) const {
+        assert(v < num_vertices());
+        const U* base = weights_.data();
+        return pair<const U*, const U*>(base + offsets_[v], base + offsets_[v + 1]);
+    }
+
+    bool has_edge(vertex_type u, vertex_type v) const {
+        if (u >= num_vertices()) return false;
+        auto row = neighbors(u);
+        return sorted_ ? std::binary_search(row.first, row.second, v) : std::find(row.first, row.second, v) != row.second;
+    }
+
+    const std::vector<edge_index>& offsets() const noexcept { return offsets_; }
+    const std::vector<vertex_type>& targets() const noexcept { return targets_; }
+
+    template <typename U = W, typename = std::enable_if_t<!std::is_void_v<U>>>
+    const std::vector<U>& weights() const noexcept {
+        return weights_;
+    }
+
+    std::size_t memory_usage() const noexcept {
+        std::size_t bytes = offsets_.capacity() * sizeof(edge_index) + targets_.capacity() * sizeof(vertex_type);
+        if constexpr (!std::is_void_v<W>) bytes += weights_.capacity() * sizeof(W);
+        return bytes;
+    }
+
+private:
+    friend struct detail::csr_builder<W>;
+
+    std::vector<edge_index> offsets_;
+    std::vector<vertex_type> targets_;
+    typename detail::csr_weight_storage<W>::type weights_;
+    bool sorted_ = false;
+};
+
+namespace detail {
+
+// ==================== 构建 ====================
+
+template <typename W>
+struct csr_builder {
+    using graph_type = csr_graph<W>;
+    using vertex_type = typename graph_type::vertex_type;
+    using edge_index = typename graph_type::edge_index;
+    static constexpr bool weighted = !std::is_void_v<W>;
+
+    // offsets[v + 1] = offsets[v] + degree(v)：各段先求和，再串行累加段和，最后各段写出
+    template <typename Degree>
+    static void exclusive_scan(std::vector<edge_index>& offsets, std::size_t n, std::size_t chunks, Degree degree) {
+        offsets.assign(n + 1, 0);
+        std::vector<edge_index> sums(chunks + 1, 0);
+        parallel_invoke(chunks, [&](std::size_t c) {
+            edge_index sum = 0;
+            for (std::size_t v = chunk_begin(n, chunks, c), end = chunk_begin(n, chunks, c + 1); v < end; ++v) {
+                sum += degree(v);
+            }
+            sums[c + 1] = sum;
+        });
+        for (std::size_t c = 0; c < chunks; ++c) sums[c + 1] += sums[c];
+        parallel_invoke(chunks, [&](std::size_t c) {
+            edge_index at = sums[c];
+            for (std::size_t v = chunk_begin(n, chunks, c), end = chunk_begin(n, chunks, c + 1); v < end; ++v) {
+                at += degree(v);
+                offsets[v + 1] = at;
+            }
+        });
+    }
+
+    // 按弧数均分顶点，返回 chunks + 1 个行边界
+    static std::vector<std::size_t> row_bounds(const std::vector<edge_index>& offsets, std::size_t chunks) {
+        const std::size_t n = offsets.size() - 1;
+        const std::size_t total = static_cast<std::size_t>(offsets[n]);
+        std::vector<std::size_t> bounds(chunks + 1, n);
+        bounds[0] = 0;
+        for (std::size_t c = 1; c < chunks; ++c) {
+            auto at = std::lower_bound(offsets.begin(), offsets.begin() + static_cast<std::ptrdiff_t>(n),
+                                       static_cast<edge_index>(chunk_begin(total, chunks, c)));
+            bounds[c] = std::max(bounds[c - 1], static_cast<std::size_t>(at - offsets.begin()));
+        }
+        return bounds;
+    }
+
+    // 行内排序，去重时把保留的弧移到行首并返回保留的个数
+    static std::size_t sort_row(graph_type& g, std::size_t begin, std::size_t end, bool dedup,
+                                std::vector<pair<vertex_type, std::conditional_t<weighted, W, char>>>& scratch) {
+        vertex_type* targets = g.targets_.data() + begin;
+        const std::size_t len = end - begin;
+        if constexpr (weighted) {
+            W* weights = g.weights_.data() + begin;
+            scratch.clear();
+            for (std::size_t i = 0; i < len; ++i) scratch.emplace_back(targets[i], weights[i]);
+            std::sort(scratch.begin(), scratch.end());
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < len; ++i) {
+                if (dedup && kept != 0 && targets[kept - 1] == scratch[i].first) continue;
+                targets[kept] = scratch[i].first;
+                weights[kept] = scratch[i].second;
+                ++kept;
+            }
+            return kept;
+        } else {
+            (void)scratch;
+            radix_sort(targets, len);
+            return dedup ? static_cast<std::size_t>(std::unique(targets, targets + len) - targets) : len;
+        }
+    }
+
+    template <typename E, typename Endpoints, typename Weight>
+    static graph_type build(const E* edges, std::size_t m, const csr_options& opt, Endpoints endpoints, Weight weight) {
+        const std::size_t threads = resolve_threads(opt.threads);
+        auto chunks_for = [&](std::size_t work) {
+            return std::min<std::size_t>(threads, std::max<std::size_t>(1, work / csr_parallel_grain));
+        };
+        const std::size_t edge_chunks = chunks_for(m);
+
+        // 顶点数
+        std::size_t n = opt.num_vertices;
+        if (n == 0 && m != 0) {
+            std::vector<vertex_type> highest(edge_chunks, 0);
+            parallel_invoke(edge_chunks, [&](std::size_t c) {
+                vertex_type h = 0;
+                for (std::size_t i = chunk_begin(m, edge_chunks, c), end = chunk_begin(m, edge_chunks, c + 1); i < end; ++i) {
+                    const auto& e = endpoints(edges[i]);
+                    h = std::max(h, std::max(e.first, e.second));
+                }
+                highest[c] = h;
+            });
+            n = static_cast<std::size_t>(*std::max_element(highest.begin(), highest.end())) + 1;
+        }
+
+        // 对段 c 中的每条弧调用 visit(u, v, 边下标)
+        auto for_each_arc = [&](std::size_t c, auto&& visit) {
+            for (std::size_t i = chunk_begin(m, edge_chunks, c), end = chunk_begin(m, edge_chunks, c + 1); i < end; ++i) {
+                const auto& e = endpoints(edges[i]);
+                const vertex_type u = e.first;
+                const vertex_type v = e.second;
+                assert(u < n && v < n);
+                if (u == v) {
+                    if (!opt.remove_self_loops) visit(u, v, i);
+                    continue;
+                }
+                visit(u, v, i);
+                if (opt.symmetrize) visit(v, u, i);
+            }
+        };
+
+        // 单线程时不需要原子读改写
+        const bool shared = edge_chunks > 1;
+        std::vector<std::atomic<edge_index>> cursor(n);
+        auto bump = [shared](std::atomic<edge_index>& c) {
+            if (shared) return c.fetch_add(1, std::memory_order_relaxed);
+            edge_index old = c.load(std::memory_order_relaxed);
+            c.store(old + 1, std::memory_order_relaxed);
+            return old;
+        };
+
+        // 1) 出度
+        parallel_invoke(edge_chunks, [&](std::size_t c) {
+            for_each_arc(c, [&](vertex_type u, vertex_type, std::size_t) { bump(cursor[u]); });
+        });
+
+        // 2) 前缀和，游标改为每行的起点
+        graph_type g;
+        const std::size_t vertex_chunks = chunks_for(n);
+        exclusive_scan(g.offsets_, n, vertex_chunks,
+                       [&](std::size_t v) { return cursor[v].load(std::memory_order_relaxed); });
+        parallel_invoke(vertex_chunks, [&](std::size_t c) {
+            for (std::size_t v = chunk_begin(n, vertex_chunks, c), end = chunk_begin(n, vertex_chunks, c + 1); v < end; ++v) {
+                cursor[v].store(g.offsets_[v], std::memory_order_relaxed);
+            }
+        });
+
+        // 3) 放置
+        const std::size_t arcs = static_cast<std::size_t>(g.offsets_[n]);
+        g.targets_.resize(arcs);
+        if constexpr (weighted) g.weights_.resize(arcs);
+        parallel_invoke(edge_chunks, [&](std::size_t c) {
+            for_each_arc(c, [&](vertex_type u, vertex_type v, std::size_t i) {
+                const auto at = static_cast<std::size_t>(bump(cursor[u]));
+                g.targets_[at] = v;
+                if constexpr (weighted) g.weights_[at] = weight(edges[i]);
+            });
+        });
+        cursor = std::vector<std::atomic<edge_index>>();
+
+        if (!opt.sort_neighbors && !opt.dedup) return g;
+        g.sorted_ = true;
+
+        // 4) 行内排序与去重，按弧数均分顶点
+        const std::size_t row_chunks = chunks_for(arcs);
+        const auto bounds = row_bounds(g.offsets_, row_chunks);
+        std::vector<edge_index> kept(opt.dedup ? n : 0);
+        parallel_invoke(row_chunks, [&](std::size_t c) {
+            std::vector<pair<vertex_type, std::conditional_t<weighted, W, char>>> scratch;
+            for (std::size_t v = bounds[c]; v < bounds[c + 1]; ++v) {
+                std::size_t k = sort_row(g, static_cast<std::size_t>(g.offsets_[v]), static_cast<std::size_t>(g.offsets_[v + 1]),
+                                         opt.dedup, scratch);
+                if (opt.dedup) kept[v] = k;
+            }
+        });
+        if (!opt.dedup) return g;
+
+        // 5) 压缩到新的数组
+        std::vector<edge_index> offsets;
+        exclusive_scan(offsets, n, vertex_chunks, [&](std::size_t v) { return kept[v]; });
+        graph_type out;
+        out.sorted_ = true;
+        out.targets_.resize(static_cast<std::size_t>(offsets[n]));
+        if constexpr (weighted) out.weights_.resize(out.targets_.size());
+        parallel_invoke(row_chunks, [&](std::size_t c) {
+            for (std::size_t v = bounds[c]; v < bounds[c + 1]; ++v) {
+                auto from = static_cast<std::ptrdiff_t>(g.offsets_[v]);
+                auto to = static_cast<std::ptrdiff_t>(offsets[v]);
+                auto len = static_cast<std::ptrdiff_t>(kept[v]);
+                std::copy(g.targets_.begin() + from, g.targets_.begin() + from + len, out.targets_.begin() + to);
+                if constexpr (weighted) {
+                    std::copy(g.weights_.begin() + from, g.weights_.begin() + from + len, out.weights_.begin() + to);
+                }
+            }
+        });
+        out.offsets_ = std::move(offsets);
+        return out;
+    }
+};
+
+} // namespace detail
+
+// ==================== 构建接口 ====================
+
+inline csr_graph<> build_csr(const pair<std::uint32_t, std::uint32_t>* edges, std::size_t m, const csr_options& opt = {}) {
+    using edge = pair<std::uint32_t, std::uint32_t>;
+    return detail::csr_builder<void>::build(
+        edges, m, opt, [](const edge& e) -> const edge& { return e; }, [](const edge&) { return 0; });
+}
+
+inline csr_graph<> build_csr(const std::vector<pair<std::uint32_t, std::uint32_t>>& edges, const csr_options& opt = {}) {
+    return build_csr(edges.data(), edges.size(), opt);
+}
+
+template <typename W>
+inline csr_graph<W> build_csr(const pair<pair<std::uint32_t, std::uint32_t>, W>* edges, std::size_t m,
+                              const csr_options& opt = {}) {
+    using edge = pair<pair<std::uint32_t, std::uint32_t>, W>;
+    return detail::csr_builder<W>::build(
+        edges, m, opt, [](const edge& e) -> const pair<std::uint32_t, std::uint32_t>& { return e.first; },
+        [](const edge& e) -> const W& { return e.second; });
+}
+
+template <typename W>
+inline csr_graph<W> build_csr(const std::vector<pair<pair<std::uint32_t, std::uint32_t>, W>>& edges,
+                              const csr_options& opt = {}) {
+    return build_csr(edges.data(), edges.size(), opt);
+}
+
+} // namespace my_stl
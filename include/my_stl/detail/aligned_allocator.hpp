@@ -0,0 +1,43 @@
+/*
+    关键特性说明
+    1. 按缓存行对齐的分配器
+        aligned_allocator<T, Align> 用 C++17 的对齐 operator new 分配，
+        std::vector<T, aligned_allocator<T, 64>> 的首元素总在缓存行起始处，
+        拷贝和移动后仍然保持对齐
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace my_stl::detail {
+
+template <typename T, std::size_t Align = 64>
+struct aligned_allocator {
+    static_assert(Align >= alignof(T) && (Align & (Align - 1)) == 0, "alignment must be a power of two");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind { using other = aligned_allocator<U, Align>; };
+
+    aligned_allocator() noexcept = default;
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Align>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Align));
+    }
+
+    template <typename U>
+    bool operator==(const aligned_allocator<U, Align>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const aligned_allocator<U, Align>&) const noexcept { return false; }
+};
+
+} // namespace my_stl::detail
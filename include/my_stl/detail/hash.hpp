@@ -0,0 +1,35 @@
+/*
+    关键特性说明
+    1. 64 位混合函数
+        hash_mix64 使用 splitmix64 的终结步骤，每个输入位以约 1/2 的概率翻转每个输出位
+        即使 std::hash<int> 是恒等映射，也能得到均匀的桶分布
+
+    2. 非对称组合
+        hash_combine64(a, b) = mix(a ^ mix(b + 常数))
+        (a, b) 与 (b, a) 得到不同结果，(a, a) 也不会退化为 0
+        旧的 h1 ^ (h2 << 1) 在网格坐标和小整数上会大量冲突
+
+    3. 供 std::hash<my_stl::pair> 与 my_stl::pair_hash 共用
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace my_stl::detail {
+
+constexpr std::uint64_t hash_mix64(std::uint64_t x) noexcept {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+constexpr std::uint64_t hash_combine64(std::uint64_t first_hash, std::uint64_t second_hash) noexcept {
+    return hash_mix64(first_hash ^ hash_mix64(second_hash + 0x9e3779b97f4a7c15ULL));
+}
+
+} // namespace my_stl::detail
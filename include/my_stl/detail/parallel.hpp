@@ -0,0 +1,59 @@
+/*
+    关键特性说明
+    1. 分段并行
+        parallel_invoke(chunks, fn) 在 chunks 个线程上分别调用 fn(c)，第 0 段在调用线程上执行；
+        任一段抛出的异常在所有线程结束后重新抛出 (只保留第一段的异常)
+
+    2. 分段边界
+        chunk_begin(n, chunks, c) 把 [0, n) 均分为 chunks 段，前 n % chunks 段各多一个元素
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace my_stl::detail {
+
+// 0 表示使用所有硬件线程
+inline unsigned resolve_threads(unsigned threads) noexcept {
+    return threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+inline std::size_t chunk_begin(std::size_t n, std::size_t chunks, std::size_t c) noexcept {
+    return n / chunks * c + std::min(c, n % chunks);
+}
+
+template <typename Fn>
+inline void parallel_invoke(std::size_t chunks, Fn&& fn) {
+    if (chunks <= 1) {
+        if (chunks == 1) fn(std::size_t(0));
+        return;
+    }
+    std::vector<std::exception_ptr> errors(chunks);
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    auto run = [&](std::size_t c) {
+        try {
+            fn(c);
+        } catch (...) {
+            errors[c] = std::current_exception();
+        }
+    };
+    try {
+        for (std::size_t c = 1; c < chunks; ++c) workers.emplace_back(run, c);
+    } catch (...) {
+        for (auto& w : workers) w.join();
+        throw;
+    }
+    run(0);
+    for (auto& w : workers) w.join();
+    for (auto& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+}
+
+} // namespace my_stl::detail
@@ -0,0 +1,35 @@
+/*
+    关键特性说明
+    1. 软件预取
+        prefetch_read / prefetch_write 提示 CPU 提前把地址所在的缓存行取到 L1，
+        用于批量查找时隐藏随机访问的延迟；不支持的编译器上为空操作
+*/
+
+#pragma once
+
+#include "../cpu_dispatch.hpp"
+
+namespace my_stl::detail {
+
+inline void prefetch_read(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 3);
+#elif MYSTL_X86_DISPATCH
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+// 随后要写的缓存行，避免先以共享状态读入再升级
+inline void prefetch_write(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 1, 3);
+#elif MYSTL_X86_DISPATCH
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+} // namespace my_stl::detail
@@ -0,0 +1,87 @@
+/*
+    关键特性说明
+    1. 32 位下标的开放寻址表
+        slot_table 只保存指向外部条目数组的 32 位下标 (空位为 slot_nil)，线性探测；
+        键的比较和哈希由调用者根据下标完成，表本身不存储键、哈希或标签
+
+    2. 无墓碑删除
+        erase 删除表项后，把同一探测链上后面可以前移的表项逐个前移填补空位；
+        条目在外部数组中移动位置时用 relabel 改写指向它的表项；
+        前移过程由 backshift 实现，表项带有其它字段的线性探测表 (如 cache_storage) 也复用它
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace my_stl::detail {
+
+inline constexpr std::uint32_t slot_nil = 0xFFFFFFFFu;
+
+// 线性探测表 (大小为 mask + 1) 在位置 i 空出后，把同一探测链上后面可以前移的表项逐个前移，
+// 返回最终空出的位置；empty(e) 判断空位，home(e) 给出表项的哈希
+template <typename Entry, typename Empty, typename Home>
+std::size_t backshift(Entry* table, std::size_t mask, std::size_t i, Empty&& empty, Home&& home) {
+    for (std::size_t j = (i + 1) & mask;; j = (j + 1) & mask) {
+        const Entry e = table[j];
+        if (empty(e)) return i;
+        // 从起始位置探测到 j 会经过 i 时才能前移
+        std::size_t start = home(e) & mask;
+        if (((j - start) & mask) >= ((j - i) & mask)) {
+            table[i] = e;
+            i = j;
+        }
+    }
+}
+
+// 32 位下标的线性探测表，键的比较与哈希由调用者根据下标完成
+class slot_table {
+public:
+    void reset(std::size_t buckets) {
+        slots_.assign(buckets, slot_nil);
+        mask_ = buckets - 1;
+    }
+
+    std::size_t buckets() const noexcept { return slots_.size(); }
+
+    template <typename Match>
+    std::uint32_t find(std::uint64_t h, Match&& match) const {
+        for (std::size_t i = h & mask_;; i = (i + 1) & mask_) {
+            std::uint32_t s = slots_[i];
+            if (s == slot_nil || match(s)) return s;
+        }
+    }
+
+    void insert(std::uint64_t h, std::uint32_t slot) noexcept {
+        std::size_t i = h & mask_;
+        while (slots_[i] != slot_nil) i = (i + 1) & mask_;
+        slots_[i] = slot;
+    }
+
+    // 删除指向 slot 的表项，hash_of(下标) 给出其它表项的哈希以判断能否前移
+    template <typename HashOf>
+    void erase(std::uint64_t h, std::uint32_t slot, HashOf&& hash_of) {
+        std::size_t i = backshift(slots_.data(), mask_, position(h, slot),
+                                  [](std::uint32_t s) { return s == slot_nil; }, hash_of);
+        slots_[i] = slot_nil;
+    }
+
+    // 条目从 from 移到 to 后改写指向它的表项
+    void relabel(std::uint64_t h, std::uint32_t from, std::uint32_t to) noexcept { slots_[position(h, from)] = to; }
+
+    std::size_t memory_usage() const noexcept { return slots_.capacity() * sizeof(std::uint32_t); }
+
+private:
+    std::size_t position(std::uint64_t h, std::uint32_t slot) const noexcept {
+        std::size_t i = h & mask_;
+        while (slots_[i] != slot) i = (i + 1) & mask_;
+        return i;
+    }
+
+    std::vector<std::uint32_t> slots_;
+    std::size_t mask_ = 0;
+};
+
+} // namespace my_stl::detail
@@ -45,6 +45,18 @@ struct is_empty_and_non_final : std::bool_constant<
 template <typename T>
 inline constexpr bool is_empty_and_non_final_v = is_empty_and_non_final<T>::value;
 
+// 判断类型能否按字节拷贝 (memcpy)
+// pair 声明了拷贝赋值运算符，因此不是 trivially copyable，但成员都可按字节拷贝时 pair 本身也可以
+template <typename T>
+struct is_bitwise_copyable : std::is_trivially_copyable<T> {};
+
+template <typename T1, typename T2>
+struct is_bitwise_copyable<my_stl::pair<T1, T2>>
+    : std::bool_constant<is_bitwise_copyable<T1>::value && is_bitwise_copyable<T2>::value> {};
+
+template <typename T>
+inline constexpr bool is_bitwise_copyable_v = is_bitwise_copyable<T>::value;
+
 // 判断类型是否可以交换
 template <typename T>
 struct is_swappable : std::bool_constant <
@@ -96,6 +108,13 @@ using unwrap_reference_t = typename unwrap_reference<T>::type;
 template <class T>
 using unwrap_ref_decay_t = unwrap_reference_t<std::decay_t<T>>;
 
+// 阻止模板参数推导 (C++20 std::type_identity_t)
+template <class T>
+struct type_identity { using type = T; };
+
+template <class T>
+using type_identity_t = typename type_identity<T>::type;
+
 // 添加引用（保持值的类型）
 template <typename T>
 constexpr T&& forward(std::remove_reference_t<T>& t) noexcept { 
@@ -208,6 +227,32 @@ struct is_nothrow_move : std::bool_constant<
 template <typename T>
 inline constexpr bool is_nothrow_move_v = is_nothrow_move<T>::value;
 
+// ============================================================================
+// 可平凡重定位检查
+// ============================================================================
+
+// 对象能否用 memcpy 搬到新地址并直接丢弃旧对象（不调用移动构造和析构）
+// 默认保守地等同于平凡可拷贝；pair 的用户提供赋值运算符不影响这一性质，
+// 因此 pair 按成员递归判断
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<
+    std::is_trivially_copyable_v<T> ||
+    (std::is_trivially_move_constructible_v<T> && std::is_trivially_destructible_v<T>)
+> {};
+
+template <typename T1, typename T2>
+struct is_trivially_relocatable<my_stl::pair<T1, T2>> : std::bool_constant<
+    is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value
+> {};
+
+template <typename T1, typename T2>
+struct is_trivially_relocatable<std::pair<T1, T2>> : std::bool_constant<
+    is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value
+> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 // ============================================================================
 // 简单的概念模拟（C++20之前）
 // ============================================================================
@@ -0,0 +1,42 @@
+/*
+    关键特性说明
+    1. 可读的类型名
+        GCC/Clang 下通过 abi::__cxa_demangle 还原 typeid 名称
+        其他编译器直接返回 typeid(T).name()
+
+    2. 供诊断工具共用
+        插桩报告(instrument.hpp)与内存布局报告(layout.hpp)使用同一实现
+*/
+
+#pragma once
+
+#include <cstdlib>
+#include <string>
+#include <typeinfo>
+
+#if defined(__GNUG__) && __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define MYSTL_HAS_CXXABI 1
+#endif
+
+namespace my_stl::detail {
+
+inline std::string demangle(const char* name) {
+#ifdef MYSTL_HAS_CXXABI
+    int status = 0;
+    char* result = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0 && result != nullptr) {
+        std::string out(result);
+        std::free(result);
+        return out;
+    }
+#endif
+    return name;
+}
+
+template <typename T>
+std::string type_name() {
+    return demangle(typeid(T).name());
+}
+
+} // namespace my_stl::detail
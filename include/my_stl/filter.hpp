@@ -0,0 +1,276 @@
+/*
+    关键特性说明
+    1. 按成员过滤
+        filter_pairs(in, n, on_first, on_second, out) 把 first 落在 on_first、second 落在 on_second
+        范围内的元素按原顺序写入 out，返回写入个数；
+        member_range 表示闭区间 [lo, hi]，equal_to(v) 即 [v, v]，any() 为整个值域 (NaN 不匹配)
+
+    2. 无分支
+        标量实现每个元素都写入 out[count]，再按谓词结果增加 count；
+        SIMD 实现一次比较一个寄存器内的所有成员，用 AVX-512 的 vpcompressq 或
+        AVX2 的置换表 + vpermd 把匹配的元素压缩到寄存器前部后整体写出，
+        选择率 1%~50% 时都没有分支预测失败
+
+    3. 输出约定
+        out 须能容纳 n 个元素 (与最坏情况相同)；[返回值, n) 内的元素可能被覆盖，内容未指定
+
+    4. 运行时分派
+        两个成员都是 4 字节或都是 8 字节的算术类型 (可混合整数与浮点，如 (uint64 时间戳, double))
+        且 pair 无填充时使用 cpu_dispatch.hpp 登记的 AVX2/AVX-512 实现，其余类型使用标量实现
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "cpu_dispatch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace my_stl {
+
+// 成员的闭区间谓词 lo <= v && v <= hi
+template <typename T>
+struct member_range {
+    T lo;
+    T hi;
+
+    static member_range any() noexcept {
+        if constexpr (std::numeric_limits<T>::has_infinity) {
+            return {-std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity()};
+        } else {
+            return {std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max()};
+        }
+    }
+    static member_range equal_to(const T& v) { return {v, v}; }
+    static member_range between(const T& lo, const T& hi) { return {lo, hi}; }
+
+    bool operator()(const T& v) const { return lo <= v && v <= hi; }
+};
+
+namespace detail {
+
+template <typename A, typename B>
+inline constexpr bool is_simd_filterable_v =
+    std::is_arithmetic_v<A> && std::is_arithmetic_v<B> && !std::is_same_v<A, bool> && !std::is_same_v<B, bool> &&
+    sizeof(A) == sizeof(B) && (sizeof(A) == 4 || sizeof(A) == 8) && sizeof(pair<A, B>) == 2 * sizeof(A) &&
+    std::is_standard_layout_v<pair<A, B>>;
+
+template <typename A, typename B>
+using filter_fn = std::size_t (*)(const pair<A, B>* in, std::size_t n, member_range<A> on_first,
+                                  member_range<B> on_second, pair<A, B>* out);
+
+template <typename A, typename B>
+inline std::size_t filter_scalar(const pair<A, B>* in, std::size_t n, member_range<A> on_first,
+                                 member_range<B> on_second, pair<A, B>* out) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        out[count] = in[i];
+        count += static_cast<std::size_t>(static_cast<int>(on_first(in[i].first)) & static_cast<int>(on_second(in[i].second)));
+    }
+    return count;
+}
+
+#if MYSTL_X86_DISPATCH
+
+// 成员的位模式，按成员宽度广播
+template <typename T>
+inline auto bits_of(T v) noexcept {
+    std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t> b;
+    std::memcpy(&b, &v, sizeof(T));
+    return b;
+}
+
+// ============================================================================
+// AVX2: 区间比较 + 置换表压缩
+// ============================================================================
+
+// 压缩置换表 (以 32 位元素为单位): 4 个 8 字节 pair 或 2 个 16 字节 pair
+struct compress_table_avx2 {
+    alignas(32) std::int32_t narrow[16][8];
+    alignas(32) std::int32_t wide[4][8];
+};
+
+constexpr compress_table_avx2 make_compress_table_avx2() {
+    compress_table_avx2 t{};
+    for (int m = 0; m < 16; ++m) {
+        int k = 0;
+        for (int p = 0; p < 4; ++p) {
+            if ((m >> p) & 1) {
+                t.narrow[m][2 * k] = 2 * p;
+                t.narrow[m][2 * k + 1] = 2 * p + 1;
+                ++k;
+            }
+        }
+    }
+    for (int m = 0; m < 4; ++m) {
+        int k = 0;
+        for (int p = 0; p < 2; ++p) {
+            if ((m >> p) & 1) {
+                for (int d = 0; d < 4; ++d) t.wide[m][4 * k + d] = 4 * p + d;
+                ++k;
+            }
+        }
+    }
+    return t;
+}
+
+inline constexpr compress_table_avx2 compress_avx2 = make_compress_table_avx2();
+
+template <typename T>
+MYSTL_TARGET_AVX2 inline __m256i broadcast_avx2(T v) {
+    if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(bits_of(v));
+    else return _mm256_set1_epi64x(bits_of(v));
+}
+
+// 把所有元素按 T 解释，返回 lo <= x <= hi 的元素掩码 (全 1)
+template <typename T>
+MYSTL_TARGET_AVX2 inline __m256i in_range_avx2(__m256i x, __m256i lo, __m256i hi) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if constexpr (sizeof(T) == 4) {
+            __m256 v = _mm256_castsi256_ps(x);
+            return _mm256_castps_si256(_mm256_and_ps(_mm256_cmp_ps(v, _mm256_castsi256_ps(lo), _CMP_GE_OQ),
+                                                     _mm256_cmp_ps(v, _mm256_castsi256_ps(hi), _CMP_LE_OQ)));
+        } else {
+            __m256d v = _mm256_castsi256_pd(x);
+            return _mm256_castpd_si256(_mm256_and_pd(_mm256_cmp_pd(v, _mm256_castsi256_pd(lo), _CMP_GE_OQ),
+                                                     _mm256_cmp_pd(v, _mm256_castsi256_pd(hi), _CMP_LE_OQ)));
+        }
+    } else {
+        // 无符号与符号位异或后按有符号比较 (lo/hi 在构造时已异或)
+        if constexpr (std::is_unsigned_v<T>) {
+            x = _mm256_xor_si256(x, sizeof(T) == 4 ? _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min())
+                                                   : _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min()));
+        }
+        __m256i outside = sizeof(T) == 4 ? _mm256_or_si256(_mm256_cmpgt_epi32(lo, x), _mm256_cmpgt_epi32(x, hi))
+                                         : _mm256_or_si256(_mm256_cmpgt_epi64(lo, x), _mm256_cmpgt_epi64(x, hi));
+        return _mm256_xor_si256(outside, _mm256_set1_epi32(-1));
+    }
+}
+
+template <typename T>
+MYSTL_TARGET_AVX2 inline void range_bounds_avx2(const member_range<T>& r, __m256i& lo, __m256i& hi) {
+    lo = broadcast_avx2(r.lo);
+    hi = broadcast_avx2(r.hi);
+    if constexpr (std::is_unsigned_v<T>) {
+        const __m256i flip = sizeof(T) == 4 ? _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min())
+                                            : _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+        lo = _mm256_xor_si256(lo, flip);
+        hi = _mm256_xor_si256(hi, flip);
+    }
+}
+
+template <typename A, typename B>
+MYSTL_TARGET_AVX2 inline std::size_t filter_avx2(const pair<A, B>* in, std::size_t n, member_range<A> on_first,
+                                                 member_range<B> on_second, pair<A, B>* out) {
+    constexpr bool narrow = sizeof(A) == 4;
+    constexpr std::size_t step = 32 / sizeof(pair<A, B>);
+    __m256i lo_a, hi_a, lo_b, hi_b;
+    range_bounds_avx2(on_first, lo_a, hi_a);
+    range_bounds_avx2(on_second, lo_b, hi_b);
+    // 偶数成员是 first
+    const __m256i is_first = narrow ? _mm256_set1_epi64x(0xffffffffll) : _mm256_setr_epi64x(-1, 0, -1, 0);
+
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i match = _mm256_blendv_epi8(in_range_avx2<B>(x, lo_b, hi_b), in_range_avx2<A>(x, lo_a, hi_a), is_first);
+        unsigned pairs;
+        __m256i perm;
+        if constexpr (narrow) {
+            unsigned lanes = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(match)));
+            pairs = _pext_u32(lanes & (lanes >> 1), 0x55);
+            perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(compress_avx2.narrow[pairs]));
+        } else {
+            unsigned lanes = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(match)));
+            pairs = _pext_u32(lanes & (lanes >> 1), 0x5);
+            perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(compress_avx2.wide[pairs]));
+        }
+        // count <= i，整块写出不会越过 out + n
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + count), _mm256_permutevar8x32_epi32(x, perm));
+        count += static_cast<std::size_t>(_mm_popcnt_u32(pairs));
+    }
+    return count + filter_scalar(in + i, n - i, on_first, on_second, out + count);
+}
+
+// ============================================================================
+// AVX-512: 掩码比较 + vpcompressq
+// ============================================================================
+
+// 把所有元素按 T 解释，返回 lo <= x <= hi 的元素位掩码
+template <typename T>
+MYSTL_TARGET_AVX512 inline unsigned in_range_avx512(__m512i x, T lo, T hi) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if constexpr (sizeof(T) == 4) {
+            __m512 v = _mm512_castsi512_ps(x);
+            return _mm512_cmp_ps_mask(v, _mm512_set1_ps(lo), _CMP_GE_OQ) & _mm512_cmp_ps_mask(v, _mm512_set1_ps(hi), _CMP_LE_OQ);
+        } else {
+            __m512d v = _mm512_castsi512_pd(x);
+            return _mm512_cmp_pd_mask(v, _mm512_set1_pd(lo), _CMP_GE_OQ) & _mm512_cmp_pd_mask(v, _mm512_set1_pd(hi), _CMP_LE_OQ);
+        }
+    } else if constexpr (sizeof(T) == 4) {
+        const __m512i l = _mm512_set1_epi32(bits_of(lo)), h = _mm512_set1_epi32(bits_of(hi));
+        if constexpr (std::is_signed_v<T>) return _mm512_cmpge_epi32_mask(x, l) & _mm512_cmple_epi32_mask(x, h);
+        else return _mm512_cmpge_epu32_mask(x, l) & _mm512_cmple_epu32_mask(x, h);
+    } else {
+        const __m512i l = _mm512_set1_epi64(bits_of(lo)), h = _mm512_set1_epi64(bits_of(hi));
+        if constexpr (std::is_signed_v<T>) return _mm512_cmpge_epi64_mask(x, l) & _mm512_cmple_epi64_mask(x, h);
+        else return _mm512_cmpge_epu64_mask(x, l) & _mm512_cmple_epu64_mask(x, h);
+    }
+}
+
+template <typename A, typename B>
+MYSTL_TARGET_AVX512 inline std::size_t filter_avx512(const pair<A, B>* in, std::size_t n, member_range<A> on_first,
+                                                     member_range<B> on_second, pair<A, B>* out) {
+    constexpr bool narrow = sizeof(A) == 4;
+    constexpr std::size_t step = 64 / sizeof(pair<A, B>);
+    constexpr unsigned even = narrow ? 0x5555u : 0x55u;
+
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m512i x = _mm512_loadu_si512(in + i);
+        unsigned lanes = (in_range_avx512<A>(x, on_first.lo, on_first.hi) & even) |
+                         (in_range_avx512<B>(x, on_second.lo, on_second.hi) & ~even);
+        unsigned pairs = lanes & (lanes >> 1) & even;
+        // 按 64 位压缩: 8 字节 pair 每个占一个 64 位元素，16 字节 pair 占两个
+        __mmask8 keep = narrow ? static_cast<__mmask8>(_pext_u32(pairs, even)) : static_cast<__mmask8>(pairs | (pairs << 1));
+        _mm512_storeu_si512(out + count, _mm512_maskz_compress_epi64(keep, x));
+        count += static_cast<std::size_t>(_mm_popcnt_u32(keep)) / (narrow ? 1 : 2);
+    }
+    return count + filter_scalar(in + i, n - i, on_first, on_second, out + count);
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+template <typename A, typename B>
+inline const simd::dispatch_table<filter_fn<A, B>>& filter_table() {
+    static const simd::dispatch_table<filter_fn<A, B>> table = MYSTL_DISPATCH_TABLE(
+        (&filter_scalar<A, B>), nullptr, (&filter_avx2<A, B>), (&filter_avx512<A, B>));
+    return table;
+}
+
+} // namespace detail
+
+// 返回写入 out 的元素个数；out 须能容纳 n 个元素
+template <typename A, typename B>
+inline std::size_t filter_pairs(const pair<A, B>* in, std::size_t n, const member_range<A>& on_first,
+                                const member_range<B>& on_second, pair<A, B>* out) {
+    if constexpr (detail::is_simd_filterable_v<A, B>) {
+        static const auto fn = detail::filter_table<A, B>().resolve();
+        return fn(in, n, on_first, on_second, out);
+    } else if constexpr (detail::is_bitwise_copyable_v<pair<A, B>>) {
+        return detail::filter_scalar(in, n, on_first, on_second, out);
+    } else {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (on_first(in[i].first) && on_second(in[i].second)) out[count++] = in[i];
+        }
+        return count;
+    }
+}
+
+} // namespace my_stl
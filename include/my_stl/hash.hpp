@@ -0,0 +1,45 @@
+/*
+    关键特性说明
+    1. pair 哈希函数对象
+        pair_hash 对 my_stl::pair 与 std::pair 计算相同的 64 位哈希
+        成员先用 std::hash 求值，再用 detail::hash_combine64 组合
+
+    2. 透明查找
+        定义 is_transparent，允许在异构容器中用 std::pair 查找 my_stl::pair 键
+
+    3. 与 std::hash<my_stl::pair> 一致
+        std::hash<my_stl::pair<T1, T2>> 返回 pair_hash 结果截断到 size_t
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "detail/hash.hpp"
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace my_stl {
+
+struct pair_hash {
+    using is_transparent = void;
+
+    template <typename T1, typename T2>
+    std::uint64_t operator()(const pair<T1, T2>& p) const {
+        return combine(p.first, p.second);
+    }
+
+    template <typename T1, typename T2>
+    std::uint64_t operator()(const std::pair<T1, T2>& p) const {
+        return combine(p.first, p.second);
+    }
+
+private:
+    template <typename T1, typename T2>
+    static std::uint64_t combine(const T1& a, const T2& b) {
+        return detail::hash_combine64(static_cast<std::uint64_t>(std::hash<T1>{}(a)),
+                                      static_cast<std::uint64_t>(std::hash<T2>{}(b)));
+    }
+};
+
+} // namespace my_stl
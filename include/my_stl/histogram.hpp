@@ -0,0 +1,237 @@
+/*
+    关键特性说明
+    1. 对数-线性分桶 (HDR)
+        小于 2^S 的值逐一计数；更大的值按最高位分组，每组再线性分成 2^S 个子桶
+        任意值的相对误差不超过 2^-S (默认 S = 7，约 0.8%)，覆盖完整的 uint64_t 范围
+
+    2. 无锁记录
+        计数器为 relaxed 原子变量，多个线程可同时 record 同一个直方图
+        热路径建议每线程一个实例，结束后 merge，避免计数器所在缓存行的争用
+
+    3. 百分位查询
+        value_at_percentile 返回该百分位所在桶的上界 (与 HdrHistogram 一致)，并夹在 [min, max] 内
+        查询可以与记录并发进行，得到的是某一时刻附近的近似快照
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace my_stl {
+
+namespace detail {
+
+// 最高有效位的位置，v 必须非零
+inline unsigned msb64(std::uint64_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(v));
+#else
+    unsigned r = 0;
+    while (v >>= 1) ++r;
+    return r;
+#endif
+}
+
+} // namespace detail
+
+// ============================================================================
+// basic_histogram: 高动态范围延迟直方图
+// ============================================================================
+
+template <unsigned SubBucketBits = 7>
+class basic_histogram {
+    static_assert(SubBucketBits >= 1 && SubBucketBits <= 16, "SubBucketBits must be in [1, 16]");
+
+public:
+    static constexpr unsigned sub_bucket_bits = SubBucketBits;
+    static constexpr std::size_t sub_bucket_count = std::size_t(1) << SubBucketBits;
+    // [0, 2^S) 线性区，之后每个最高位 k ∈ [S, 63] 一组
+    static constexpr std::size_t bucket_count = (65 - SubBucketBits) * sub_bucket_count;
+
+    basic_histogram() : counts_(new std::atomic<std::uint64_t>[bucket_count]) { reset(); }
+
+    // 计数器在堆上，移动后源对象不可再使用
+    basic_histogram(basic_histogram&& other) noexcept : counts_(std::move(other.counts_)) {
+        take_summary(other);
+    }
+    basic_histogram& operator=(basic_histogram&& other) noexcept {
+        counts_ = std::move(other.counts_);
+        take_summary(other);
+        return *this;
+    }
+    basic_histogram(const basic_histogram&) = delete;
+    basic_histogram& operator=(const basic_histogram&) = delete;
+
+    // ========================================================================
+    // 分桶
+    // ========================================================================
+
+    static std::size_t bucket_index(std::uint64_t v) noexcept {
+        if (v < sub_bucket_count) return static_cast<std::size_t>(v);
+        unsigned k = detail::msb64(v);
+        unsigned shift = k - SubBucketBits;
+        // v >> shift 落在 [2^S, 2^(S+1))，低 S 位即子桶号
+        return (shift + 1) * sub_bucket_count + static_cast<std::size_t>((v >> shift) - sub_bucket_count);
+    }
+
+    static std::uint64_t bucket_lowest(std::size_t index) noexcept {
+        if (index < sub_bucket_count) return index;
+        std::size_t group = index / sub_bucket_count;
+        std::uint64_t sub = index % sub_bucket_count;
+        return (sub_bucket_count + sub) << (group - 1);
+    }
+
+    static std::uint64_t bucket_highest(std::size_t index) noexcept {
+        if (index < sub_bucket_count) return index;
+        std::size_t group = index / sub_bucket_count;
+        return bucket_lowest(index) + ((std::uint64_t(1) << (group - 1)) - 1);
+    }
+
+    // ========================================================================
+    // 记录
+    // ========================================================================
+
+    void record(std::uint64_t value, std::uint64_t n = 1) noexcept {
+        counts_[bucket_index(value)].fetch_add(n, std::memory_order_relaxed);
+        total_.fetch_add(n, std::memory_order_relaxed);
+        sum_.fetch_add(value * n, std::memory_order_relaxed);
+        update_min(value);
+        update_max(value);
+    }
+
+    // 将 other 的全部样本并入本直方图
+    template <unsigned OtherBits>
+    void merge(const basic_histogram<OtherBits>& other) noexcept {
+        if constexpr (OtherBits == SubBucketBits) {
+            for (std::size_t i = 0; i < bucket_count; ++i) {
+                auto c = other.count_at(i);
+                if (c) counts_[i].fetch_add(c, std::memory_order_relaxed);
+            }
+        } else {
+            // 精度不同时按对方桶的下界重新分桶
+            other.for_each_bucket([this](std::uint64_t low, std::uint64_t, std::uint64_t c) {
+                counts_[bucket_index(low)].fetch_add(c, std::memory_order_relaxed);
+            });
+        }
+        total_.fetch_add(other.count(), std::memory_order_relaxed);
+        sum_.fetch_add(other.sum(), std::memory_order_relaxed);
+        if (other.count()) {
+            update_min(other.min());
+            update_max(other.max());
+        }
+    }
+
+    void reset() noexcept {
+        for (std::size_t i = 0; i < bucket_count; ++i) counts_[i].store(0, std::memory_order_relaxed);
+        total_.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+        min_.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    // ========================================================================
+    // 查询
+    // ========================================================================
+
+    std::uint64_t count() const noexcept { return total_.load(std::memory_order_relaxed); }
+    std::uint64_t sum() const noexcept { return sum_.load(std::memory_order_relaxed); }
+    std::uint64_t count_at(std::size_t index) const noexcept {
+        return counts_[index].load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t min() const noexcept { return count() ? min_.load(std::memory_order_relaxed) : 0; }
+    std::uint64_t max() const noexcept { return max_.load(std::memory_order_relaxed); }
+
+    double mean() const noexcept {
+        auto n = count();
+        return n ? static_cast<double>(sum()) / static_cast<double>(n) : 0.0;
+    }
+
+    // percentile ∈ [0, 100]
+    std::uint64_t value_at_percentile(double percentile) const noexcept {
+        // 以桶计数之和为准，避免与并发的 record 之间 total_ 不一致
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < bucket_count; ++i) total += count_at(i);
+        if (total == 0) return 0;
+
+        percentile = std::clamp(percentile, 0.0, 100.0);
+        auto target = static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(total) + 0.5);
+        target = std::clamp<std::uint64_t>(target, 1, total);
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            seen += count_at(i);
+            if (seen >= target) {
+                return std::clamp(bucket_highest(i), min(), std::max(min(), max()));
+            }
+        }
+        return max();
+    }
+
+    // f(lowest, highest, count)，只访问非空桶
+    template <typename F>
+    void for_each_bucket(F&& f) const {
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            auto c = count_at(i);
+            if (c) f(bucket_lowest(i), bucket_highest(i), c);
+        }
+    }
+
+private:
+    void take_summary(const basic_histogram& other) noexcept {
+        total_.store(other.total_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        sum_.store(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        min_.store(other.min_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        max_.store(other.max_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    void update_min(std::uint64_t v) noexcept {
+        auto cur = min_.load(std::memory_order_relaxed);
+        while (v < cur && !min_.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {
+        }
+    }
+
+    void update_max(std::uint64_t v) noexcept {
+        auto cur = max_.load(std::memory_order_relaxed);
+        while (v > cur && !max_.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::unique_ptr<std::atomic<std::uint64_t>[]> counts_;
+    std::atomic<std::uint64_t> total_{0};
+    std::atomic<std::uint64_t> sum_{0};
+    std::atomic<std::uint64_t> min_{std::numeric_limits<std::uint64_t>::max()};
+    std::atomic<std::uint64_t> max_{0};
+};
+
+using latency_histogram = basic_histogram<>;
+
+// ============================================================================
+// scoped_latency: 作用域结束时把耗时(纳秒)记入直方图
+// ============================================================================
+
+template <typename Histogram = latency_histogram>
+class scoped_latency {
+public:
+    explicit scoped_latency(Histogram& h) noexcept : hist_(h), start_(std::chrono::steady_clock::now()) {}
+    ~scoped_latency() {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+        hist_.record(static_cast<std::uint64_t>(ns.count()));
+    }
+
+    scoped_latency(const scoped_latency&) = delete;
+    scoped_latency& operator=(const scoped_latency&) = delete;
+
+private:
+    Histogram& hist_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace my_stl
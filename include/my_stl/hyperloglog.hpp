@@ -0,0 +1,362 @@
+/*
+    关键特性说明
+    1. hyperloglog<K1, K2>
+        HyperLogLog++ 基数估计：键 pair<K1, K2> 由 pair_hash 求 64 位哈希 (与种子混合)，
+        精度 p ∈ [4, 18] 时有 m = 2^p 个 8 位寄存器，前 p 位选寄存器，其余位的前导零个数 + 1 取最大值；
+        标准误差约 1.04 / √m，p = 14 时约 0.8%，稠密表示占 16 KiB
+
+    2. 稀疏表示
+        基数较小时不分配寄存器，只存排好序的 32 位条目 (25 位稀疏下标, 6 位秩)，
+        新条目先追加到未排序的缓冲区，攒够一批后排序并归并；估计时对 2^25 个稀疏桶做线性计数，
+        小基数几乎没有误差；有序条目与缓冲区超过 m 字节时转为稠密表示，稀疏时最多占用约 1.25 m 字节，
+        大量小窗口 (如几百个时间窗口各自计数) 的内存远小于每个窗口都分配寄存器
+
+    3. 估计
+        稠密表示用 Ertl 改进的原始估计 (寄存器值直方图的闭式修正)，在整个基数范围内无偏，
+        代替 HLL++ 论文中的经验偏差修正表和线性计数的切换阈值
+
+    4. SIMD 合并
+        merge 逐寄存器取最大值，寄存器数组按 64 字节对齐，SSE4.2 / AVX2 / AVX-512 内核一次处理
+        16 / 32 / 64 个寄存器，运行时按 cpu_dispatch.hpp 选择；
+        稀疏与稀疏合并时归并条目，稀疏并入稠密时逐条目更新寄存器；
+        两个估计器的精度和种子必须相同
+
+    5. 批量添加
+        add_batch 先批量求哈希，稠密时预取后面第 hll_prefetch_distance 个键的寄存器
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "hash.hpp"
+#include "cpu_dispatch.hpp"
+#include "detail/aligned_allocator.hpp"
+#include "detail/hash.hpp"
+#include "detail/prefetch.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace my_stl {
+
+namespace detail {
+
+inline constexpr unsigned hll_min_precision = 4;
+inline constexpr unsigned hll_max_precision = 18;
+// 稀疏条目的下标位数
+inline constexpr unsigned hll_sparse_precision = 25;
+inline constexpr std::size_t hll_prefetch_distance = 8;
+// add_batch 每次在栈上求哈希的键数
+inline constexpr std::size_t hll_batch = 256;
+
+// v 为 0 时返回 64
+inline unsigned hll_leading_zeros(std::uint64_t v) noexcept {
+    if (v == 0) return 64;
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_clzll(v));
+#else
+    unsigned n = 0;
+    for (std::uint64_t bit = std::uint64_t(1) << 63; !(v & bit); bit >>= 1) ++n;
+    return n;
+#endif
+}
+
+// 稀疏条目：高 25 位下标左移 6 位，低 6 位为其余 39 位的秩 (1..40)；
+// 按整数排序即按下标排序，同一下标秩大的在后
+inline std::uint32_t hll_sparse_encode(std::uint64_t h) noexcept {
+    constexpr unsigned rest = 64 - hll_sparse_precision;
+    const auto index = static_cast<std::uint32_t>(h >> rest);
+    const unsigned rank = std::min(hll_leading_zeros(h << hll_sparse_precision), rest) + 1;
+    return (index << 6) | rank;
+}
+
+inline std::uint32_t hll_sparse_index(std::uint32_t e) noexcept { return e >> 6; }
+
+// 稀疏条目对应的稠密寄存器与秩：下标中 p 之后的位非零时秩由这些位决定，否则再加上条目中的秩
+inline void hll_sparse_to_dense(std::uint32_t e, unsigned p, std::uint32_t& index, std::uint8_t& rank) noexcept {
+    const unsigned extra = hll_sparse_precision - p;
+    const std::uint32_t sparse_index = hll_sparse_index(e);
+    index = sparse_index >> extra;
+    const std::uint32_t bits = sparse_index & ((std::uint32_t(1) << extra) - 1);
+    if (bits != 0) {
+        rank = static_cast<std::uint8_t>(hll_leading_zeros(static_cast<std::uint64_t>(bits) << (64 - extra)) + 1);
+    } else {
+        rank = static_cast<std::uint8_t>(extra + (e & 63));
+    }
+}
+
+using hll_merge_fn = void (*)(std::uint8_t* dst, const std::uint8_t* src, std::size_t n);
+
+// ==================== 标量内核 ====================
+
+inline void hll_merge_scalar(std::uint8_t* dst, const std::uint8_t* src, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) dst[i] = std::max(dst[i], src[i]);
+}
+
+#if MYSTL_X86_DISPATCH
+
+// ==================== SSE4.2 内核 ====================
+
+MYSTL_TARGET_SSE42 inline void hll_merge_sse42(std::uint8_t* dst, const std::uint8_t* src, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_max_epu8(a, b));
+    }
+    hll_merge_scalar(dst + i, src + i, n - i);
+}
+
+// ==================== AVX2 内核 ====================
+
+MYSTL_TARGET_AVX2 inline void hll_merge_avx2(std::uint8_t* dst, const std::uint8_t* src, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_max_epu8(a, b));
+    }
+    hll_merge_scalar(dst + i, src + i, n - i);
+}
+
+// ==================== AVX-512 内核 ====================
+
+MYSTL_TARGET_AVX512 inline void hll_merge_avx512(std::uint8_t* dst, const std::uint8_t* src, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        const __m512i a = _mm512_loadu_si512(dst + i);
+        const __m512i b = _mm512_loadu_si512(src + i);
+        _mm512_storeu_si512(dst + i, _mm512_max_epu8(a, b));
+    }
+    if (i < n) {
+        const __mmask64 tail = _bzhi_u64(~std::uint64_t(0), static_cast<unsigned>(n - i));
+        const __m512i a = _mm512_maskz_loadu_epi8(tail, dst + i);
+        const __m512i b = _mm512_maskz_loadu_epi8(tail, src + i);
+        _mm512_mask_storeu_epi8(dst + i, tail, _mm512_max_epu8(a, b));
+    }
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+inline const simd::dispatch_table<hll_merge_fn>& hll_merge_table() {
+    static const simd::dispatch_table<hll_merge_fn> table =
+        MYSTL_DISPATCH_TABLE(&hll_merge_scalar, &hll_merge_sse42, &hll_merge_avx2, &hll_merge_avx512);
+    return table;
+}
+
+// Ertl, "New cardinality estimation algorithms for HyperLogLog sketches" (2017) 中的 σ 与 τ
+inline double hll_sigma(double x) noexcept {
+    if (x == 1.0) return std::numeric_limits<double>::infinity();
+    double y = 1.0, z = x, prev;
+    do {
+        x *= x;
+        prev = z;
+        z += x * y;
+        y += y;
+    } while (z != prev);
+    return z;
+}
+
+inline double hll_tau(double x) noexcept {
+    if (x == 0.0 || x == 1.0) return 0.0;
+    double y = 1.0, z = 1.0 - x, prev;
+    do {
+        x = std::sqrt(x);
+        prev = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != prev);
+    return z / 3.0;
+}
+
+// counts[k] 为值等于 k 的寄存器个数，k ∈ [0, q + 1]，q = 64 - p
+inline double hll_estimate_dense(const std::uint32_t* counts, unsigned p) noexcept {
+    const unsigned q = 64 - p;
+    const double m = static_cast<double>(std::uint64_t(1) << p);
+    double z = m * hll_tau(1.0 - counts[q + 1] / m);
+    for (unsigned k = q; k >= 1; --k) z = 0.5 * (z + counts[k]);
+    z += m * hll_sigma(counts[0] / m);
+    return m * m / (2.0 * std::log(2.0) * z);
+}
+
+} // namespace detail
+
+// ============================================================================
+// hyperloglog
+// ============================================================================
+
+template <typename K1, typename K2, typename Hash = pair_hash>
+class hyperloglog {
+public:
+    using key_type = pair<K1, K2>;
+
+    explicit hyperloglog(unsigned precision = 14, std::uint64_t seed = 0) : precision_(precision), seed_(seed) {
+        assert(precision >= detail::hll_min_precision && precision <= detail::hll_max_precision);
+    }
+
+    void add(const key_type& key) {
+        const std::uint64_t h = hash_of(key);
+        add_hashes(&h, 1);
+    }
+
+    void add_batch(const key_type* keys, std::size_t n) {
+        std::uint64_t hashes[detail::hll_batch];
+        for (std::size_t i = 0; i < n; i += detail::hll_batch) {
+            const std::size_t m = std::min(detail::hll_batch, n - i);
+            for (std::size_t k = 0; k < m; ++k) hashes[k] = hash_of(keys[i + k]);
+            add_hashes(hashes, m);
+        }
+    }
+
+    void add_batch(const std::vector<key_type>& keys) { add_batch(keys.data(), keys.size()); }
+
+    double estimate() const {
+        if (dense_) {
+            std::uint32_t counts[64 - detail::hll_min_precision + 2] = {};
+            for (std::uint8_t r : registers_) ++counts[r];
+            return detail::hll_estimate_dense(counts, precision_);
+        }
+        // 稀疏表示：对 2^25 个稀疏桶做线性计数
+        std::vector<std::uint32_t> pending(pending_);
+        std::sort(pending.begin(), pending.end());
+        std::size_t occupied = sparse_.size();
+        auto it = sparse_.begin();
+        for (std::size_t i = 0; i < pending.size(); ++i) {
+            const std::uint32_t index = detail::hll_sparse_index(pending[i]);
+            if (i > 0 && detail::hll_sparse_index(pending[i - 1]) == index) continue;
+            it = std::lower_bound(it, sparse_.end(), index << 6);
+            if (it == sparse_.end() || detail::hll_sparse_index(*it) != index) ++occupied;
+        }
+        const double buckets = static_cast<double>(std::uint64_t(1) << detail::hll_sparse_precision);
+        return buckets * std::log(buckets / (buckets - static_cast<double>(occupied)));
+    }
+
+    // 并集的估计器，两边的精度和种子必须相同
+    void merge(const hyperloglog& other) {
+        assert(precision_ == other.precision_ && seed_ == other.seed_);
+        if (&other == this) return;
+        if (other.dense_) {
+            to_dense();
+            merge_fn()(registers_.data(), other.registers_.data(), registers_.size());
+        } else if (dense_) {
+            for (std::uint32_t e : other.sparse_) update_sparse_entry(e);
+            for (std::uint32_t e : other.pending_) update_sparse_entry(e);
+        } else {
+            std::vector<std::uint32_t> incoming(other.pending_);
+            std::sort(incoming.begin(), incoming.end());
+            absorb(other.sparse_.data(), other.sparse_.size());
+            if (dense_) {
+                for (std::uint32_t e : incoming) update_sparse_entry(e);
+            } else {
+                absorb(incoming.data(), incoming.size());
+            }
+        }
+    }
+
+    void clear() {
+        std::vector<std::uint32_t>().swap(sparse_);
+        std::vector<std::uint32_t>().swap(pending_);
+        decltype(registers_)().swap(registers_);
+        dense_ = false;
+    }
+
+    unsigned precision() const noexcept { return precision_; }
+    bool is_sparse() const noexcept { return !dense_; }
+    // 稠密表示的标准误差
+    double standard_error() const noexcept { return 1.04 / std::sqrt(static_cast<double>(register_count())); }
+
+    std::size_t memory_usage() const noexcept {
+        return (sparse_.capacity() + pending_.capacity()) * sizeof(std::uint32_t) + registers_.capacity();
+    }
+
+private:
+    static detail::hll_merge_fn merge_fn() {
+        static const detail::hll_merge_fn fn = detail::hll_merge_table().resolve();
+        return fn;
+    }
+
+    std::uint64_t hash_of(const key_type& key) const {
+        return detail::hash_mix64(static_cast<std::uint64_t>(Hash{}(key)) ^ seed_);
+    }
+
+    std::size_t register_count() const noexcept { return std::size_t(1) << precision_; }
+
+    // 缓冲区占 m / 4 字节；有序条目与缓冲区合计超过 m 字节时转为稠密
+    std::size_t pending_limit() const noexcept { return register_count() / 16; }
+    std::size_t sparse_limit() const noexcept { return register_count() / 4 - pending_limit(); }
+
+    void add_hashes(const std::uint64_t* hashes, std::size_t n) {
+        std::size_t k = 0;
+        if (!dense_ && pending_.capacity() == 0) pending_.reserve(pending_limit());
+        for (; k < n && !dense_; ++k) {
+            pending_.push_back(detail::hll_sparse_encode(hashes[k]));
+            if (pending_.size() >= pending_limit()) flush();
+        }
+        const unsigned shift = 64 - precision_;
+        for (; k < n; ++k) {
+            if (k + detail::hll_prefetch_distance < n) {
+                detail::prefetch_write(registers_.data() + (hashes[k + detail::hll_prefetch_distance] >> shift));
+            }
+            const std::uint64_t h = hashes[k];
+            const auto rank = static_cast<std::uint8_t>(
+                std::min(detail::hll_leading_zeros(h << precision_), shift) + 1);
+            std::uint8_t& r = registers_[h >> shift];
+            r = std::max(r, rank);
+        }
+    }
+
+    void update_sparse_entry(std::uint32_t e) noexcept {
+        std::uint32_t index;
+        std::uint8_t rank;
+        detail::hll_sparse_to_dense(e, precision_, index, rank);
+        registers_[index] = std::max(registers_[index], rank);
+    }
+
+    void flush() {
+        std::sort(pending_.begin(), pending_.end());
+        absorb(pending_.data(), pending_.size());
+        pending_.clear();
+    }
+
+    // 把有序条目归并到 sparse_，同一稀疏下标只保留最大的秩
+    void absorb(const std::uint32_t* entries, std::size_t n) {
+        std::vector<std::uint32_t> merged;
+        merged.reserve(sparse_.size() + n);
+        std::merge(sparse_.begin(), sparse_.end(), entries, entries + n, std::back_inserter(merged));
+        std::size_t out = 0;
+        for (std::size_t i = 0; i < merged.size(); ++i) {
+            if (i + 1 < merged.size() &&
+                detail::hll_sparse_index(merged[i + 1]) == detail::hll_sparse_index(merged[i])) {
+                continue;
+            }
+            merged[out++] = merged[i];
+        }
+        merged.resize(out);
+        sparse_.swap(merged);
+        if (sparse_.size() > sparse_limit()) to_dense();
+    }
+
+    void to_dense() {
+        if (dense_) return;
+        registers_.assign(register_count(), 0);
+        dense_ = true;
+        for (std::uint32_t e : sparse_) update_sparse_entry(e);
+        for (std::uint32_t e : pending_) update_sparse_entry(e);
+        std::vector<std::uint32_t>().swap(sparse_);
+        std::vector<std::uint32_t>().swap(pending_);
+    }
+
+    unsigned precision_;
+    std::uint64_t seed_;
+    bool dense_ = false;
+    std::vector<std::uint32_t> sparse_;    // 按稀疏下标排序且下标唯一的条目
+    std::vector<std::uint32_t> pending_;   // 尚未归并的新条目
+    std::vector<std::uint8_t, detail::aligned_allocator<std::uint8_t, 64>> registers_;
+};
+
+} // namespace my_stl
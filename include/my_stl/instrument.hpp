@@ -0,0 +1,247 @@
+/*
+    关键特性说明
+    1. 按需启用
+        只有在定义 MYSTL_INSTRUMENT 时 pair.hpp 才会插入计数钩子
+        未启用时钩子宏展开为空，pair 的特殊成员保持 = default（平凡性不变）
+        启用时钩子在常量求值中跳过 (std::is_constant_evaluated 或 GCC/Clang 的
+        __builtin_is_constant_evaluated)，pair 的构造仍可用于常量表达式；
+        两者都不可用的编译器上，插桩模式下的拷贝/移动/转换构造不能用于常量表达式
+
+    2. 按实例化类型统计
+        每个 pair<T1, T2> 实例化拥有一组独立计数器
+        统计拷贝构造、移动构造、拷贝赋值、移动赋值以及跨类型转换(拷贝/移动)
+
+    3. 线程安全
+        计数器使用 relaxed 原子操作，注册表使用互斥锁保护
+        热路径上只有一次原子加法
+
+    4. 报告接口
+        snapshot() 返回计数快照，report() 以表格形式输出
+        reset() 清零所有计数，便于分段测量
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+#include "detail/type_name.hpp"
+
+namespace my_stl::instrument {
+
+// ============================================================================
+// 操作类型
+// ============================================================================
+
+enum class op : std::size_t {
+    copy_construct,
+    move_construct,
+    copy_assign,
+    move_assign,
+    convert_copy,   // 从其他 pair / std::pair 拷贝构造或赋值，以及转换为 std::pair
+    convert_move,   // 同上，但成员按移动处理
+    count_
+};
+
+inline constexpr std::size_t op_count = static_cast<std::size_t>(op::count_);
+
+inline const char* op_name(op o) noexcept {
+    switch (o) {
+        case op::copy_construct: return "copy_ctor";
+        case op::move_construct: return "move_ctor";
+        case op::copy_assign:    return "copy_assign";
+        case op::move_assign:    return "move_assign";
+        case op::convert_copy:   return "convert_copy";
+        case op::convert_move:   return "convert_move";
+        default:                 return "?";
+    }
+}
+
+// 某个实例化类型的计数快照
+struct entry {
+    std::string type_name;
+    std::uint64_t counts[op_count] = {};
+
+    std::uint64_t operator[](op o) const noexcept {
+        return counts[static_cast<std::size_t>(o)];
+    }
+
+    std::uint64_t total() const noexcept {
+        std::uint64_t sum = 0;
+        for (auto c : counts) sum += c;
+        return sum;
+    }
+};
+
+namespace detail {
+
+// ============================================================================
+// 计数器注册表
+// ============================================================================
+
+struct type_counters;
+
+class registry {
+public:
+    static registry& instance() {
+        static registry r;
+        return r;
+    }
+
+    void add(type_counters* c) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        list_.push_back(c);
+    }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto* c : list_) fn(*c);
+    }
+
+private:
+    registry() = default;
+
+    std::mutex mutex_;
+    std::vector<type_counters*> list_;
+};
+
+struct type_counters {
+    const std::type_info& type;
+    std::atomic<std::uint64_t> counts[op_count];
+
+    explicit type_counters(const std::type_info& t) : type(t), counts{} {
+        registry::instance().add(this);
+    }
+};
+
+// 每个类型一组计数器，首次使用时注册
+template <typename P>
+type_counters& counters_for() noexcept {
+    static type_counters counters(typeid(P));
+    return counters;
+}
+
+template <typename P>
+inline void record(op o) noexcept {
+    counters_for<P>().counts[static_cast<std::size_t>(o)].fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+// ============================================================================
+// 报告接口
+// ============================================================================
+
+// 是否在当前编译单元中启用了插桩（内部链接，各编译单元可以不同）
+constexpr bool enabled =
+#ifdef MYSTL_INSTRUMENT
+    true;
+#else
+    false;
+#endif
+
+// 返回所有已注册类型的计数快照，按总次数降序排列
+inline std::vector<entry> snapshot() {
+    std::vector<entry> result;
+    detail::registry::instance().for_each([&](detail::type_counters& c) {
+        entry e;
+        e.type_name = my_stl::detail::demangle(c.type.name());
+        for (std::size_t i = 0; i < op_count; ++i) {
+            e.counts[i] = c.counts[i].load(std::memory_order_relaxed);
+        }
+        result.push_back(std::move(e));
+    });
+    std::stable_sort(result.begin(), result.end(), [](const entry& a, const entry& b) {
+        return a.total() > b.total();
+    });
+    return result;
+}
+
+// 返回某个类型的计数快照
+template <typename P>
+entry snapshot_of() {
+    entry e;
+    e.type_name = my_stl::detail::type_name<P>();
+    auto& c = detail::counters_for<P>();
+    for (std::size_t i = 0; i < op_count; ++i) {
+        e.counts[i] = c.counts[i].load(std::memory_order_relaxed);
+    }
+    return e;
+}
+
+// 清零所有计数器
+inline void reset() {
+    detail::registry::instance().for_each([](detail::type_counters& c) {
+        for (auto& v : c.counts) v.store(0, std::memory_order_relaxed);
+    });
+}
+
+// 以表格形式输出计数（省略全部为零的类型）
+inline void report(std::ostream& os) {
+    auto entries = snapshot();
+    if (entries.empty()) {
+        os << "no instrumented pair operations recorded (compile with -DMYSTL_INSTRUMENT)\n";
+        return;
+    }
+
+    os << std::left << std::setw(48) << "type";
+    for (std::size_t i = 0; i < op_count; ++i) {
+        os << std::right << std::setw(14) << op_name(static_cast<op>(i));
+    }
+    os << '\n';
+
+    for (const auto& e : entries) {
+        if (e.total() == 0) continue;
+        os << std::left << std::setw(48) << e.type_name;
+        for (std::size_t i = 0; i < op_count; ++i) {
+            os << std::right << std::setw(14) << e.counts[i];
+        }
+        os << '\n';
+    }
+}
+
+} // namespace my_stl::instrument
+
+// ============================================================================
+// pair.hpp 使用的钩子宏
+// ============================================================================
+
+// 常量求值中不能调用 record，钩子用它跳过计数
+#if defined(__cpp_lib_is_constant_evaluated)
+#define MYSTL_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define MYSTL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+// 能否区分常量求值，决定插桩模式下的拷贝/移动构造能否为 constexpr
+#ifdef MYSTL_IS_CONSTANT_EVALUATED
+#define MYSTL_INSTRUMENT_CONSTEXPR_HOOKS 1
+#define MYSTL_INSTRUMENT_CONSTEXPR constexpr
+#else
+#define MYSTL_INSTRUMENT_CONSTEXPR_HOOKS 0
+#define MYSTL_IS_CONSTANT_EVALUATED() false
+#define MYSTL_INSTRUMENT_CONSTEXPR
+#endif
+
+#ifndef MYSTL_INSTRUMENT_RECORD
+#ifdef MYSTL_INSTRUMENT
+#define MYSTL_INSTRUMENT_RECORD(kind)                                                   \
+    do {                                                                                \
+        if (!MYSTL_IS_CONSTANT_EVALUATED())                                             \
+            ::my_stl::instrument::detail::record<pair>(::my_stl::instrument::op::kind); \
+    } while (0)
+#else
+#define MYSTL_INSTRUMENT_RECORD(kind) ((void)0)
+#endif
+#endif
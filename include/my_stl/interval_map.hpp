@@ -0,0 +1,461 @@
+/*
+    关键特性说明
+    1. 区间容器
+        每个元素是一个半开区间 pair<T, T>{begin, end} 及其映射值，要求 begin < end；
+        允许重叠和重复的区间 (multimap 语义)
+        查询:  for_each_overlap(lo, hi, fn)  与 [lo, hi) 相交的区间: begin < hi && lo < end
+              for_each_stab(p, fn)          包含点 p 的区间: begin <= p && p < end
+              overlaps / contains / count_overlap 为上述查询的存在性与计数版本
+        fn(range, value) 返回 void；返回 bool 时返回 false 可提前结束遍历
+
+    2. interval_map: 动态版本
+        按 (begin, end) 排序的 treap，每个节点增强记录子树中最大的 end，
+        查询时跳过 max_end <= lo 的子树，复杂度 O(log n + 命中数)；
+        节点存放在连续的 vector 中，用 32 位下标互相引用，映射值另存一个数组，
+        遍历时只触及紧凑的节点数据；删除的节点进入空闲链表复用
+
+    3. static_interval_map: 一次构建的静态版本
+        区间按 begin 排序后存入连续数组，数组本身就是一棵隐式平衡二叉树 (cgranges 布局):
+        第 k 层节点的下标低 k 位全为 1，每个节点记录其子树的最大 end；
+        没有指针，查询用一个小栈自顶向下遍历，深度不超过 3 的子树直接线性扫描
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace my_stl {
+
+namespace detail {
+
+inline constexpr std::uint32_t interval_nil = 0xFFFFFFFFu;
+
+// 让返回 void 的回调也能用于可提前结束的遍历
+template <typename Fn, typename... Args>
+inline bool invoke_continue(Fn& fn, Args&&... args) {
+    if constexpr (std::is_same_v<std::invoke_result_t<Fn&, Args...>, void>) {
+        fn(std::forward<Args>(args)...);
+        return true;
+    } else {
+        return static_cast<bool>(fn(std::forward<Args>(args)...));
+    }
+}
+
+// 查询条件: 区间的 end 必须大于 lo，begin 由 before 判断；右侧的 begin 只会更大
+template <typename T>
+struct overlap_query {
+    T lo;
+    T hi;
+    bool before(const T& begin) const { return begin < hi; }
+};
+
+template <typename T>
+struct stab_query {
+    T lo;   // 查询点
+    bool before(const T& begin) const { return !(lo < begin); }
+};
+
+} // namespace detail
+
+template <typename T, typename V>
+class static_interval_map;
+
+// ============================================================================
+// interval_map: 增强 treap
+// ============================================================================
+
+template <typename T, typename V>
+class interval_map {
+public:
+    using range_type = pair<T, T>;
+    using mapped_type = V;
+    using value_type = pair<range_type, V>;
+    using size_type = std::size_t;
+
+    interval_map() = default;
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    void clear() noexcept {
+        nodes_.clear();
+        values_.clear();
+        free_ = detail::interval_nil;
+        root_ = detail::interval_nil;
+        size_ = 0;
+    }
+
+    void insert(const range_type& range, V value) {
+        assert(range.first < range.second);
+        std::uint32_t id = allocate(range, std::move(value));
+        std::uint32_t left, right;
+        split(root_, range, left, right);
+        root_ = merge(merge(left, id), right);
+        ++size_;
+    }
+
+    void insert(const value_type& entry) { insert(entry.first, entry.second); }
+
+    // 删除一个与 range 相同的区间，返回是否找到
+    bool erase(const range_type& range) {
+        bool erased = false;
+        root_ = erase_node(root_, range, erased);
+        if (erased) --size_;
+        return erased;
+    }
+
+    template <typename Fn>
+    void for_each_overlap(const T& lo, const T& hi, Fn&& fn) const {
+        visit_query(detail::overlap_query<T>{lo, hi}, fn);
+    }
+
+    template <typename Fn>
+    void for_each_stab(const T& point, Fn&& fn) const {
+        visit_query(detail::stab_query<T>{point}, fn);
+    }
+
+    bool overlaps(const T& lo, const T& hi) const {
+        bool found = false;
+        for_each_overlap(lo, hi, [&](const range_type&, const V&) {
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+    // 是否有区间包含 point
+    bool contains(const T& point) const {
+        bool found = false;
+        for_each_stab(point, [&](const range_type&, const V&) {
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+    size_type count_overlap(const T& lo, const T& hi) const {
+        size_type count = 0;
+        for_each_overlap(lo, hi, [&](const range_type&, const V&) { ++count; });
+        return count;
+    }
+
+    // 按 (begin, end) 升序遍历所有元素
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        in_order(root_, fn);
+    }
+
+    // 转换为静态版本
+    static_interval_map<T, V> freeze() const;
+
+private:
+    struct node {
+        range_type range;
+        T max_end;
+        std::uint32_t left;
+        std::uint32_t right;
+        std::uint32_t priority;
+    };
+
+    std::uint32_t allocate(const range_type& range, V&& value) {
+        std::uint32_t prio = next_priority();
+        if (free_ != detail::interval_nil) {
+            std::uint32_t id = free_;
+            free_ = nodes_[id].left;
+            nodes_[id] = node{range, range.second, detail::interval_nil, detail::interval_nil, prio};
+            values_[id] = std::move(value);
+            return id;
+        }
+        assert(nodes_.size() < detail::interval_nil);
+        nodes_.push_back(node{range, range.second, detail::interval_nil, detail::interval_nil, prio});
+        values_.push_back(std::move(value));
+        return static_cast<std::uint32_t>(nodes_.size() - 1);
+    }
+
+    void release(std::uint32_t id) {
+        nodes_[id].left = free_;
+        free_ = id;
+    }
+
+    std::uint32_t next_priority() noexcept {
+        // xorshift32
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 17;
+        seed_ ^= seed_ << 5;
+        return seed_;
+    }
+
+    void pull(std::uint32_t t) {
+        node& x = nodes_[t];
+        T m = x.range.second;
+        if (x.left != detail::interval_nil && m < nodes_[x.left].max_end) m = nodes_[x.left].max_end;
+        if (x.right != detail::interval_nil && m < nodes_[x.right].max_end) m = nodes_[x.right].max_end;
+        x.max_end = m;
+    }
+
+    // left 中的区间 < key，right 中的区间 >= key
+    void split(std::uint32_t t, const range_type& key, std::uint32_t& left, std::uint32_t& right) {
+        if (t == detail::interval_nil) {
+            left = right = detail::interval_nil;
+            return;
+        }
+        if (nodes_[t].range < key) {
+            split(nodes_[t].right, key, nodes_[t].right, right);
+            left = t;
+        } else {
+            split(nodes_[t].left, key, left, nodes_[t].left);
+            right = t;
+        }
+        pull(t);
+    }
+
+    // a 中的区间都不大于 b 中的区间
+    std::uint32_t merge(std::uint32_t a, std::uint32_t b) {
+        if (a == detail::interval_nil) return b;
+        if (b == detail::interval_nil) return a;
+        if (nodes_[a].priority > nodes_[b].priority) {
+            nodes_[a].right = merge(nodes_[a].right, b);
+            pull(a);
+            return a;
+        }
+        nodes_[b].left = merge(a, nodes_[b].left);
+        pull(b);
+        return b;
+    }
+
+    std::uint32_t erase_node(std::uint32_t t, const range_type& key, bool& erased) {
+        if (t == detail::interval_nil) return t;
+        if (nodes_[t].range == key) {
+            erased = true;
+            std::uint32_t rest = merge(nodes_[t].left, nodes_[t].right);
+            release(t);
+            return rest;
+        }
+        if (key < nodes_[t].range) {
+            nodes_[t].left = erase_node(nodes_[t].left, key, erased);
+        } else {
+            nodes_[t].right = erase_node(nodes_[t].right, key, erased);
+        }
+        pull(t);
+        return t;
+    }
+
+    template <typename Query, typename Fn>
+    void visit_query(const Query& q, Fn& fn) const {
+        visit(root_, q, fn);
+    }
+
+    // 返回 false 表示回调要求结束遍历
+    template <typename Query, typename Fn>
+    bool visit(std::uint32_t t, const Query& q, Fn& fn) const {
+        while (t != detail::interval_nil) {
+            const node& x = nodes_[t];
+            if (!(q.lo < x.max_end)) return true;
+            if (!visit(x.left, q, fn)) return false;
+            if (!q.before(x.range.first)) return true;
+            if (q.lo < x.range.second && !detail::invoke_continue(fn, x.range, values_[t])) return false;
+            t = x.right;
+        }
+        return true;
+    }
+
+    template <typename Fn>
+    void in_order(std::uint32_t t, Fn& fn) const {
+        while (t != detail::interval_nil) {
+            in_order(nodes_[t].left, fn);
+            fn(nodes_[t].range, values_[t]);
+            t = nodes_[t].right;
+        }
+    }
+
+    std::vector<node> nodes_;
+    std::vector<V> values_;
+    std::uint32_t free_ = detail::interval_nil;   // 空闲链表，经由 left 串联
+    std::uint32_t root_ = detail::interval_nil;
+    std::uint32_t seed_ = 0x9E3779B9u;
+    size_type size_ = 0;
+};
+
+// ============================================================================
+// static_interval_map: 隐式区间树
+// ============================================================================
+
+template <typename T, typename V>
+class static_interval_map {
+public:
+    using range_type = pair<T, T>;
+    using mapped_type = V;
+    using value_type = pair<range_type, V>;
+    using size_type = std::size_t;
+
+    static_interval_map() = default;
+
+    // 从 value_type 序列构建
+    template <typename InputIt>
+    static_interval_map(InputIt first, InputIt last) {
+        std::vector<value_type> entries(first, last);
+        build(entries);
+    }
+
+    explicit static_interval_map(std::vector<value_type> entries) { build(entries); }
+
+    size_type size() const noexcept { return nodes_.size(); }
+    bool empty() const noexcept { return nodes_.empty(); }
+
+    // 按 (begin, end) 排序后的第 i 个元素
+    const range_type& range(size_type i) const { return nodes_[i].range; }
+    const V& value(size_type i) const { return values_[i]; }
+
+    template <typename Fn>
+    void for_each_overlap(const T& lo, const T& hi, Fn&& fn) const {
+        visit(detail::overlap_query<T>{lo, hi}, fn);
+    }
+
+    template <typename Fn>
+    void for_each_stab(const T& point, Fn&& fn) const {
+        visit(detail::stab_query<T>{point}, fn);
+    }
+
+    bool overlaps(const T& lo, const T& hi) const {
+        bool found = false;
+        for_each_overlap(lo, hi, [&](const range_type&, const V&) {
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+    bool contains(const T& point) const {
+        bool found = false;
+        for_each_stab(point, [&](const range_type&, const V&) {
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+    size_type count_overlap(const T& lo, const T& hi) const {
+        size_type count = 0;
+        for_each_overlap(lo, hi, [&](const range_type&, const V&) { ++count; });
+        return count;
+    }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (size_type i = 0; i < nodes_.size(); ++i) fn(nodes_[i].range, values_[i]);
+    }
+
+    size_type memory_usage() const noexcept {
+        return nodes_.capacity() * sizeof(node) + values_.capacity() * sizeof(V);
+    }
+
+private:
+    struct node {
+        range_type range;
+        T max_end;   // 以该节点为根的隐式子树中最大的 end
+    };
+
+    void build(std::vector<value_type>& entries) {
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const value_type& a, const value_type& b) { return a.first < b.first; });
+        nodes_.clear();
+        values_.clear();
+        nodes_.reserve(entries.size());
+        values_.reserve(entries.size());
+        for (auto& e : entries) {
+            assert(e.first.first < e.first.second);
+            nodes_.push_back(node{e.first, e.first.second});
+            values_.push_back(std::move(e.second));
+        }
+        index();
+    }
+
+    // 自底向上计算 max_end；右子节点越界时用当前最后一个节点所在子树的值代替
+    void index() {
+        const size_type n = nodes_.size();
+        root_level_ = 0;
+        if (n == 0) return;
+        size_type last_i = 0;
+        T last = nodes_[0].max_end;
+        for (size_type i = 0; i < n; i += 2) {
+            last_i = i;
+            last = nodes_[i].max_end = nodes_[i].range.second;
+        }
+        unsigned k = 1;
+        for (; (size_type(1) << k) <= n; ++k) {
+            const size_type x = size_type(1) << (k - 1);
+            const size_type i0 = (x << 1) - 1;
+            const size_type step = x << 2;
+            for (size_type i = i0; i < n; i += step) {
+                T e = nodes_[i].range.second;
+                const T& left = nodes_[i - x].max_end;
+                const T& right = i + x < n ? nodes_[i + x].max_end : last;
+                if (e < left) e = left;
+                if (e < right) e = right;
+                nodes_[i].max_end = e;
+            }
+            last_i = (last_i >> k & 1) ? last_i - x : last_i + x;
+            if (last_i < n && last < nodes_[last_i].max_end) last = nodes_[last_i].max_end;
+        }
+        root_level_ = k - 1;
+    }
+
+    template <typename Query, typename Fn>
+    void visit(const Query& q, Fn& fn) const {
+        const size_type n = nodes_.size();
+        if (n == 0) return;
+
+        struct frame {
+            size_type x;
+            unsigned k;
+            bool left_done;
+        };
+        frame stack[64];
+        int top = 0;
+        stack[top++] = frame{(size_type(1) << root_level_) - 1, root_level_, false};
+        while (top > 0) {
+            frame z = stack[--top];
+            if (z.k <= 3) {
+                // 小子树: 按下标顺序扫描其中所有节点
+                size_type i0 = z.x >> z.k << z.k;
+                size_type i1 = std::min(n, i0 + (size_type(1) << (z.k + 1)) - 1);
+                for (size_type i = i0; i < i1 && q.before(nodes_[i].range.first); ++i) {
+                    if (q.lo < nodes_[i].range.second && !detail::invoke_continue(fn, nodes_[i].range, values_[i])) {
+                        return;
+                    }
+                }
+            } else if (!z.left_done) {
+                const size_type y = z.x - (size_type(1) << (z.k - 1));
+                stack[top++] = frame{z.x, z.k, true};
+                // 左子节点越界时它代表的子树仍可能包含下标 < n 的节点
+                if (y >= n || q.lo < nodes_[y].max_end) stack[top++] = frame{y, z.k - 1, false};
+            } else if (z.x < n && q.before(nodes_[z.x].range.first)) {
+                if (q.lo < nodes_[z.x].range.second && !detail::invoke_continue(fn, nodes_[z.x].range, values_[z.x])) {
+                    return;
+                }
+                stack[top++] = frame{z.x + (size_type(1) << (z.k - 1)), z.k - 1, false};
+            }
+        }
+    }
+
+    std::vector<node> nodes_;
+    std::vector<V> values_;
+    unsigned root_level_ = 0;
+};
+
+template <typename T, typename V>
+inline static_interval_map<T, V> interval_map<T, V>::freeze() const {
+    std::vector<value_type> entries;
+    entries.reserve(size_);
+    for_each([&](const range_type& r, const V& v) { entries.emplace_back(r, v); });
+    return static_interval_map<T, V>(std::move(entries));
+}
+
+} // namespace my_stl
@@ -0,0 +1,296 @@
+/*
+    关键特性说明
+    1. 内存布局描述
+        describe_layout<P>() 给出 pair 类对象的大小、对齐、first/second 偏移
+        以及填充字节数，支持 my_stl::pair、std::pair 和 detail::pair_impl(压缩存储)
+        引用成员没有可取地址的存储，其偏移记为 layout_info::unknown_offset，输出为 n/a
+
+    2. EBCO 效果
+        与朴素布局 struct { T1 a; T2 b; } 对比，计算空基类优化（或紧凑存放）节省的字节数
+
+    3. 紧凑布局估算
+        packed_layout<T1, T2>() 计算按 1 字节对齐时的布局，用于评估存储格式
+
+    4. 类型特征
+        平凡可拷贝、平凡析构、标准布局以及可平凡重定位性质
+
+    5. 输出
+        format_table()/format_json() 输出报告，供 tools/pair_layout_report 使用
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "detail/pair_impl.hpp"
+#include "detail/traits.hpp"
+#include "detail/type_name.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace my_stl {
+
+// ============================================================================
+// 布局信息
+// ============================================================================
+
+struct layout_info {
+    // 无法确定的成员偏移（引用成员）
+    static constexpr std::size_t unknown_offset = static_cast<std::size_t>(-1);
+
+    std::string type_name;
+    std::string variant;            // "my_stl::pair" / "std::pair" / "compressed" / "packed"
+    std::size_t size = 0;
+    std::size_t align = 0;
+    std::size_t first_offset = 0;
+    std::size_t second_offset = 0;
+    std::size_t first_size = 0;     // 成员实际占用的存储（被 EBCO 折叠的空类型为 0）
+    std::size_t second_size = 0;
+    std::size_t naive_size = 0;     // struct { T1 a; T2 b; } 的大小
+    bool first_empty = false;
+    bool second_empty = false;
+    bool trivially_copyable = false;
+    bool trivially_destructible = false;
+    bool standard_layout = false;
+    bool trivially_relocatable = false;
+
+    // 未被成员数据占用的字节（包括空成员占位和对齐填充）
+    std::size_t padding() const noexcept {
+        std::size_t used = first_size + second_size;
+        return size > used ? size - used : 0;
+    }
+
+    // 相比朴素布局节省的字节数（EBCO 或紧凑存放带来的收益）
+    std::size_t saved_vs_naive() const noexcept {
+        return naive_size > size ? naive_size - size : 0;
+    }
+};
+
+namespace detail {
+
+// 成员的存储大小：空类型不携带数据，引用按指针大小估算（实际存储由实现决定）
+template <typename T>
+inline constexpr std::size_t member_storage_size =
+    std::is_reference_v<T> ? sizeof(void*) : (std::is_empty_v<T> ? 0 : sizeof(T));
+
+template <typename T1, typename T2>
+struct naive_pair {
+    T1 a;
+    T2 b;
+};
+
+// 不同 pair 变体访问成员地址的方式
+template <typename P>
+struct layout_access;
+
+template <typename T1, typename T2>
+struct layout_access<my_stl::pair<T1, T2>> {
+    using first_type = T1;
+    using second_type = T2;
+    static const char* name() { return "my_stl::pair"; }
+    static const void* first(const my_stl::pair<T1, T2>& p) { return std::addressof(p.first); }
+    static const void* second(const my_stl::pair<T1, T2>& p) { return std::addressof(p.second); }
+};
+
+template <typename T1, typename T2>
+struct layout_access<std::pair<T1, T2>> {
+    using first_type = T1;
+    using second_type = T2;
+    static const char* name() { return "std::pair"; }
+    static const void* first(const std::pair<T1, T2>& p) { return std::addressof(p.first); }
+    static const void* second(const std::pair<T1, T2>& p) { return std::addressof(p.second); }
+};
+
+template <typename T1, typename T2>
+struct layout_access<pair_impl<T1, T2>> {
+    using first_type = T1;
+    using second_type = T2;
+    static const char* name() { return "compressed"; }
+    static const void* first(const pair_impl<T1, T2>& p) { return std::addressof(p.first()); }
+    static const void* second(const pair_impl<T1, T2>& p) { return std::addressof(p.second()); }
+};
+
+inline std::size_t byte_offset(const void* base, const void* member) {
+    return static_cast<std::size_t>(static_cast<const unsigned char*>(member) -
+                                    static_cast<const unsigned char*>(base));
+}
+
+template <typename T1, typename T2>
+void fill_member_info(layout_info& info) {
+    info.first_size = member_storage_size<T1>;
+    info.second_size = member_storage_size<T2>;
+    info.first_empty = std::is_empty_v<T1>;
+    info.second_empty = std::is_empty_v<T2>;
+    info.naive_size = sizeof(naive_pair<T1, T2>);
+}
+
+} // namespace detail
+
+// ============================================================================
+// 布局计算
+// ============================================================================
+
+template <typename P>
+layout_info describe_layout() {
+    using access = detail::layout_access<P>;
+    using T1 = typename access::first_type;
+    using T2 = typename access::second_type;
+
+    layout_info info;
+    info.type_name = detail::type_name<P>();
+    info.variant = access::name();
+    info.size = sizeof(P);
+    info.align = alignof(P);
+    detail::fill_member_info<T1, T2>(info);
+
+    // 只在未构造的存储上计算成员地址，不读取任何值，
+    // 这样不要求成员类型可默认构造；
+    // 对引用成员取地址会读取未初始化的引用，因此其偏移记为未知
+    alignas(P) unsigned char storage[sizeof(P)];
+    const P& obj = *reinterpret_cast<const P*>(storage);
+    info.first_offset = layout_info::unknown_offset;
+    info.second_offset = layout_info::unknown_offset;
+    if constexpr (!std::is_reference_v<T1>) {
+        info.first_offset = detail::byte_offset(storage, access::first(obj));
+    }
+    if constexpr (!std::is_reference_v<T2>) {
+        info.second_offset = detail::byte_offset(storage, access::second(obj));
+    }
+
+    info.trivially_copyable = std::is_trivially_copyable_v<P>;
+    info.trivially_destructible = std::is_trivially_destructible_v<P>;
+    info.standard_layout = std::is_standard_layout_v<P>;
+    info.trivially_relocatable = detail::is_trivially_relocatable_v<P>;
+    return info;
+}
+
+// 按 1 字节对齐（#pragma pack(1)）存放两个成员时的布局
+template <typename T1, typename T2>
+layout_info packed_layout() {
+    layout_info info;
+    info.type_name = detail::type_name<my_stl::pair<T1, T2>>();
+    info.variant = "packed";
+    detail::fill_member_info<T1, T2>(info);
+    info.size = info.first_size + info.second_size;
+    if (info.size == 0) info.size = 1;
+    info.align = 1;
+    info.first_offset = 0;
+    info.second_offset = info.first_size;
+    info.trivially_copyable = std::is_trivially_copyable_v<T1> && std::is_trivially_copyable_v<T2>;
+    info.trivially_destructible = std::is_trivially_destructible_v<T1> && std::is_trivially_destructible_v<T2>;
+    info.standard_layout = std::is_standard_layout_v<T1> && std::is_standard_layout_v<T2>;
+    info.trivially_relocatable = detail::is_trivially_relocatable_v<T1> && detail::is_trivially_relocatable_v<T2>;
+    return info;
+}
+
+// 对同一组成员类型给出所有变体的布局
+template <typename T1, typename T2>
+void describe_all_layouts(std::vector<layout_info>& out) {
+    out.push_back(describe_layout<my_stl::pair<T1, T2>>());
+    out.push_back(describe_layout<std::pair<T1, T2>>());
+    if constexpr (!std::is_reference_v<T1> && !std::is_reference_v<T2>) {
+        out.push_back(describe_layout<detail::pair_impl<T1, T2>>());
+    }
+    out.push_back(packed_layout<T1, T2>());
+}
+
+// ============================================================================
+// 报告输出
+// ============================================================================
+
+namespace detail {
+
+inline std::string offset_text(std::size_t offset) {
+    return offset == layout_info::unknown_offset ? "n/a" : std::to_string(offset);
+}
+
+inline std::string offset_json(std::size_t offset) {
+    return offset == layout_info::unknown_offset ? "null" : std::to_string(offset);
+}
+
+} // namespace detail
+
+inline void format_table(std::ostream& os, const std::vector<layout_info>& rows) {
+    int name_width = 6;
+    for (const auto& r : rows) {
+        name_width = std::max(name_width, static_cast<int>(r.type_name.size()) + 2);
+    }
+
+    os << std::left << std::setw(name_width) << "type"
+       << std::setw(14) << "variant"
+       << std::right
+       << std::setw(6) << "size"
+       << std::setw(7) << "align"
+       << std::setw(8) << "off1"
+       << std::setw(8) << "off2"
+       << std::setw(8) << "pad"
+       << std::setw(8) << "saved"
+       << std::setw(8) << "trivc"
+       << std::setw(8) << "stdl"
+       << std::setw(8) << "reloc" << '\n';
+
+    for (const auto& r : rows) {
+        os << std::left << std::setw(name_width) << r.type_name
+           << std::setw(14) << r.variant
+           << std::right
+           << std::setw(6) << r.size
+           << std::setw(7) << r.align
+           << std::setw(8) << detail::offset_text(r.first_offset)
+           << std::setw(8) << detail::offset_text(r.second_offset)
+           << std::setw(8) << r.padding()
+           << std::setw(8) << r.saved_vs_naive()
+           << std::setw(8) << (r.trivially_copyable ? "yes" : "no")
+           << std::setw(8) << (r.standard_layout ? "yes" : "no")
+           << std::setw(8) << (r.trivially_relocatable ? "yes" : "no") << '\n';
+    }
+}
+
+namespace detail {
+
+inline void write_json_string(std::ostream& os, const std::string& s) {
+    os << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') os << '\\';
+        os << c;
+    }
+    os << '"';
+}
+
+} // namespace detail
+
+inline void format_json(std::ostream& os, const std::vector<layout_info>& rows) {
+    os << "[\n";
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const auto& r = rows[i];
+        os << "  {\"type\": ";
+        detail::write_json_string(os, r.type_name);
+        os << ", \"variant\": ";
+        detail::write_json_string(os, r.variant);
+        os << ", \"size\": " << r.size
+           << ", \"align\": " << r.align
+           << ", \"first_offset\": " << detail::offset_json(r.first_offset)
+           << ", \"second_offset\": " << detail::offset_json(r.second_offset)
+           << ", \"first_size\": " << r.first_size
+           << ", \"second_size\": " << r.second_size
+           << ", \"padding\": " << r.padding()
+           << ", \"naive_size\": " << r.naive_size
+           << ", \"saved_vs_naive\": " << r.saved_vs_naive()
+           << ", \"first_empty\": " << (r.first_empty ? "true" : "false")
+           << ", \"second_empty\": " << (r.second_empty ? "true" : "false")
+           << ", \"trivially_copyable\": " << (r.trivially_copyable ? "true" : "false")
+           << ", \"trivially_destructible\": " << (r.trivially_destructible ? "true" : "false")
+           << ", \"standard_layout\": " << (r.standard_layout ? "true" : "false")
+           << ", \"trivially_relocatable\": " << (r.trivially_relocatable ? "true" : "false")
+           << '}' << (i + 1 < rows.size() ? "," : "") << '\n';
+    }
+    os << "]\n";
+}
+
+} // namespace my_stl
@@ -0,0 +1,237 @@
+/*
+    关键特性说明
+    1. RadixSpline 学习索引
+        learned_index<K, V> 在按 first 升序排列的 pair 数组上构建一个分段线性模型，
+        把键映射到数组下标；模型只引用数组，不拷贝数据，数组须在索引的生命周期内保持不变
+
+    2. 误差有界
+        构建时用贪心样条走廊 (greedy spline corridor) 选取样条点，
+        保证每个不同键的第一次出现位置与预测值之差不超过 max_error；
+        接近线性的键 (时间戳等) 只需要很少的样条点，模型通常只有几 KB
+
+    3. 查找
+        键相对最小键的偏移取高 radix_bits 位查基数表，得到候选样条点的范围，
+        在其中定位线段并插值，再在 [预测 - max_error, 预测 + max_error + 1] 内用
+        lower_bound_first (无分支二分 + SIMD 窗口) 完成查找；
+        窗口边界不满足时 (大量重复键、浮点舍入) 向外倍增扩展，结果总是正确的
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "search.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace my_stl {
+
+template <typename K, typename V>
+class learned_index {
+    static_assert(std::is_integral_v<K> && sizeof(K) <= 8, "learned_index requires an integral first member");
+
+public:
+    using key_type = K;
+    using value_type = pair<K, V>;
+    using size_type = std::size_t;
+
+    // 模型给出的查找范围 [begin, end)
+    struct search_bound {
+        size_type begin;
+        size_type end;
+    };
+
+    learned_index() = default;
+
+    learned_index(const value_type* first, const value_type* last, size_type max_error = 32,
+                  unsigned radix_bits = 12)
+        : data_(first), n_(static_cast<size_type>(last - first)), max_error_(max_error) {
+        build(radix_bits);
+    }
+
+    size_type size() const noexcept { return n_; }
+    size_type max_error() const noexcept { return max_error_; }
+    size_type spline_points() const noexcept { return spline_.size(); }
+
+    // 模型 (样条点与基数表) 占用的字节数
+    size_type model_size_bytes() const noexcept {
+        return spline_.capacity() * sizeof(spline_point) + radix_table_.capacity() * sizeof(std::uint32_t);
+    }
+
+    // 第一个 first >= key 的元素
+    const value_type* lower_bound(const K& key) const {
+        search_bound b = bound(key);
+        const value_type* it = lower_bound_first(data_ + b.begin, data_ + b.end, key);
+        size_type pos = static_cast<size_type>(it - data_);
+        // 结果紧贴窗口边界时检查窗口外的元素，必要时倍增扩展
+        if (pos == b.begin && b.begin > 0 && !(data_[b.begin - 1].first < key)) {
+            pos = gallop_left(b.begin, key);
+        } else if (pos == b.end && b.end < n_ && data_[b.end].first < key) {
+            pos = gallop_right(b.end, key);
+        }
+        return data_ + pos;
+    }
+
+    // first == key 的第一个元素，不存在时返回 nullptr
+    const value_type* find(const K& key) const {
+        const value_type* it = lower_bound(key);
+        return it != data_ + n_ && it->first == key ? it : nullptr;
+    }
+
+    search_bound bound(const K& key) const noexcept {
+        if (n_ == 0 || key <= min_key_) return {0, 0};
+        if (key > max_key_) return {n_, n_};
+        double predicted = predict(offset(key));
+        double lo = predicted - static_cast<double>(max_error_);
+        double hi = predicted + static_cast<double>(max_error_) + 2.0;
+        size_type begin = lo <= 0.0 ? 0 : std::min(n_, static_cast<size_type>(lo));
+        size_type end = hi >= static_cast<double>(n_) ? n_ : static_cast<size_type>(hi);
+        return {begin, std::max(begin, end)};
+    }
+
+private:
+    struct spline_point {
+        std::uint64_t x;   // 相对 min_key_ 的偏移
+        double y;          // 下标
+    };
+
+    // 带符号键也按无符号差值计算偏移，保持顺序
+    std::uint64_t offset(const K& key) const noexcept {
+        return static_cast<std::uint64_t>(key) - static_cast<std::uint64_t>(min_key_);
+    }
+
+    void build(unsigned radix_bits) {
+        spline_.clear();
+        radix_table_.clear();
+        if (n_ == 0) return;
+        min_key_ = data_[0].first;
+        max_key_ = data_[n_ - 1].first;
+
+        build_spline();
+        build_radix_table(radix_bits);
+    }
+
+    // 贪心样条走廊: 从基点出发的斜率必须落在 [lower, upper] 之间，越界时把上一个点加为样条点
+    void build_spline() {
+        const double err = static_cast<double>(max_error_);
+        spline_.push_back({0, 0.0});
+        spline_point base = spline_.back();
+        spline_point prev = base;
+        double upper_dx = 0, upper_dy = 0, lower_dx = 0, lower_dy = 0;
+        bool has_corridor = false;
+
+        for (size_type i = 1; i < n_; ++i) {
+            if (data_[i].first == data_[i - 1].first) continue;   // 只取每个键的第一次出现
+            spline_point p{offset(data_[i].first), static_cast<double>(i)};
+            double dx = static_cast<double>(p.x - base.x);
+            double dy = p.y - base.y;
+            if (has_corridor) {
+                // dy/dx 超出 [lower_dy/lower_dx, upper_dy/upper_dx] 时，base→p 不再能覆盖之前的点
+                bool above = dy * upper_dx > upper_dy * dx;
+                bool below = dy * lower_dx < lower_dy * dx;
+                if (above || below) {
+                    spline_.push_back(prev);
+                    base = prev;
+                    dx = static_cast<double>(p.x - base.x);
+                    dy = p.y - base.y;
+                    has_corridor = false;
+                }
+            }
+            if (!has_corridor) {
+                upper_dx = lower_dx = dx;
+                upper_dy = dy + err;
+                lower_dy = dy - err;
+                has_corridor = true;
+            } else {
+                if ((dy + err) * upper_dx < upper_dy * dx) {
+                    upper_dx = dx;
+                    upper_dy = dy + err;
+                }
+                if ((dy - err) * lower_dx > lower_dy * dx) {
+                    lower_dx = dx;
+                    lower_dy = dy - err;
+                }
+            }
+            prev = p;
+        }
+        if (prev.x != spline_.back().x) spline_.push_back(prev);
+    }
+
+    // radix_table_[p] = 第一个偏移前缀 >= p 的样条点下标；表的大小按样条点数收缩
+    void build_radix_table(unsigned radix_bits) {
+        const std::uint64_t max_offset = offset(max_key_);
+        unsigned key_bits = max_offset == 0 ? 1 : 64 - static_cast<unsigned>(leading_zeros(max_offset));
+        unsigned point_bits = 1;
+        while ((size_type(1) << point_bits) < spline_.size() && point_bits < 30) ++point_bits;
+        radix_bits = std::max(1u, std::min({radix_bits, point_bits + 1, key_bits}));
+        shift_ = key_bits - radix_bits;
+
+        const size_type entries = (size_type(1) << radix_bits) + 1;
+        radix_table_.assign(entries + 1, 0);
+        size_type p = 0;
+        for (size_type i = 0; i < spline_.size(); ++i) {
+            size_type prefix = static_cast<size_type>(spline_[i].x >> shift_);
+            while (p <= prefix) radix_table_[p++] = static_cast<std::uint32_t>(i);
+        }
+        while (p < radix_table_.size()) radix_table_[p++] = static_cast<std::uint32_t>(spline_.size());
+    }
+
+    static unsigned leading_zeros(std::uint64_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_clzll(v));
+#else
+        unsigned n = 0;
+        for (std::uint64_t bit = std::uint64_t(1) << 63; !(v & bit); bit >>= 1) ++n;
+        return n;
+#endif
+    }
+
+    // x 位于 (0, max_offset]
+    double predict(std::uint64_t x) const noexcept {
+        size_type prefix = static_cast<size_type>(x >> shift_);
+        size_type begin = radix_table_[prefix];
+        size_type end = std::min<size_type>(radix_table_[prefix + 1] + 1, spline_.size());
+        // 第一个 x_s >= x 的样条点，位于 [begin, end)
+        auto it = std::lower_bound(spline_.begin() + static_cast<std::ptrdiff_t>(begin),
+                                   spline_.begin() + static_cast<std::ptrdiff_t>(end), x,
+                                   [](const spline_point& s, std::uint64_t v) { return s.x < v; });
+        const spline_point& right = *it;
+        if (right.x == x) return right.y;
+        const spline_point& left = *(it - 1);
+        double t = static_cast<double>(x - left.x) / static_cast<double>(right.x - left.x);
+        return left.y + t * (right.y - left.y);
+    }
+
+    size_type gallop_left(size_type begin, const K& key) const {
+        size_type step = max_error_ + 1;
+        size_type lo = begin;
+        while (lo > 0 && !(data_[lo - 1].first < key)) {
+            lo = lo > step ? lo - step : 0;
+            step *= 2;
+        }
+        return static_cast<size_type>(lower_bound_first(data_ + lo, data_ + begin, key) - data_);
+    }
+
+    size_type gallop_right(size_type end, const K& key) const {
+        size_type step = max_error_ + 1;
+        size_type hi = end;
+        while (hi < n_ && data_[hi].first < key) {
+            hi = std::min(n_, hi + step);
+            step *= 2;
+        }
+        return static_cast<size_type>(lower_bound_first(data_ + end, data_ + hi, key) - data_);
+    }
+
+    const value_type* data_ = nullptr;
+    size_type n_ = 0;
+    size_type max_error_ = 32;
+    K min_key_ = K();
+    K max_key_ = K();
+    unsigned shift_ = 0;
+    std::vector<spline_point> spline_;
+    std::vector<std::uint32_t> radix_table_;
+};
+
+} // namespace my_stl
@@ -0,0 +1,518 @@
+/*
+    关键特性说明
+    1. 单遍最小/最大值
+        minmax(data, n) 返回 pair<T, T>{最小值, 最大值}；minmax_element(first, last) 返回
+        pair<const T*, const T*>，与 std::minmax_element 一致取第一个最小值和最后一个最大值
+        浮点数的 NaN 被忽略，全部为 NaN 时两个结果都指向第一个元素；空区间返回 {last, last}
+
+    2. 按分数取极值
+        argmin_pair / argmax_pair 在 pair<Score, Id> 数组上按 first 比较，
+        返回分数最小/最大的第一个元素，空区间返回 last
+
+    3. 分块 + SIMD
+        4 或 8 字节的算术类型按 minmax_block 个元素分块，每块用 AVX2/AVX-512 的 min/max 指令
+        同时求出最小值和最大值，只记录极值所在的块；扫描结束后在这两个块内定位元素，
+        内存只完整读一遍。pair<Score, Id> 的 Id 与 Score 等宽时直接加载整个 pair，
+        奇数通道 (Id) 替换为中性值后参与比较
+
+    4. 并行版本
+        *_parallel(…, threads) 把区间切成若干段由 std::thread 分别求极值，再按段的顺序合并，
+        结果与串行版本相同；每段不足 minmax_parallel_grain 个元素时减少线程数，小输入直接串行
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "cpu_dispatch.hpp"
+#include "detail/parallel.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace my_stl {
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_simd_minmax_v =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename S, typename I>
+inline constexpr bool is_simd_score_pair_v =
+    is_simd_minmax_v<S> && sizeof(I) == sizeof(S) && sizeof(pair<S, I>) == 2 * sizeof(S) &&
+    std::is_standard_layout_v<pair<S, I>>;
+
+// 每块的元素个数 (块内结果在寄存器中累积，块间只比较两个标量)
+inline constexpr std::size_t minmax_block = 2048;
+
+// 并行版本每个线程至少处理的元素个数
+inline constexpr std::size_t minmax_parallel_grain = std::size_t(1) << 18;
+
+inline constexpr std::size_t minmax_npos = static_cast<std::size_t>(-1);
+
+// 求最小值时的初值 (不会小于任何非 NaN 的值)
+template <typename T>
+constexpr T minmax_upper() noexcept {
+    if constexpr (std::numeric_limits<T>::has_infinity) return std::numeric_limits<T>::infinity();
+    else return std::numeric_limits<T>::max();
+}
+
+// 求最大值时的初值
+template <typename T>
+constexpr T minmax_lower() noexcept {
+    if constexpr (std::numeric_limits<T>::has_infinity) return -std::numeric_limits<T>::infinity();
+    else return std::numeric_limits<T>::lowest();
+}
+
+// data 中每 Stride 个 T 为一个元素，只比较每个元素的第一个 T；
+// 没有非 NaN 元素时 lo > hi
+template <typename T>
+using minmax_fn = void (*)(const T* data, std::size_t n, T& lo, T& hi);
+
+template <typename T, std::size_t Stride>
+inline void minmax_scalar(const T* data, std::size_t n, T& lo, T& hi) {
+    T mn = minmax_upper<T>();
+    T mx = minmax_lower<T>();
+    for (std::size_t i = 0; i < n; ++i) {
+        T x = data[i * Stride];
+        mn = x < mn ? x : mn;
+        mx = mx < x ? x : mx;
+    }
+    lo = mn;
+    hi = mx;
+}
+
+#if MYSTL_X86_DISPATCH
+
+// ==================== AVX2 ====================
+
+// 元素类型对应的寄存器类型 (用特化而非 std::conditional，避免丢弃向量类型的属性)
+template <typename T>
+struct avx2_vec {
+    using type = __m256i;
+};
+template <>
+struct avx2_vec<float> {
+    using type = __m256;
+};
+template <>
+struct avx2_vec<double> {
+    using type = __m256d;
+};
+
+template <typename T>
+using avx2_vec_t = typename avx2_vec<T>::type;
+
+template <typename T>
+MYSTL_TARGET_AVX2 inline avx2_vec_t<T> load_avx2(const T* p) {
+    if constexpr (std::is_same_v<T, float>) return _mm256_loadu_ps(p);
+    else if constexpr (std::is_same_v<T, double>) return _mm256_loadu_pd(p);
+    else return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+template <typename T>
+MYSTL_TARGET_AVX2 inline avx2_vec_t<T> set1_avx2(T v) {
+    if constexpr (std::is_same_v<T, float>) return _mm256_set1_ps(v);
+    else if constexpr (std::is_same_v<T, double>) return _mm256_set1_pd(v);
+    else if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(static_cast<int>(v));
+    else return _mm256_set1_epi64x(static_cast<long long>(v));
+}
+
+template <typename T>
+MYSTL_TARGET_AVX2 inline void store_avx2(T* p, avx2_vec_t<T> v) {
+    if constexpr (std::is_same_v<T, float>) _mm256_storeu_ps(p, v);
+    else if constexpr (std::is_same_v<T, double>) _mm256_storeu_pd(p, v);
+    else _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+// 64 位整数没有 vpminsq/vpminuq，用比较 + 混合代替；无符号数先翻转符号位
+template <typename T>
+MYSTL_TARGET_AVX2 inline __m256i less_epi64_avx2(__m256i a, __m256i b) {
+    if constexpr (std::is_signed_v<T>) {
+        return _mm256_cmpgt_epi64(b, a);
+    } else {
+        const __m256i bias = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+        return _mm256_cmpgt_epi64(_mm256_xor_si256(b, bias), _mm256_xor_si256(a, bias));
+    }
+}
+
+// a 为 NaN 时返回 b
+template <typename T>
+MYSTL_TARGET_AVX2 inline avx2_vec_t<T> min_avx2(avx2_vec_t<T> a, avx2_vec_t<T> b) {
+    if constexpr (std::is_same_v<T, float>) return _mm256_min_ps(a, b);
+    else if constexpr (std::is_same_v<T, double>) return _mm256_min_pd(a, b);
+    else if constexpr (sizeof(T) == 4 && std::is_signed_v<T>) return _mm256_min_epi32(a, b);
+    else if constexpr (sizeof(T) == 4) return _mm256_min_epu32(a, b);
+    else return _mm256_blendv_epi8(b, a, less_epi64_avx2<T>(a, b));
+}
+
+template <typename T>
+MYSTL_TARGET_AVX2 inline avx2_vec_t<T> max_avx2(avx2_vec_t<T> a, avx2_vec_t<T> b) {
+    if constexpr (std::is_same_v<T, float>) return _mm256_max_ps(a, b);
+    else if constexpr (std::is_same_v<T, double>) return _mm256_max_pd(a, b);
+    else if constexpr (sizeof(T) == 4 && std::is_signed_v<T>) return _mm256_max_epi32(a, b);
+    else if constexpr (sizeof(T) == 4) return _mm256_max_epu32(a, b);
+    else return _mm256_blendv_epi8(b, a, less_epi64_avx2<T>(b, a));
+}
+
+// 保留偶数通道 (pair 的 first)，奇数通道换成 fill
+template <typename T>
+MYSTL_TARGET_AVX2 inline avx2_vec_t<T> even_avx2(avx2_vec_t<T> x, avx2_vec_t<T> fill) {
+    if constexpr (std::is_same_v<T, float>) return _mm256_blend_ps(x, fill, 0xAA);
+    else if constexpr (std::is_same_v<T, double>) return _mm256_blend_pd(x, fill, 0xA);
+    else if constexpr (sizeof(T) == 4) return _mm256_blend_epi32(x, fill, 0xAA);
+    else return _mm256_blend_epi32(x, fill, 0xCC);
+}
+
+template <typename T, std::size_t Stride>
+MYSTL_TARGET_AVX2 inline void minmax_avx2(const T* data, std::size_t n, T& lo, T& hi) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    constexpr std::size_t step = lanes / Stride;   // 每个寄存器包含的元素个数
+    const avx2_vec_t<T> upper = set1_avx2(minmax_upper<T>());
+    const avx2_vec_t<T> lower = set1_avx2(minmax_lower<T>());
+    avx2_vec_t<T> vmin = upper;
+    avx2_vec_t<T> vmax = lower;
+
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        avx2_vec_t<T> x = load_avx2(data + i * Stride);
+        if constexpr (Stride == 1) {
+            vmin = min_avx2<T>(x, vmin);
+            vmax = max_avx2<T>(x, vmax);
+        } else {
+            vmin = min_avx2<T>(even_avx2<T>(x, upper), vmin);
+            vmax = max_avx2<T>(even_avx2<T>(x, lower), vmax);
+        }
+    }
+
+    alignas(32) T mins[lanes];
+    alignas(32) T maxs[lanes];
+    store_avx2(mins, vmin);
+    store_avx2(maxs, vmax);
+    minmax_scalar<T, Stride>(data + i * Stride, n - i, lo, hi);
+    for (std::size_t l = 0; l < lanes; ++l) {
+        lo = mins[l] < lo ? mins[l] : lo;
+        hi = hi < maxs[l] ? maxs[l] : hi;
+    }
+}
+
+// ==================== AVX-512 ====================
+
+template <typename T>
+struct avx512_vec {
+    using type = __m512i;
+};
+template <>
+struct avx512_vec<float> {
+    using type = __m512;
+};
+template <>
+struct avx512_vec<double> {
+    using type = __m512d;
+};
+
+template <typename T>
+using avx512_vec_t = typename avx512_vec<T>::type;
+
+template <typename T>
+MYSTL_TARGET_AVX512 inline avx512_vec_t<T> load_avx512(const T* p) {
+    if constexpr (std::is_same_v<T, float>) return _mm512_loadu_ps(p);
+    else if constexpr (std::is_same_v<T, double>) return _mm512_loadu_pd(p);
+    else return _mm512_loadu_si512(p);
+}
+
+template <typename T>
+MYSTL_TARGET_AVX512 inline avx512_vec_t<T> set1_avx512(T v) {
+    if constexpr (std::is_same_v<T, float>) return _mm512_set1_ps(v);
+    else if constexpr (std::is_same_v<T, double>) return _mm512_set1_pd(v);
+    else if constexpr (sizeof(T) == 4) return _mm512_set1_epi32(static_cast<int>(v));
+    else return _mm512_set1_epi64(static_cast<long long>(v));
+}
+
+template <typename T>
+MYSTL_TARGET_AVX512 inline void store_avx512(T* p, avx512_vec_t<T> v) {
+    if constexpr (std::is_same_v<T, float>) _mm512_storeu_ps(p, v);
+    else if constexpr (std::is_same_v<T, double>) _mm512_storeu_pd(p, v);
+    else _mm512_storeu_si512(p, v);
+}
+
+// a 为 NaN 时返回 b
+template <typename T>
+MYSTL_TARGET_AVX512 inline avx512_vec_t<T> min_avx512(avx512_vec_t<T> a, avx512_vec_t<T> b) {
+    if constexpr (std::is_same_v<T, float>) return _mm512_min_ps(a, b);
+    else if constexpr (std::is_same_v<T, double>) return _mm512_min_pd(a, b);
+    else if constexpr (sizeof(T) == 4 && std::is_signed_v<T>) return _mm512_min_epi32(a, b);
+    else if constexpr (sizeof(T) == 4) return _mm512_min_epu32(a, b);
+    else if constexpr (std::is_signed_v<T>) return _mm512_min_epi64(a, b);
+    else return _mm512_min_epu64(a, b);
+}
+
+template <typename T>
+MYSTL_TARGET_AVX512 inline avx512_vec_t<T> max_avx512(avx512_vec_t<T> a, avx512_vec_t<T> b) {
+    if constexpr (std::is_same_v<T, float>) return _mm512_max_ps(a, b);
+    else if constexpr (std::is_same_v<T, double>) return _mm512_max_pd(a, b);
+    else if constexpr (sizeof(T) == 4 && std::is_signed_v<T>) return _mm512_max_epi32(a, b);
+    else if constexpr (sizeof(T) == 4) return _mm512_max_epu32(a, b);
+    else if constexpr (std::is_signed_v<T>) return _mm512_max_epi64(a, b);
+    else return _mm512_max_epu64(a, b);
+}
+
+// 保留偶数通道 (pair 的 first)，奇数通道换成 fill
+template <typename T>
+MYSTL_TARGET_AVX512 inline avx512_vec_t<T> even_avx512(avx512_vec_t<T> x, avx512_vec_t<T> fill) {
+    if constexpr (std::is_same_v<T, float>) return _mm512_mask_blend_ps(0x5555, fill, x);
+    else if constexpr (std::is_same_v<T, double>) return _mm512_mask_blend_pd(0x55, fill, x);
+    else if constexpr (sizeof(T) == 4) return _mm512_mask_blend_epi32(0x5555, fill, x);
+    else return _mm512_mask_blend_epi64(0x55, fill, x);
+}
+
+template <typename T, std::size_t Stride>
+MYSTL_TARGET_AVX512 inline void minmax_avx512(const T* data, std::size_t n, T& lo, T& hi) {
+    constexpr std::size_t lanes = 64 / sizeof(T);
+    constexpr std::size_t step = lanes / Stride;
+    const avx512_vec_t<T> upper = set1_avx512(minmax_upper<T>());
+    const avx512_vec_t<T> lower = set1_avx512(minmax_lower<T>());
+    avx512_vec_t<T> vmin = upper;
+    avx512_vec_t<T> vmax = lower;
+
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        avx512_vec_t<T> x = load_avx512(data + i * Stride);
+        if constexpr (Stride == 1) {
+            vmin = min_avx512<T>(x, vmin);
+            vmax = max_avx512<T>(x, vmax);
+        } else {
+            vmin = min_avx512<T>(even_avx512<T>(x, upper), vmin);
+            vmax = max_avx512<T>(even_avx512<T>(x, lower), vmax);
+        }
+    }
+
+    alignas(64) T mins[lanes];
+    alignas(64) T maxs[lanes];
+    store_avx512(mins, vmin);
+    store_avx512(maxs, vmax);
+    minmax_scalar<T, Stride>(data + i * Stride, n - i, lo, hi);
+    for (std::size_t l = 0; l < lanes; ++l) {
+        lo = mins[l] < lo ? mins[l] : lo;
+        hi = hi < maxs[l] ? maxs[l] : hi;
+    }
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+template <typename T, std::size_t Stride>
+inline const simd::dispatch_table<minmax_fn<T>>& minmax_table() {
+    static const simd::dispatch_table<minmax_fn<T>> table = MYSTL_DISPATCH_TABLE(
+        (&minmax_scalar<T, Stride>), nullptr, (&minmax_avx2<T, Stride>), (&minmax_avx512<T, Stride>));
+    return table;
+}
+
+// ==================== 定位极值 ====================
+
+// 最小值和最大值所在的元素下标，没有可比较的元素时为 minmax_npos
+struct extremum_positions {
+    std::size_t min_pos;
+    std::size_t max_pos;
+};
+
+// 在 [begin, end) 内逐个比较 key_at(i)；Source::last_max 为 true 时取最后一个最大值
+template <typename Source>
+inline extremum_positions locate_extrema_generic(const Source& src, std::size_t begin, std::size_t end) {
+    extremum_positions r{minmax_npos, minmax_npos};
+    for (std::size_t i = begin; i < end; ++i) {
+        const auto& k = src.key_at(i);
+        if constexpr (std::is_floating_point_v<std::decay_t<decltype(k)>>) {
+            if (k != k) continue;   // NaN
+        }
+        if (r.min_pos == minmax_npos) {
+            r = {i, i};
+            continue;
+        }
+        if (k < src.key_at(r.min_pos)) r.min_pos = i;
+        if (Source::last_max ? !(k < src.key_at(r.max_pos)) : src.key_at(r.max_pos) < k) r.max_pos = i;
+    }
+    return r;
+}
+
+// 分块求值后只在极值所在的块内定位元素；data 中每 Stride 个 T 为一个元素
+template <typename T, std::size_t Stride, bool LastMax>
+inline extremum_positions locate_extrema_simd(const T* data, std::size_t begin, std::size_t end) {
+    static const minmax_fn<T> fn = minmax_table<T, Stride>().resolve();
+    T lo = minmax_upper<T>();
+    T hi = minmax_lower<T>();
+    std::size_t min_block = minmax_npos;
+    std::size_t max_block = minmax_npos;
+    for (std::size_t b = begin; b < end; b += minmax_block) {
+        T block_lo, block_hi;
+        fn(data + b * Stride, std::min(minmax_block, end - b), block_lo, block_hi);
+        if (!(block_lo <= block_hi)) continue;   // 整块都是 NaN
+        if (min_block == minmax_npos || block_lo < lo) {
+            lo = block_lo;
+            min_block = b;
+        }
+        if (max_block == minmax_npos || (LastMax ? !(block_hi < hi) : hi < block_hi)) {
+            hi = block_hi;
+            max_block = b;
+        }
+    }
+    if (min_block == minmax_npos) return {minmax_npos, minmax_npos};
+
+    extremum_positions r{min_block, max_block};
+    while (!(data[r.min_pos * Stride] == lo)) ++r.min_pos;
+    if constexpr (LastMax) {
+        r.max_pos = std::min(max_block + minmax_block, end) - 1;
+        while (!(data[r.max_pos * Stride] == hi)) --r.max_pos;
+    } else {
+        while (!(data[r.max_pos * Stride] == hi)) ++r.max_pos;
+    }
+    return r;
+}
+
+// 元素数组，取第一个最小值和最后一个最大值 (与 std::minmax_element 一致)
+template <typename T>
+struct element_source {
+    static constexpr bool last_max = true;
+    const T* data;
+
+    const T& key_at(std::size_t i) const { return data[i]; }
+
+    extremum_positions locate(std::size_t begin, std::size_t end) const {
+        if constexpr (is_simd_minmax_v<T>) return locate_extrema_simd<T, 1, true>(data, begin, end);
+        else return locate_extrema_generic(*this, begin, end);
+    }
+};
+
+// pair<Score, Id> 数组按 first 比较，取第一个最小值和第一个最大值
+template <typename S, typename I>
+struct score_source {
+    static constexpr bool last_max = false;
+    const pair<S, I>* data;
+
+    const S& key_at(std::size_t i) const { return data[i].first; }
+
+    extremum_positions locate(std::size_t begin, std::size_t end) const {
+        if constexpr (is_simd_score_pair_v<S, I>) {
+            return locate_extrema_simd<S, 2, false>(reinterpret_cast<const S*>(data), begin, end);
+        } else {
+            return locate_extrema_generic(*this, begin, end);
+        }
+    }
+};
+
+// 按段的顺序合并，保持与串行扫描相同的平局规则
+template <typename Source>
+inline void merge_extrema(const Source& src, extremum_positions& acc, const extremum_positions& part) {
+    if (part.min_pos == minmax_npos) return;
+    if (acc.min_pos == minmax_npos) {
+        acc = part;
+        return;
+    }
+    if (src.key_at(part.min_pos) < src.key_at(acc.min_pos)) acc.min_pos = part.min_pos;
+    const auto& part_max = src.key_at(part.max_pos);
+    const auto& acc_max = src.key_at(acc.max_pos);
+    if (Source::last_max ? !(part_max < acc_max) : acc_max < part_max) acc.max_pos = part.max_pos;
+}
+
+template <typename Source>
+inline extremum_positions locate_extrema_parallel(const Source& src, std::size_t n, unsigned threads) {
+    const std::size_t chunks =
+        std::min<std::size_t>(resolve_threads(threads), std::max<std::size_t>(1, n / minmax_parallel_grain));
+    if (chunks <= 1) return src.locate(0, n);
+
+    std::vector<extremum_positions> parts(chunks);
+    parallel_invoke(chunks, [&](std::size_t c) {
+        parts[c] = src.locate(chunk_begin(n, chunks, c), chunk_begin(n, chunks, c + 1));
+    });
+
+    extremum_positions acc{minmax_npos, minmax_npos};
+    for (const auto& part : parts) merge_extrema(src, acc, part);
+    return acc;
+}
+
+// 非空区间的下标转换为指针，全部为 NaN 时都指向第一个元素
+template <typename T>
+inline pair<const T*, const T*> to_elements(const T* first, const extremum_positions& r) {
+    if (r.min_pos == minmax_npos) return pair<const T*, const T*>(first, first);
+    return pair<const T*, const T*>(first + r.min_pos, first + r.max_pos);
+}
+
+} // namespace detail
+
+// ==================== 公共接口 ====================
+
+// 第一个最小元素和最后一个最大元素；空区间返回 {last, last}
+template <typename T>
+inline pair<const T*, const T*> minmax_element(const T* first, const T* last) {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n == 0) return pair<const T*, const T*>(last, last);
+    return detail::to_elements(first, detail::element_source<T>{first}.locate(0, n));
+}
+
+template <typename T>
+inline pair<const T*, const T*> minmax_element_parallel(const T* first, const T* last, unsigned threads = 0) {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n == 0) return pair<const T*, const T*>(last, last);
+    return detail::to_elements(first, detail::locate_extrema_parallel(detail::element_source<T>{first}, n, threads));
+}
+
+// {最小值, 最大值}，n 必须大于 0
+template <typename T>
+inline pair<T, T> minmax(const T* data, std::size_t n) {
+    assert(n > 0);
+    if constexpr (detail::is_simd_minmax_v<T>) {
+        // 只要值时不必定位元素，整个区间一次求完
+        static const detail::minmax_fn<T> fn = detail::minmax_table<T, 1>().resolve();
+        T lo, hi;
+        fn(data, n, lo, hi);
+        if (!(lo <= hi)) return pair<T, T>(data[0], data[0]);
+        return pair<T, T>(lo, hi);
+    } else {
+        auto r = minmax_element(data, data + n);
+        return pair<T, T>(*r.first, *r.second);
+    }
+}
+
+template <typename T>
+inline pair<T, T> minmax_parallel(const T* data, std::size_t n, unsigned threads = 0) {
+    assert(n > 0);
+    auto r = minmax_element_parallel(data, data + n, threads);
+    return pair<T, T>(*r.first, *r.second);
+}
+
+// first 最小的第一个元素；空区间返回 last
+template <typename S, typename I>
+inline const pair<S, I>* argmin_pair(const pair<S, I>* first, const pair<S, I>* last) {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n == 0) return last;
+    return detail::to_elements(first, detail::score_source<S, I>{first}.locate(0, n)).first;
+}
+
+// first 最大的第一个元素；空区间返回 last
+template <typename S, typename I>
+inline const pair<S, I>* argmax_pair(const pair<S, I>* first, const pair<S, I>* last) {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n == 0) return last;
+    return detail::to_elements(first, detail::score_source<S, I>{first}.locate(0, n)).second;
+}
+
+template <typename S, typename I>
+inline const pair<S, I>* argmin_pair_parallel(const pair<S, I>* first, const pair<S, I>* last, unsigned threads = 0) {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n == 0) return last;
+    auto r = detail::locate_extrema_parallel(detail::score_source<S, I>{first}, n, threads);
+    return detail::to_elements(first, r).first;
+}
+
+template <typename S, typename I>
+inline const pair<S, I>* argmax_pair_parallel(const pair<S, I>* first, const pair<S, I>* last, unsigned threads = 0) {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n == 0) return last;
+    auto r = detail::locate_extrema_parallel(detail::score_source<S, I>{first}, n, threads);
+    return detail::to_elements(first, r).second;
+}
+
+} // namespace my_stl
@@ -0,0 +1,184 @@
+/*
+    关键特性说明
+    1. Morton (Z-order) 编码
+        morton_encode(x, y) 把两个 32 位坐标按位交错成 64 位编码: x 占偶数位，y 占奇数位；
+        morton_decode(code) 反向拆出 pair<uint32_t, uint32_t>{x, y}
+        单个值的编码/解码是 constexpr 的 (移位 + 掩码的 magic bits 算法)
+
+    2. 批量编码/解码
+        morton_encode(in, n, out) / morton_decode(in, n, out) 在 pair 数组与编码数组之间转换:
+        AVX2 等级使用 BMI2 的 pdep/pext，每个坐标一条指令；
+        AVX-512 等级在 8 个 64 位通道上同时执行 magic bits，用 vpternlogq 合并移位、或、与
+        通过 cpu_dispatch.hpp 的 dispatch_table 在运行时选择，结果与标量实现相同
+
+    3. 空间排序
+        morton_sort(data, n) 按 Z-order 排列坐标数组: 先批量编码，再用 radix_sort.hpp 的
+        基数排序对编码排序，最后解码写回；二维上相邻的点在数组中也大多相邻，
+        邻域查询和分块遍历的缓存局部性远好于行优先顺序
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "cpu_dispatch.hpp"
+#include "radix_sort.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace my_stl {
+
+using morton_point = pair<std::uint32_t, std::uint32_t>;
+
+namespace detail {
+
+// 把 32 位值的第 i 位移到第 2i 位
+constexpr std::uint64_t morton_spread(std::uint64_t v) noexcept {
+    v &= 0x00000000FFFFFFFFull;
+    v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+    v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+    v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+    v = (v | (v << 2)) & 0x3333333333333333ull;
+    v = (v | (v << 1)) & 0x5555555555555555ull;
+    return v;
+}
+
+// morton_spread 的逆运算，只取偶数位
+constexpr std::uint32_t morton_compact(std::uint64_t v) noexcept {
+    v &= 0x5555555555555555ull;
+    v = (v | (v >> 1)) & 0x3333333333333333ull;
+    v = (v | (v >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+    v = (v | (v >> 4)) & 0x00FF00FF00FF00FFull;
+    v = (v | (v >> 8)) & 0x0000FFFF0000FFFFull;
+    v = (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+    return static_cast<std::uint32_t>(v);
+}
+
+} // namespace detail
+
+constexpr std::uint64_t morton_encode(std::uint32_t x, std::uint32_t y) noexcept {
+    return detail::morton_spread(x) | (detail::morton_spread(y) << 1);
+}
+
+constexpr std::uint64_t morton_encode(const morton_point& p) noexcept {
+    return morton_encode(p.first, p.second);
+}
+
+constexpr morton_point morton_decode(std::uint64_t code) noexcept {
+    return morton_point(detail::morton_compact(code), detail::morton_compact(code >> 1));
+}
+
+namespace detail {
+
+using morton_encode_fn = void (*)(const morton_point* in, std::size_t n, std::uint64_t* out);
+using morton_decode_fn = void (*)(const std::uint64_t* in, std::size_t n, morton_point* out);
+
+inline void morton_encode_scalar(const morton_point* in, std::size_t n, std::uint64_t* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = morton_encode(in[i]);
+}
+
+inline void morton_decode_scalar(const std::uint64_t* in, std::size_t n, morton_point* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = morton_decode(in[i]);
+}
+
+#if MYSTL_X86_DISPATCH
+
+// ============================================================================
+// AVX2 等级: BMI2 pdep/pext
+// ============================================================================
+
+MYSTL_TARGET_AVX2 inline void morton_encode_avx2(const morton_point* in, std::size_t n, std::uint64_t* out) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = _pdep_u64(in[i].first, 0x5555555555555555ull) | _pdep_u64(in[i].second, 0xAAAAAAAAAAAAAAAAull);
+    }
+}
+
+MYSTL_TARGET_AVX2 inline void morton_decode_avx2(const std::uint64_t* in, std::size_t n, morton_point* out) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = morton_point(static_cast<std::uint32_t>(_pext_u64(in[i], 0x5555555555555555ull)),
+                              static_cast<std::uint32_t>(_pext_u64(in[i], 0xAAAAAAAAAAAAAAAAull)));
+    }
+}
+
+// ============================================================================
+// AVX-512: 8 个通道同时执行 magic bits，(a | b) & c 用一条 vpternlogq (imm 0xA8)
+// ============================================================================
+
+MYSTL_TARGET_AVX512 inline __m512i morton_spread_avx512(__m512i v) {
+    v = _mm512_ternarylogic_epi64(v, _mm512_slli_epi64(v, 16), _mm512_set1_epi64(0x0000FFFF0000FFFFll), 0xA8);
+    v = _mm512_ternarylogic_epi64(v, _mm512_slli_epi64(v, 8), _mm512_set1_epi64(0x00FF00FF00FF00FFll), 0xA8);
+    v = _mm512_ternarylogic_epi64(v, _mm512_slli_epi64(v, 4), _mm512_set1_epi64(0x0F0F0F0F0F0F0F0Fll), 0xA8);
+    v = _mm512_ternarylogic_epi64(v, _mm512_slli_epi64(v, 2), _mm512_set1_epi64(0x3333333333333333ll), 0xA8);
+    v = _mm512_ternarylogic_epi64(v, _mm512_slli_epi64(v, 1), _mm512_set1_epi64(0x5555555555555555ll), 0xA8);
+    return v;
+}
+
+MYSTL_TARGET_AVX512 inline __m512i morton_compact_avx512(__m512i v) {
+    v = _mm512_and_si512(v, _mm512_set1_epi64(0x5555555555555555ll));
+    v = _mm512_ternarylogic_epi64(v, _mm512_srli_epi64(v, 1), _mm512_set1_epi64(0x3333333333333333ll), 0xA8);
+    v = _mm512_ternarylogic_epi64(v, _mm512_srli_epi64(v, 2), _mm512_set1_epi64(0x0F0F0F0F0F0F0F0Fll), 0xA8);
+    v = _mm512_ternarylogic_epi64(v, _mm512_srli_epi64(v, 4), _mm512_set1_epi64(0x00FF00FF00FF00FFll), 0xA8);
+    v = _mm512_ternarylogic_epi64(v, _mm512_srli_epi64(v, 8), _mm512_set1_epi64(0x0000FFFF0000FFFFll), 0xA8);
+    v = _mm512_ternarylogic_epi64(v, _mm512_srli_epi64(v, 16), _mm512_set1_epi64(0x00000000FFFFFFFFll), 0xA8);
+    return v;
+}
+
+// 每个 64 位通道是一个 pair: 低 32 位为 x，高 32 位为 y
+MYSTL_TARGET_AVX512 inline void morton_encode_avx512(const morton_point* in, std::size_t n, std::uint64_t* out) {
+    const __m512i low = _mm512_set1_epi64(0x00000000FFFFFFFFll);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i p = _mm512_loadu_si512(in + i);
+        __m512i x = morton_spread_avx512(_mm512_and_si512(p, low));
+        __m512i y = morton_spread_avx512(_mm512_srli_epi64(p, 32));
+        _mm512_storeu_si512(out + i, _mm512_or_si512(x, _mm512_slli_epi64(y, 1)));
+    }
+    morton_encode_scalar(in + i, n - i, out + i);
+}
+
+MYSTL_TARGET_AVX512 inline void morton_decode_avx512(const std::uint64_t* in, std::size_t n, morton_point* out) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i c = _mm512_loadu_si512(in + i);
+        __m512i x = morton_compact_avx512(c);
+        __m512i y = morton_compact_avx512(_mm512_srli_epi64(c, 1));
+        _mm512_storeu_si512(out + i, _mm512_or_si512(x, _mm512_slli_epi64(y, 32)));
+    }
+    morton_decode_scalar(in + i, n - i, out + i);
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+inline const simd::dispatch_table<morton_encode_fn>& morton_encode_table() {
+    static const simd::dispatch_table<morton_encode_fn> table =
+        MYSTL_DISPATCH_TABLE(&morton_encode_scalar, nullptr, &morton_encode_avx2, &morton_encode_avx512);
+    return table;
+}
+
+inline const simd::dispatch_table<morton_decode_fn>& morton_decode_table() {
+    static const simd::dispatch_table<morton_decode_fn> table =
+        MYSTL_DISPATCH_TABLE(&morton_decode_scalar, nullptr, &morton_decode_avx2, &morton_decode_avx512);
+    return table;
+}
+
+} // namespace detail
+
+inline void morton_encode(const morton_point* in, std::size_t n, std::uint64_t* out) {
+    static const auto fn = detail::morton_encode_table().resolve();
+    fn(in, n, out);
+}
+
+inline void morton_decode(const std::uint64_t* in, std::size_t n, morton_point* out) {
+    static const auto fn = detail::morton_decode_table().resolve();
+    fn(in, n, out);
+}
+
+// 按 Z-order 原地排列坐标；编码是双射，所以只需对编码排序再解码
+inline void morton_sort(morton_point* data, std::size_t n) {
+    std::vector<std::uint64_t> codes(n);
+    morton_encode(data, n, codes.data());
+    radix_sort(codes.data(), n);
+    morton_decode(codes.data(), n, data);
+}
+
+} // namespace my_stl
@@ -31,8 +31,11 @@
 
 #pragma once
 
+#include "detail/hash.hpp"
 #include "detail/pair_impl.hpp"
 #include "detail/traits.hpp"
+#include <cstdint>
+#include <functional>
 #include <type_traits>
 #include <utility>
 
@@ -51,6 +54,13 @@
 #define MYSTL_UNLIKELY(x) (x)
 #endif
 
+// 拷贝/移动插桩 (见 instrument.hpp)，未定义 MYSTL_INSTRUMENT 时不引入任何代码
+#ifdef MYSTL_INSTRUMENT
+#include "instrument.hpp"
+#elif !defined(MYSTL_INSTRUMENT_RECORD)
+#define MYSTL_INSTRUMENT_RECORD(kind) ((void)0)
+#endif
+
 namespace my_stl {
 
 // ============================================================================
@@ -85,26 +95,47 @@ public:
     template <typename U1, typename U2>
     constexpr pair(U1&& u1, U2&& u2) : first(std::forward<U1>(u1)), second(std::forward<U2>(u2)) {}
 
+#ifdef MYSTL_INSTRUMENT
+    // 插桩模式下需要用户提供的拷贝/移动构造函数来记录次数，
+    // 编译器能区分常量求值时仍为 constexpr (见 instrument.hpp)
+    MYSTL_INSTRUMENT_CONSTEXPR pair(const pair& other) : first(other.first), second(other.second) {
+        MYSTL_INSTRUMENT_RECORD(copy_construct);
+    }
+
+    MYSTL_INSTRUMENT_CONSTEXPR pair(pair&& other) noexcept(noexcept(T1(std::move(std::declval<T1&>()))) && noexcept(T2(std::move(std::declval<T2&>()))))
+        : first(std::forward<T1>(other.first)), second(std::forward<T2>(other.second)) {
+        MYSTL_INSTRUMENT_RECORD(move_construct);
+    }
+#else
     // 拷贝构造函数
     constexpr pair(const pair&) = default;
 
     // 移动构造函数
     constexpr pair(pair&&) noexcept(noexcept(T1(std::move(std::declval<T1&>()))) && noexcept(T2(std::move(std::declval<T2&>())))) = default;
+#endif
 
     // 从其他类型的 pair 构造
     template <typename U1, typename U2>
-    constexpr pair(const pair<U1, U2>& other) : first(other.first), second(other.second) {}
+    constexpr pair(const pair<U1, U2>& other) : first(other.first), second(other.second) {
+        MYSTL_INSTRUMENT_RECORD(convert_copy);
+    }
 
     template <typename U1, typename U2>
     constexpr pair(pair<U1, U2>&& other) noexcept(noexcept(T1(std::move(other.first))) && noexcept(T2(std::move(other.second)))) 
-        : first(std::move(other.first)), second(std::move(other.second)) {}
+        : first(std::move(other.first)), second(std::move(other.second)) {
+        MYSTL_INSTRUMENT_RECORD(convert_move);
+    }
 
     // 从 std::pair 构造
     template <typename U1, typename U2>
-    constexpr pair(const std::pair<U1, U2>& other) : first(other.first), second(other.second) {}
+    constexpr pair(const std::pair<U1, U2>& other) : first(other.first), second(other.second) {
+        MYSTL_INSTRUMENT_RECORD(convert_copy);
+    }
 
     template <typename U1, typename U2>
-    constexpr pair(std::pair<U1, U2>&& other) noexcept : first(std::forward<U1>(other.first)), second(std::forward<U2>(other.second)) {}
+    constexpr pair(std::pair<U1, U2>&& other) noexcept : first(std::forward<U1>(other.first)), second(std::forward<U2>(other.second)) {
+        MYSTL_INSTRUMENT_RECORD(convert_move);
+    }
 
     // ========================================================================
     // 赋值运算符
@@ -112,6 +143,7 @@ public:
 
     // 拷贝赋值
     MYSTL_ALWAYS_INLINE pair& operator=(const pair& other) {
+        MYSTL_INSTRUMENT_RECORD(copy_assign);
         first = other.first;
         second = other.second;
         return *this;
@@ -119,6 +151,7 @@ public:
 
     // 移动赋值
     MYSTL_ALWAYS_INLINE pair& operator=(pair&& other) noexcept(noexcept(first = std::move(other.first)) && noexcept(second = std::move(other.second))) {
+        MYSTL_INSTRUMENT_RECORD(move_assign);
         first = std::move(other.first);
         second = std::move(other.second);
         return *this;
@@ -127,6 +160,7 @@ public:
     // 从其他 pair 类型赋值
     template <typename U1, typename U2>
     MYSTL_ALWAYS_INLINE pair& operator=(const pair<U1, U2>& other) {
+        MYSTL_INSTRUMENT_RECORD(convert_copy);
         first = other.first;
         second = other.second;
         return *this;
@@ -135,6 +169,7 @@ public:
     template <typename U1, typename U2>
     MYSTL_ALWAYS_INLINE pair& operator=(pair<U1, U2>&& other) 
         noexcept(noexcept(first = std::forward<U1>(other.first)) && noexcept(second = std::forward<U2>(other.second))) {
+        MYSTL_INSTRUMENT_RECORD(convert_move);
         first = std::forward<U1>(other.first);
         second = std::forward<U2>(other.second);
         return *this;
@@ -143,6 +178,7 @@ public:
     // 从 std::pair 赋值
     template<typename U1, typename U2>
     MYSTL_ALWAYS_INLINE pair& operator=(std::pair<U1, U2>& other) {
+        MYSTL_INSTRUMENT_RECORD(convert_copy);
         first = other.first;
         second = other.second;
         return *this;
@@ -151,6 +187,7 @@ public:
     template<typename U1, typename U2>
     MYSTL_ALWAYS_INLINE pair& operator=(std::pair<U1, U2>&& other) 
         noexcept(noexcept(first = std::move(other.first)) && noexcept(second = std::move(other.second))) {
+        MYSTL_INSTRUMENT_RECORD(convert_move);
         first = std::move(other.first);
         second = std::move(other.second);
         return *this;
@@ -170,11 +207,13 @@ public:
     // 转换为 std::pair
     template <typename U1 = T1, typename U2 = T2>
     constexpr operator std::pair<U1, U2>() const & {
+        MYSTL_INSTRUMENT_RECORD(convert_copy);
         return std::pair<U1, U2>(first, second);
     }
 
     template <typename U1 = T1, typename U2 = T2>
     constexpr operator std::pair<U1, U2>() && {
+        MYSTL_INSTRUMENT_RECORD(convert_move);
         return std::pair<U1, U2>(std::move(first), std::move(second));
     }
 };
@@ -206,9 +245,15 @@ constexpr bool operator!=(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
 
 template <typename T1, typename T2>
 constexpr bool operator<(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
-    if (lhs.first < rhs.first) return true;
-    if (rhs.first < lhs.first) return false;
-    return lhs.second < rhs.second;
+    if constexpr (std::is_arithmetic_v<T1> && std::is_arithmetic_v<T2>) {
+        // 算术成员的比较没有副作用，用按位运算代替短路分支，循环中可以被自动向量化
+        return static_cast<bool>(static_cast<int>(lhs.first < rhs.first) |
+                                 (static_cast<int>(!(rhs.first < lhs.first)) & static_cast<int>(lhs.second < rhs.second)));
+    } else {
+        if (lhs.first < rhs.first) return true;
+        if (rhs.first < lhs.first) return false;
+        return lhs.second < rhs.second;
+    }
 }
 
 template <typename T1, typename T2>
@@ -361,9 +406,9 @@ constexpr auto&& get(my_stl::pair<T1, T2>&& p) noexcept {
 template <typename T1, typename T2>
 struct hash<my_stl::pair<T1, T2>> {
     size_t operator()(const my_stl::pair<T1, T2>& p) const {
-        auto h1 = std::hash<T1>{}(p.first);
-        auto h2 = std::hash<T2>{}(p.second);
-        return h1 ^ (h2 << 1);
+        auto h1 = static_cast<std::uint64_t>(std::hash<T1>{}(p.first));
+        auto h2 = static_cast<std::uint64_t>(std::hash<T2>{}(p.second));
+        return static_cast<size_t>(my_stl::detail::hash_combine64(h1, h2));
     }
 };
 
@@ -0,0 +1,105 @@
+/*
+    关键特性说明
+    1. LSD 基数排序
+        radix_sort_by(data, n, key) 按 key(元素) 返回的无符号整数 (最多 64 位) 稳定排序，
+        每轮处理 8 位；一次读遍历统计所有轮次的直方图，某一位在所有键上都相同的轮次直接跳过，
+        时间复杂度 O(n · 有效字节数)，额外内存为一个 n 元素的缓冲区
+
+    2. 便捷接口
+        radix_sort(data, n)         对无符号整数数组排序
+        radix_sort_first(data, n)   按 first 对 pair 数组稳定排序，first 可以是带符号整数
+                                    (翻转符号位后按无符号数排序，顺序不变)
+
+    3. 适用范围
+        元素必须可按字节拷贝 (平凡可拷贝的类型，或成员都平凡可拷贝的 pair)；
+        元素少于 radix_sort_cutoff 时改用 std::stable_sort
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace my_stl {
+
+namespace detail {
+
+// 小数组上直方图的开销超过比较排序
+inline constexpr std::size_t radix_sort_cutoff = 256;
+
+// 整数映射为保持顺序的无符号数
+template <typename K>
+constexpr std::make_unsigned_t<K> order_preserving_key(K v) noexcept {
+    using U = std::make_unsigned_t<K>;
+    if constexpr (std::is_signed_v<K>) {
+        return static_cast<U>(static_cast<U>(v) ^ (U(1) << (sizeof(K) * 8 - 1)));
+    } else {
+        return static_cast<U>(v);
+    }
+}
+
+} // namespace detail
+
+// 按 key(元素) 稳定排序，key 返回无符号整数
+template <typename T, typename KeyFn>
+inline void radix_sort_by(T* data, std::size_t n, KeyFn key) {
+    static_assert(detail::is_bitwise_copyable_v<T>, "radix_sort_by requires trivially copyable elements");
+    using K = std::decay_t<decltype(key(*data))>;
+    static_assert(std::is_integral_v<K> && std::is_unsigned_v<K>, "radix_sort_by requires an unsigned key");
+    constexpr std::size_t digits = sizeof(K);
+
+    if (n < detail::radix_sort_cutoff) {
+        std::stable_sort(data, data + n, [&](const T& a, const T& b) { return key(a) < key(b); });
+        return;
+    }
+
+    // 一次遍历统计每一轮的直方图
+    std::vector<std::array<std::size_t, 256>> counts(digits);
+    for (auto& c : counts) c.fill(0);
+    for (std::size_t i = 0; i < n; ++i) {
+        K k = key(data[i]);
+        for (std::size_t d = 0; d < digits; ++d) ++counts[d][(k >> (8 * d)) & 0xFF];
+    }
+
+    std::vector<T> buffer(n);
+    T* src = data;
+    T* dst = buffer.data();
+    for (std::size_t d = 0; d < digits; ++d) {
+        auto& count = counts[d];
+        // 所有键在这一位上相同，这一轮不改变顺序
+        if (count[(key(src[0]) >> (8 * d)) & 0xFF] == n) continue;
+
+        std::size_t offset = 0;
+        for (auto& c : count) {
+            std::size_t next = offset + c;
+            c = offset;
+            offset = next;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            dst[count[(key(src[i]) >> (8 * d)) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+    if (src != data) std::memcpy(static_cast<void*>(data), src, n * sizeof(T));
+}
+
+template <typename U>
+inline void radix_sort(U* data, std::size_t n) {
+    static_assert(std::is_integral_v<U> && std::is_unsigned_v<U>, "radix_sort requires unsigned integers");
+    radix_sort_by(data, n, [](U v) { return v; });
+}
+
+// 按 first 稳定排序，first 为整数
+template <typename K, typename V>
+inline void radix_sort_first(pair<K, V>* data, std::size_t n) {
+    static_assert(std::is_integral_v<K> && !std::is_same_v<K, bool>, "radix_sort_first requires an integral first member");
+    radix_sort_by(data, n, [](const pair<K, V>& p) { return detail::order_preserving_key(p.first); });
+}
+
+} // namespace my_stl
@@ -0,0 +1,328 @@
+/*
+    关键特性说明
+    1. 按 first 查找
+        lower_bound_first / equal_range_first 在按 first 升序排列的 pair 数组上查找整数键，
+        语义与 std::lower_bound / std::equal_range 以 first 为键时相同
+
+    2. 无分支二分 + SIMD 窗口扫描
+        二分阶段每步只做一次比较，用条件移动更新 base，没有难以预测的分支，
+        并预取下一步两个可能的探测位置；
+        剩余范围缩小到 128 字节 (2 个缓存行) 的窗口后，用一次 SIMD 比较统计窗口内小于键的元素数
+
+    3. 批量查找
+        lower_bound_first_batch 每组 16 个键交错推进二分，每一步为下一步的探测位置发出预取，
+        多个缓存未命中可以同时进行，大数组上吞吐远高于逐个查找
+
+    4. 运行时分派
+        first 为 32/64 位整数且 pair 没有填充 (sizeof(pair) == 2 * sizeof(K)) 时使用
+        cpu_dispatch.hpp 登记的 SSE4.2/AVX2/AVX-512 实现，其余情况使用标量实现，结果相同
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "cpu_dispatch.hpp"
+#include "detail/prefetch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace my_stl {
+
+namespace detail {
+
+template <typename K, typename V>
+inline constexpr bool is_simd_searchable_v =
+    std::is_integral_v<K> && !std::is_same_v<K, bool> && (sizeof(K) == 4 || sizeof(K) == 8) &&
+    sizeof(pair<K, V>) == 2 * sizeof(K) && std::is_standard_layout_v<pair<K, V>>;
+
+// 以下内核把 pair 数组视为键间隔为 2 的 K 数组: 第 i 个元素的 first 为 data[2 * i]
+template <typename K>
+using lower_bound_fn = std::size_t (*)(const K* data, std::size_t n, K key);
+template <typename K>
+using lower_bound_batch_fn = void (*)(const K* data, std::size_t n, const K* keys, std::size_t m, std::size_t* out);
+
+constexpr std::size_t search_window_bytes = 128;
+
+// 窗口内的元素个数: 32 位键 16 个，64 位键 8 个
+template <typename K>
+inline constexpr std::size_t search_window = search_window_bytes / (2 * sizeof(K));
+
+// 批量查找时交错推进的键数
+constexpr std::size_t search_batch_group = 16;
+
+// ============================================================================
+// 窗口扫描: 统计 p 起的 search_window<K> 个元素中 first < key 的个数
+// ============================================================================
+
+struct scalar_window {
+    template <typename K>
+    static std::size_t count(const K* p, K key) noexcept {
+        std::size_t c = 0;
+        for (std::size_t i = 0; i < search_window<K>; ++i) c += p[2 * i] < key;
+        return c;
+    }
+};
+
+#if MYSTL_X86_DISPATCH
+
+// 无符号键与符号位异或后按有符号比较
+struct sse42_window {
+    template <typename K>
+    MYSTL_TARGET_SSE42 static std::size_t count(const K* p, K key) noexcept {
+        const __m128i* v = reinterpret_cast<const __m128i*>(p);
+        unsigned c = 0;
+        if constexpr (sizeof(K) == 4) {
+            const __m128i flip = _mm_set1_epi32(std::is_signed_v<K> ? 0 : std::numeric_limits<std::int32_t>::min());
+            const __m128i k = _mm_xor_si128(_mm_set1_epi32(static_cast<std::int32_t>(key)), flip);
+            for (std::size_t r = 0; r < search_window_bytes / 16; ++r) {
+                __m128i lt = _mm_cmpgt_epi32(k, _mm_xor_si128(_mm_loadu_si128(v + r), flip));
+                c += static_cast<unsigned>(_mm_popcnt_u32(_mm_movemask_ps(_mm_castsi128_ps(lt)) & 0x5));
+            }
+        } else {
+            const __m128i flip = _mm_set1_epi64x(std::is_signed_v<K> ? 0 : std::numeric_limits<std::int64_t>::min());
+            const __m128i k = _mm_xor_si128(_mm_set1_epi64x(static_cast<std::int64_t>(key)), flip);
+            for (std::size_t r = 0; r < search_window_bytes / 16; ++r) {
+                __m128i lt = _mm_cmpgt_epi64(k, _mm_xor_si128(_mm_loadu_si128(v + r), flip));
+                c += static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(lt)) & 0x1);
+            }
+        }
+        return c;
+    }
+};
+
+struct avx2_window {
+    template <typename K>
+    MYSTL_TARGET_AVX2 static std::size_t count(const K* p, K key) noexcept {
+        const __m256i* v = reinterpret_cast<const __m256i*>(p);
+        unsigned c = 0;
+        if constexpr (sizeof(K) == 4) {
+            const __m256i flip = _mm256_set1_epi32(std::is_signed_v<K> ? 0 : std::numeric_limits<std::int32_t>::min());
+            const __m256i k = _mm256_xor_si256(_mm256_set1_epi32(static_cast<std::int32_t>(key)), flip);
+            for (std::size_t r = 0; r < search_window_bytes / 32; ++r) {
+                __m256i lt = _mm256_cmpgt_epi32(k, _mm256_xor_si256(_mm256_loadu_si256(v + r), flip));
+                c += static_cast<unsigned>(_mm_popcnt_u32(_mm256_movemask_ps(_mm256_castsi256_ps(lt)) & 0x55));
+            }
+        } else {
+            const __m256i flip = _mm256_set1_epi64x(std::is_signed_v<K> ? 0 : std::numeric_limits<std::int64_t>::min());
+            const __m256i k = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<std::int64_t>(key)), flip);
+            for (std::size_t r = 0; r < search_window_bytes / 32; ++r) {
+                __m256i lt = _mm256_cmpgt_epi64(k, _mm256_xor_si256(_mm256_loadu_si256(v + r), flip));
+                c += static_cast<unsigned>(_mm_popcnt_u32(_mm256_movemask_pd(_mm256_castsi256_pd(lt)) & 0x5));
+            }
+        }
+        return c;
+    }
+};
+
+// AVX-512 直接支持无符号比较
+struct avx512_window {
+    template <typename K>
+    MYSTL_TARGET_AVX512 static std::size_t count(const K* p, K key) noexcept {
+        unsigned c = 0;
+        for (std::size_t r = 0; r < search_window_bytes / 64; ++r) {
+            __m512i x = _mm512_loadu_si512(p + r * 64 / sizeof(K));
+            if constexpr (sizeof(K) == 4) {
+                const __m512i k = _mm512_set1_epi32(static_cast<std::int32_t>(key));
+                __mmask16 lt = std::is_signed_v<K> ? _mm512_cmplt_epi32_mask(x, k) : _mm512_cmplt_epu32_mask(x, k);
+                c += static_cast<unsigned>(_mm_popcnt_u32(lt & 0x5555u));
+            } else {
+                const __m512i k = _mm512_set1_epi64(static_cast<std::int64_t>(key));
+                __mmask8 lt = std::is_signed_v<K> ? _mm512_cmplt_epi64_mask(x, k) : _mm512_cmplt_epu64_mask(x, k);
+                c += static_cast<unsigned>(_mm_popcnt_u32(lt & 0x55u));
+            }
+        }
+        return c;
+    }
+};
+
+#endif // MYSTL_X86_DISPATCH
+
+// ============================================================================
+// 查找核心
+// ============================================================================
+
+// 结果位于 [base, base + len]；len 不超过窗口后，从 min(base, n - W) 起扫描整个窗口:
+// 窗口内 base 之前的元素都小于 key，base + len 之后的元素都不小于 key
+template <typename Window, typename K>
+inline std::size_t lower_bound_core(const K* data, std::size_t n, K key) noexcept {
+    constexpr std::size_t W = search_window<K>;
+    if (n < W) {
+        std::size_t c = 0;
+        for (std::size_t i = 0; i < n; ++i) c += data[2 * i] < key;
+        return c;
+    }
+    std::size_t base = 0;
+    std::size_t len = n;
+    while (len > W) {
+        std::size_t half = len / 2;
+        std::size_t rest = len - half;
+        // 下一步的探测位置只可能是这两个之一
+        prefetch_read(data + 2 * (base + rest / 2));
+        prefetch_read(data + 2 * (base + half + rest / 2));
+        base = data[2 * (base + half)] < key ? base + half : base;
+        len = rest;
+    }
+    std::size_t start = std::min(base, n - W);
+    return start + Window::count(data + 2 * start, key);
+}
+
+template <typename Window, typename K>
+inline void lower_bound_batch_core(const K* data, std::size_t n, const K* keys, std::size_t m,
+                                   std::size_t* out) noexcept {
+    constexpr std::size_t W = search_window<K>;
+    if (n < W) {
+        for (std::size_t j = 0; j < m; ++j) out[j] = lower_bound_core<Window>(data, n, keys[j]);
+        return;
+    }
+    for (std::size_t j = 0; j < m; j += search_batch_group) {
+        const std::size_t g = std::min(search_batch_group, m - j);
+        std::size_t base[search_batch_group] = {};
+        // 所有键的剩余长度序列相同，只有 base 不同
+        std::size_t len = n;
+        while (len > W) {
+            std::size_t half = len / 2;
+            std::size_t rest = len - half;
+            for (std::size_t k = 0; k < g; ++k) {
+                base[k] = data[2 * (base[k] + half)] < keys[j + k] ? base[k] + half : base[k];
+                prefetch_read(data + 2 * (base[k] + rest / 2));
+            }
+            len = rest;
+        }
+        for (std::size_t k = 0; k < g; ++k) {
+            std::size_t start = std::min(base[k], n - W);
+            out[j + k] = start + Window::count(data + 2 * start, keys[j + k]);
+        }
+    }
+}
+
+template <typename K>
+inline std::size_t lower_bound_scalar(const K* data, std::size_t n, K key) {
+    return lower_bound_core<scalar_window>(data, n, key);
+}
+
+template <typename K>
+inline void lower_bound_batch_scalar(const K* data, std::size_t n, const K* keys, std::size_t m, std::size_t* out) {
+    lower_bound_batch_core<scalar_window>(data, n, keys, m, out);
+}
+
+#if MYSTL_X86_DISPATCH
+
+template <typename K>
+MYSTL_TARGET_SSE42 inline std::size_t lower_bound_sse42(const K* data, std::size_t n, K key) {
+    return lower_bound_core<sse42_window>(data, n, key);
+}
+
+template <typename K>
+MYSTL_TARGET_SSE42 inline void lower_bound_batch_sse42(const K* data, std::size_t n, const K* keys, std::size_t m,
+                                                       std::size_t* out) {
+    lower_bound_batch_core<sse42_window>(data, n, keys, m, out);
+}
+
+template <typename K>
+MYSTL_TARGET_AVX2 inline std::size_t lower_bound_avx2(const K* data, std::size_t n, K key) {
+    return lower_bound_core<avx2_window>(data, n, key);
+}
+
+template <typename K>
+MYSTL_TARGET_AVX2 inline void lower_bound_batch_avx2(const K* data, std::size_t n, const K* keys, std::size_t m,
+                                                     std::size_t* out) {
+    lower_bound_batch_core<avx2_window>(data, n, keys, m, out);
+}
+
+template <typename K>
+MYSTL_TARGET_AVX512 inline std::size_t lower_bound_avx512(const K* data, std::size_t n, K key) {
+    return lower_bound_core<avx512_window>(data, n, key);
+}
+
+template <typename K>
+MYSTL_TARGET_AVX512 inline void lower_bound_batch_avx512(const K* data, std::size_t n, const K* keys, std::size_t m,
+                                                         std::size_t* out) {
+    lower_bound_batch_core<avx512_window>(data, n, keys, m, out);
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+// ============================================================================
+// 分派表
+// ============================================================================
+
+template <typename K>
+inline const simd::dispatch_table<lower_bound_fn<K>>& lower_bound_table() {
+    static const simd::dispatch_table<lower_bound_fn<K>> table = MYSTL_DISPATCH_TABLE(
+        &lower_bound_scalar<K>, &lower_bound_sse42<K>, &lower_bound_avx2<K>, &lower_bound_avx512<K>);
+    return table;
+}
+
+template <typename K>
+inline const simd::dispatch_table<lower_bound_batch_fn<K>>& lower_bound_batch_table() {
+    static const simd::dispatch_table<lower_bound_batch_fn<K>> table = MYSTL_DISPATCH_TABLE(
+        &lower_bound_batch_scalar<K>, &lower_bound_batch_sse42<K>, &lower_bound_batch_avx2<K>,
+        &lower_bound_batch_avx512<K>);
+    return table;
+}
+
+// 不满足 SIMD 条件的 pair 使用的无分支二分
+template <typename K, typename V>
+inline std::size_t lower_bound_generic(const pair<K, V>* data, std::size_t n, const K& key) noexcept {
+    std::size_t base = 0;
+    std::size_t len = n;
+    while (len > 1) {
+        std::size_t half = len / 2;
+        base = data[base + half].first < key ? base + half : base;
+        len -= half;
+    }
+    return n == 0 ? 0 : base + (data[base].first < key);
+}
+
+} // namespace detail
+
+// ============================================================================
+// 公共接口
+// ============================================================================
+
+// [first, last) 按 first 升序排列时，返回第一个 first >= key 的元素
+template <typename K, typename V>
+inline const pair<K, V>* lower_bound_first(const pair<K, V>* first, const pair<K, V>* last,
+                                          const detail::type_identity_t<K>& key) {
+    static_assert(std::is_integral_v<K>, "lower_bound_first requires an integral first member");
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if constexpr (detail::is_simd_searchable_v<K, V>) {
+        static const auto fn = detail::lower_bound_table<K>().resolve();
+        return first + fn(reinterpret_cast<const K*>(first), n, key);
+    } else {
+        return first + detail::lower_bound_generic(first, n, key);
+    }
+}
+
+// first 等于 key 的元素范围
+template <typename K, typename V>
+inline pair<const pair<K, V>*, const pair<K, V>*> equal_range_first(const pair<K, V>* first,
+                                                                    const pair<K, V>* last,
+                                                                    const detail::type_identity_t<K>& key) {
+    const pair<K, V>* lo = lower_bound_first(first, last, key);
+    // 整数键的上界即 key + 1 的下界
+    const pair<K, V>* hi = key == std::numeric_limits<K>::max()
+        ? last
+        : lower_bound_first(lo, last, static_cast<K>(key + 1));
+    return pair<const pair<K, V>*, const pair<K, V>*>(lo, hi);
+}
+
+// 批量查找: out[j] 为 keys[j] 的 lower_bound 下标 (相对 first)
+template <typename K, typename V>
+inline void lower_bound_first_batch(const pair<K, V>* first, const pair<K, V>* last,
+                                    const detail::type_identity_t<K>* keys,
+                                    std::size_t m, std::size_t* out) {
+    static_assert(std::is_integral_v<K>, "lower_bound_first_batch requires an integral first member");
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if constexpr (detail::is_simd_searchable_v<K, V>) {
+        static const auto fn = detail::lower_bound_batch_table<K>().resolve();
+        fn(reinterpret_cast<const K*>(first), n, keys, m, out);
+    } else {
+        for (std::size_t j = 0; j < m; ++j) out[j] = detail::lower_bound_generic(first, n, keys[j]);
+    }
+}
+
+} // namespace my_stl
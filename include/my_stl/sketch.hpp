@@ -0,0 +1,490 @@
+/*
+    关键特性说明
+    1. count_min_sketch<K1, K2>
+        depth 行 × width 列 (width 为 2 的幂) 的 32 位计数器，键 pair<K1, K2> 由 pair_hash 求 64 位哈希，
+        与种子混合后按 Kirsch–Mitzenmacher 双重哈希得到每行的列 col_i = (h1 + i · h2) & (width - 1)；
+        estimate 取各行计数的最小值，从不低估，以 1 - δ 的概率高估不超过 ε · 总数
+        (from_error(ε, δ) 取 width = 2^⌈log2(e / ε)⌉，depth = ⌈ln(1 / δ)⌉)
+
+    2. 保守更新
+        cms_update::conservative 时各行只提高到 min + count，已经更大的计数不变，高估明显减少；
+        代价是不再是线性草图，合并后的结果仍是上界
+
+    3. SIMD 行更新
+        depth ≤ 8 时 AVX2 / AVX-512 内核在一个向量中同时计算所有行的下标，gather 读出计数并求最小值；
+        保守更新用向量求出新值后逐行标量写回 (实测 AVX-512 scatter 与普通更新的 gather 都比标量慢，
+        因此普通更新走标量路径，AVX-512 等级的更新使用 AVX2 内核)；计数饱和在 UINT32_MAX；
+        add_batch / estimate_batch 先批量求哈希，处理每个键时预取后面第 cms_prefetch_distance 个键的各行
+
+    4. 合并
+        merge 逐个计数器饱和相加，要求宽度、深度、种子和更新方式相同；
+        各线程各自维护一个草图，最后合并
+
+    5. space_saving<K1, K2>
+        Space-Saving top-k：最多 k 个 (键, 计数, 误差) 条目，键索引为 32 位下标的开放寻址表，
+        计数的最小堆给出替换对象；未跟踪的键替换计数最小的条目并继承其计数作为误差；
+        出现次数超过 总数 / k 的键一定在表中，count - error 是真实次数的下界；
+        merge 按可合并摘要的方法 (Agarwal et al.) 合并两个摘要后保留计数最大的 k 个
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "hash.hpp"
+#include "cpu_dispatch.hpp"
+#include "detail/aligned_allocator.hpp"
+#include "detail/hash.hpp"
+#include "detail/prefetch.hpp"
+#include "detail/slot_table.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace my_stl {
+
+enum class cms_update { standard, conservative };
+
+namespace detail {
+
+// SIMD 内核一个向量容纳的最大行数
+inline constexpr std::size_t cms_simd_depth = 8;
+inline constexpr std::size_t cms_prefetch_distance = 8;
+// add_batch / estimate_batch 每次在栈上求哈希的键数
+inline constexpr std::size_t cms_batch = 256;
+
+inline std::uint32_t saturating_add(std::uint32_t a, std::uint32_t b) noexcept {
+    std::uint32_t s = a + b;
+    return s < a ? std::numeric_limits<std::uint32_t>::max() : s;
+}
+
+inline std::size_t cms_index(std::uint64_t h, std::size_t row, std::size_t width) noexcept {
+    auto h1 = static_cast<std::uint32_t>(h);
+    auto h2 = static_cast<std::uint32_t>(h >> 32) | 1u;
+    return row * width + ((h1 + static_cast<std::uint32_t>(row) * h2) & static_cast<std::uint32_t>(width - 1));
+}
+
+inline void cms_prefetch(const std::uint32_t* table, std::size_t width, std::size_t depth, std::uint64_t h) noexcept {
+    for (std::size_t r = 0; r < depth; ++r) prefetch_write(table + cms_index(h, r, width));
+}
+
+using cms_update_fn = void (*)(std::uint32_t* table, std::size_t width, std::size_t depth, const std::uint64_t* hashes,
+                               std::size_t n, std::uint32_t count, bool conservative);
+using cms_estimate_fn = void (*)(const std::uint32_t* table, std::size_t width, std::size_t depth,
+                                 const std::uint64_t* hashes, std::size_t n, std::uint32_t* out);
+
+// ==================== 标量内核 ====================
+
+inline void cms_update_scalar(std::uint32_t* table, std::size_t width, std::size_t depth, const std::uint64_t* hashes,
+                              std::size_t n, std::uint32_t count, bool conservative) {
+    for (std::size_t k = 0; k < n; ++k) {
+        if (k + cms_prefetch_distance < n) cms_prefetch(table, width, depth, hashes[k + cms_prefetch_distance]);
+        const std::uint64_t h = hashes[k];
+        if (!conservative) {
+            for (std::size_t r = 0; r < depth; ++r) {
+                std::uint32_t& c = table[cms_index(h, r, width)];
+                c = saturating_add(c, count);
+            }
+            continue;
+        }
+        std::uint32_t lo = std::numeric_limits<std::uint32_t>::max();
+        for (std::size_t r = 0; r < depth; ++r) lo = std::min(lo, table[cms_index(h, r, width)]);
+        const std::uint32_t target = saturating_add(lo, count);
+        for (std::size_t r = 0; r < depth; ++r) {
+            std::uint32_t& c = table[cms_index(h, r, width)];
+            c = std::max(c, target);
+        }
+    }
+}
+
+inline void cms_estimate_scalar(const std::uint32_t* table, std::size_t width, std::size_t depth,
+                                const std::uint64_t* hashes, std::size_t n, std::uint32_t* out) {
+    for (std::size_t k = 0; k < n; ++k) {
+        if (k + cms_prefetch_distance < n) cms_prefetch(table, width, depth, hashes[k + cms_prefetch_distance]);
+        std::uint32_t lo = std::numeric_limits<std::uint32_t>::max();
+        for (std::size_t r = 0; r < depth; ++r) lo = std::min(lo, table[cms_index(hashes[k], r, width)]);
+        out[k] = lo;
+    }
+}
+
+#if MYSTL_X86_DISPATCH
+
+// ==================== AVX2 内核 ====================
+
+// 8 行的下标：row * width + ((h1 + row * h2) & (width - 1))
+MYSTL_TARGET_AVX2 inline __m256i cms_indices_avx2(std::uint64_t h, __m256i rows, __m256i row_base, __m256i col_mask) {
+    const __m256i h1 = _mm256_set1_epi32(static_cast<int>(static_cast<std::uint32_t>(h)));
+    const __m256i h2 = _mm256_set1_epi32(static_cast<int>(static_cast<std::uint32_t>(h >> 32) | 1u));
+    const __m256i col = _mm256_and_si256(_mm256_add_epi32(h1, _mm256_mullo_epi32(rows, h2)), col_mask);
+    return _mm256_add_epi32(row_base, col);
+}
+
+MYSTL_TARGET_AVX2 inline std::uint32_t hmin_epu32_avx2(__m256i v) {
+    __m128i m = _mm_min_epu32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    m = _mm_min_epu32(m, _mm_shuffle_epi32(m, 0x4E));
+    m = _mm_min_epu32(m, _mm_shuffle_epi32(m, 0xB1));
+    return static_cast<std::uint32_t>(_mm_cvtsi128_si32(m));
+}
+
+MYSTL_TARGET_AVX2 inline void cms_update_avx2(std::uint32_t* table, std::size_t width, std::size_t depth,
+                                              const std::uint64_t* hashes, std::size_t n, std::uint32_t count,
+                                              bool conservative) {
+    // 普通更新每行只做一次读改写，gather 加标量写回比标量循环慢
+    if (!conservative || depth > cms_simd_depth) {
+        return cms_update_scalar(table, width, depth, hashes, n, count, conservative);
+    }
+    const __m256i rows = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i row_base = _mm256_mullo_epi32(rows, _mm256_set1_epi32(static_cast<int>(width)));
+    const __m256i col_mask = _mm256_set1_epi32(static_cast<int>(width - 1));
+    const __m256i active = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(depth)), rows);
+    const __m256i all_ones = _mm256_set1_epi32(-1);
+    alignas(32) std::uint32_t idx[8];
+    alignas(32) std::uint32_t val[8];
+    for (std::size_t k = 0; k < n; ++k) {
+        if (k + cms_prefetch_distance < n) cms_prefetch(table, width, depth, hashes[k + cms_prefetch_distance]);
+        const __m256i vidx = cms_indices_avx2(hashes[k], rows, row_base, col_mask);
+        // 未使用的行读作 UINT32_MAX，不影响最小值
+        const __m256i c = _mm256_mask_i32gather_epi32(all_ones, reinterpret_cast<const int*>(table), vidx, active, 4);
+        const std::uint32_t target = saturating_add(hmin_epu32_avx2(c), count);
+        const __m256i next = _mm256_max_epu32(c, _mm256_set1_epi32(static_cast<int>(target)));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(idx), vidx);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(val), next);
+        for (std::size_t r = 0; r < depth; ++r) table[idx[r]] = val[r];
+    }
+}
+
+MYSTL_TARGET_AVX2 inline void cms_estimate_avx2(const std::uint32_t* table, std::size_t width, std::size_t depth,
+                                                const std::uint64_t* hashes, std::size_t n, std::uint32_t* out) {
+    if (depth > cms_simd_depth) return cms_estimate_scalar(table, width, depth, hashes, n, out);
+    const __m256i rows = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i row_base = _mm256_mullo_epi32(rows, _mm256_set1_epi32(static_cast<int>(width)));
+    const __m256i col_mask = _mm256_set1_epi32(static_cast<int>(width - 1));
+    const __m256i active = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(depth)), rows);
+    const __m256i all_ones = _mm256_set1_epi32(-1);
+    for (std::size_t k = 0; k < n; ++k) {
+        if (k + cms_prefetch_distance < n) cms_prefetch(table, width, depth, hashes[k + cms_prefetch_distance]);
+        const __m256i vidx = cms_indices_avx2(hashes[k], rows, row_base, col_mask);
+        out[k] = hmin_epu32_avx2(
+            _mm256_mask_i32gather_epi32(all_ones, reinterpret_cast<const int*>(table), vidx, active, 4));
+    }
+}
+
+// ==================== AVX-512 内核 ====================
+
+MYSTL_TARGET_AVX512 inline void cms_estimate_avx512(const std::uint32_t* table, std::size_t width, std::size_t depth,
+                                                    const std::uint64_t* hashes, std::size_t n, std::uint32_t* out) {
+    if (depth > cms_simd_depth) return cms_estimate_scalar(table, width, depth, hashes, n, out);
+    const __m256i rows = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i row_base = _mm256_mullo_epi32(rows, _mm256_set1_epi32(static_cast<int>(width)));
+    const __m256i col_mask = _mm256_set1_epi32(static_cast<int>(width - 1));
+    const auto active = static_cast<__mmask8>((1u << depth) - 1);
+    const __m256i all_ones = _mm256_set1_epi32(-1);
+    for (std::size_t k = 0; k < n; ++k) {
+        if (k + cms_prefetch_distance < n) cms_prefetch(table, width, depth, hashes[k + cms_prefetch_distance]);
+        const __m256i vidx = cms_indices_avx2(hashes[k], rows, row_base, col_mask);
+        out[k] = hmin_epu32_avx2(_mm256_mmask_i32gather_epi32(all_ones, active, vidx, table, 4));
+    }
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+inline const simd::dispatch_table<cms_update_fn>& cms_update_table() {
+    static const simd::dispatch_table<cms_update_fn> table =
+        MYSTL_DISPATCH_TABLE(&cms_update_scalar, nullptr, &cms_update_avx2, nullptr);
+    return table;
+}
+
+inline const simd::dispatch_table<cms_estimate_fn>& cms_estimate_table() {
+    static const simd::dispatch_table<cms_estimate_fn> table =
+        MYSTL_DISPATCH_TABLE(&cms_estimate_scalar, nullptr, &cms_estimate_avx2, &cms_estimate_avx512);
+    return table;
+}
+
+} // namespace detail
+
+// ============================================================================
+// count_min_sketch
+// ============================================================================
+
+template <typename K1, typename K2, typename Hash = pair_hash>
+class count_min_sketch {
+public:
+    using key_type = pair<K1, K2>;
+    using counter_type = std::uint32_t;
+
+    // width 向上取整为 2 的幂
+    explicit count_min_sketch(std::size_t width, std::size_t depth = 4, cms_update mode = cms_update::standard,
+                              std::uint64_t seed = 0)
+        : depth_(depth), mode_(mode), seed_(seed) {
+        std::size_t w = 1;
+        while (w < width) w <<= 1;
+        width_ = w;
+        assert(depth > 0 && width_ * depth <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()));
+        table_.assign(width_ * depth_, 0);
+    }
+
+    // 高估不超过 epsilon · 总数 的概率至少为 1 - delta
+    static count_min_sketch from_error(double epsilon, double delta, cms_update mode = cms_update::standard,
+                                       std::uint64_t seed = 0) {
+        assert(epsilon > 0 && delta > 0 && delta < 1);
+        auto width = static_cast<std::size_t>(std::ceil(std::exp(1.0) / epsilon));
+        auto depth = static_cast<std::size_t>(std::ceil(std::log(1.0 / delta)));
+        return count_min_sketch(width, std::max<std::size_t>(1, depth), mode, seed);
+    }
+
+    void add(const key_type& key, counter_type count = 1) {
+        const std::uint64_t h = hash_of(key);
+        update_fn()(table_.data(), width_, depth_, &h, 1, count, mode_ == cms_update::conservative);
+        total_ += count;
+    }
+
+    void add_batch(const key_type* keys, std::size_t n, counter_type count = 1) {
+        std::uint64_t hashes[detail::cms_batch];
+        for (std::size_t i = 0; i < n; i += detail::cms_batch) {
+            const std::size_t m = std::min(detail::cms_batch, n - i);
+            for (std::size_t k = 0; k < m; ++k) hashes[k] = hash_of(keys[i + k]);
+            update_fn()(table_.data(), width_, depth_, hashes, m, count, mode_ == cms_update::conservative);
+        }
+        total_ += static_cast<std::uint64_t>(count) * n;
+    }
+
+    counter_type estimate(const key_type& key) const {
+        const std::uint64_t h = hash_of(key);
+        counter_type out;
+        estimate_fn()(table_.data(), width_, depth_, &h, 1, &out);
+        return out;
+    }
+
+    void estimate_batch(const key_type* keys, std::size_t n, counter_type* out) const {
+        std::uint64_t hashes[detail::cms_batch];
+        for (std::size_t i = 0; i < n; i += detail::cms_batch) {
+            const std::size_t m = std::min(detail::cms_batch, n - i);
+            for (std::size_t k = 0; k < m; ++k) hashes[k] = hash_of(keys[i + k]);
+            estimate_fn()(table_.data(), width_, depth_, hashes, m, out + i);
+        }
+    }
+
+    // 逐个计数器饱和相加，两个草图的参数必须相同
+    void merge(const count_min_sketch& other) {
+        assert(width_ == other.width_ && depth_ == other.depth_ && seed_ == other.seed_ && mode_ == other.mode_);
+        counter_type* dst = table_.data();
+        const counter_type* src = other.table_.data();
+        for (std::size_t i = 0, size = table_.size(); i < size; ++i) {
+            const counter_type sum = dst[i] + src[i];
+            dst[i] = sum < dst[i] ? std::numeric_limits<counter_type>::max() : sum;
+        }
+        total_ += other.total_;
+    }
+
+    void clear() noexcept {
+        std::fill(table_.begin(), table_.end(), counter_type(0));
+        total_ = 0;
+    }
+
+    std::size_t width() const noexcept { return width_; }
+    std::size_t depth() const noexcept { return depth_; }
+    cms_update mode() const noexcept { return mode_; }
+    std::uint64_t total() const noexcept { return total_; }
+    std::size_t memory_usage() const noexcept { return table_.capacity() * sizeof(counter_type); }
+
+private:
+    static detail::cms_update_fn update_fn() {
+        static const detail::cms_update_fn fn = detail::cms_update_table().resolve();
+        return fn;
+    }
+
+    static detail::cms_estimate_fn estimate_fn() {
+        static const detail::cms_estimate_fn fn = detail::cms_estimate_table().resolve();
+        return fn;
+    }
+
+    std::uint64_t hash_of(const key_type& key) const {
+        return detail::hash_mix64(static_cast<std::uint64_t>(Hash{}(key)) ^ seed_);
+    }
+
+    std::vector<counter_type, detail::aligned_allocator<counter_type, 64>> table_;
+    std::size_t width_ = 0;
+    std::size_t depth_ = 0;
+    cms_update mode_;
+    std::uint64_t seed_;
+    std::uint64_t total_ = 0;
+};
+
+// ============================================================================
+// space_saving: top-k 频繁项
+// ============================================================================
+
+template <typename K1, typename K2, typename Hash = pair_hash, typename KeyEqual = std::equal_to<pair<K1, K2>>>
+class space_saving {
+public:
+    using key_type = pair<K1, K2>;
+
+    struct counter {
+        key_type key;
+        std::uint64_t count;
+        std::uint64_t error;   // 继承的计数，真实次数在 [count - error, count] 内
+    };
+
+    explicit space_saving(std::size_t k) : k_(k) {
+        assert(k > 0 && k < detail::slot_nil);
+        entries_.reserve(k);
+        hashes_.reserve(k);
+        heap_.reserve(k);
+        heap_pos_.reserve(k);
+        std::size_t buckets = 8;
+        while (buckets < k * 2) buckets <<= 1;
+        index_.reset(buckets);
+    }
+
+    void offer(const key_type& key, std::uint64_t count = 1) {
+        total_ += count;
+        const std::uint64_t h = hash_of(key);
+        std::uint32_t s = find_slot(key, h);
+        if (s != detail::slot_nil) {
+            entries_[s].count += count;
+            sift_down(heap_pos_[s]);
+            return;
+        }
+        if (entries_.size() < k_) {
+            s = static_cast<std::uint32_t>(entries_.size());
+            entries_.push_back(counter{key, count, 0});
+            hashes_.push_back(h);
+            heap_pos_.push_back(static_cast<std::uint32_t>(heap_.size()));
+            heap_.push_back(s);
+            index_.insert(h, s);
+            sift_up(heap_pos_[s]);
+            return;
+        }
+        // 替换计数最小的条目，它的计数成为新键的误差
+        s = heap_[0];
+        index_.erase(hashes_[s], s, [&](std::uint32_t t) { return hashes_[t]; });
+        counter& e = entries_[s];
+        e.key = key;
+        e.error = e.count;
+        e.count += count;
+        hashes_[s] = h;
+        index_.insert(h, s);
+        sift_down(0);
+    }
+
+    void offer_batch(const key_type* keys, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) offer(keys[i]);
+    }
+
+    const counter* find(const key_type& key) const {
+        std::uint32_t s = find_slot(key, hash_of(key));
+        return s == detail::slot_nil ? nullptr : &entries_[s];
+    }
+
+    // 计数最大的 n 个条目，按计数降序
+    std::vector<counter> top(std::size_t n) const {
+        std::vector<counter> out(entries_.begin(), entries_.end());
+        auto by_count = [](const counter& a, const counter& b) { return a.count > b.count; };
+        n = std::min(n, out.size());
+        std::partial_sort(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(n), out.end(), by_count);
+        out.resize(n);
+        return out;
+    }
+
+    // 未跟踪的键的真实次数不超过 min_count()
+    std::uint64_t min_count() const noexcept { return entries_.size() < k_ ? 0 : entries_[heap_[0]].count; }
+
+    // 两边都跟踪的键计数相加，只在一边的键加上另一边的 min_count 作为计数和误差，再保留前 k 个
+    void merge(const space_saving& other) {
+        const std::uint64_t own_min = min_count();
+        const std::uint64_t other_min = other.min_count();
+        std::vector<counter> merged;
+        merged.reserve(entries_.size() + other.entries_.size());
+        for (const auto& e : entries_) {
+            if (const counter* o = other.find(e.key)) {
+                merged.push_back(counter{e.key, e.count + o->count, e.error + o->error});
+            } else {
+                merged.push_back(counter{e.key, e.count + other_min, e.error + other_min});
+            }
+        }
+        for (const auto& o : other.entries_) {
+            if (!find(o.key)) merged.push_back(counter{o.key, o.count + own_min, o.error + own_min});
+        }
+        auto by_count = [](const counter& a, const counter& b) { return a.count > b.count; };
+        if (merged.size() > k_) {
+            std::nth_element(merged.begin(), merged.begin() + static_cast<std::ptrdiff_t>(k_), merged.end(), by_count);
+            merged.resize(k_);
+        }
+        const std::uint64_t total = total_ + other.total_;
+        clear();
+        total_ = total;
+        for (const auto& e : merged) {
+            auto s = static_cast<std::uint32_t>(entries_.size());
+            entries_.push_back(e);
+            hashes_.push_back(hash_of(e.key));
+            heap_pos_.push_back(s);
+            heap_.push_back(s);
+            index_.insert(hashes_[s], s);
+        }
+        for (std::size_t i = heap_.size() / 2; i-- > 0;) sift_down(i);
+    }
+
+    void clear() {
+        entries_.clear();
+        hashes_.clear();
+        heap_.clear();
+        heap_pos_.clear();
+        index_.reset(index_.buckets());
+        total_ = 0;
+    }
+
+    std::size_t size() const noexcept { return entries_.size(); }
+    std::size_t capacity() const noexcept { return k_; }
+    std::uint64_t total() const noexcept { return total_; }
+
+private:
+    static std::uint64_t hash_of(const key_type& key) {
+        return detail::hash_mix64(static_cast<std::uint64_t>(Hash{}(key)));
+    }
+
+    std::uint32_t find_slot(const key_type& key, std::uint64_t h) const {
+        return index_.find(h, [&](std::uint32_t s) { return KeyEqual{}(entries_[s].key, key); });
+    }
+
+    std::uint64_t count_at(std::size_t i) const noexcept { return entries_[heap_[i]].count; }
+
+    void swap_heap(std::size_t a, std::size_t b) noexcept {
+        std::swap(heap_[a], heap_[b]);
+        heap_pos_[heap_[a]] = static_cast<std::uint32_t>(a);
+        heap_pos_[heap_[b]] = static_cast<std::uint32_t>(b);
+    }
+
+    void sift_up(std::size_t i) noexcept {
+        while (i > 0 && count_at(i) < count_at((i - 1) / 2)) {
+            swap_heap(i, (i - 1) / 2);
+            i = (i - 1) / 2;
+        }
+    }
+
+    void sift_down(std::size_t i) noexcept {
+        for (;;) {
+            std::size_t smallest = i;
+            std::size_t l = 2 * i + 1;
+            if (l < heap_.size() && count_at(l) < count_at(smallest)) smallest = l;
+            if (l + 1 < heap_.size() && count_at(l + 1) < count_at(smallest)) smallest = l + 1;
+            if (smallest == i) return;
+            swap_heap(i, smallest);
+            i = smallest;
+        }
+    }
+
+    std::size_t k_;
+    std::vector<counter> entries_;
+    std::vector<std::uint64_t> hashes_;
+    std::vector<std::uint32_t> heap_;       // 按计数的最小堆，元素为条目下标
+    std::vector<std::uint32_t> heap_pos_;   // 条目在堆中的位置
+    detail::slot_table index_;
+    std::uint64_t total_ = 0;
+};
+
+} // namespace my_stl
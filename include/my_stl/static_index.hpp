@@ -0,0 +1,175 @@
+/*
+    关键特性说明
+    1. 只读静态索引
+        static_index<K, V> 一次性从 pair<K, V> 序列构建 (未排序时先按 first 稳定排序)，
+        之后只支持查询: find (点查)、predecessor (最大的 <= key)、successor (最小的 >= key)
+
+    2. Eytzinger 布局
+        键按完全二叉树的广度优先顺序存放 (下标从 1 开始，节点 i 的子节点为 2i 和 2i+1)，
+        查找时访问的前几层集中在少数缓存行中；键与值分开存放，键数组更紧凑
+        值只在命中后访问一次
+
+    3. 预取后代
+        键数组按缓存行对齐，节点 i 往下 log2(B) 层的 B 个后代 (B = 每个缓存行的键数)
+        恰好位于一个缓存行内，每一步预取该缓存行，使内存访问与比较重叠；
+        查找循环体无分支，迭代次数为 ⌊log2 n⌋ 或 ⌊log2 n⌋ + 1 (n 不是 2^k − 1 时取决于查找路径)，
+        只有循环的退出判断可能预测失败
+
+    4. 结果还原
+        下降结束后下标的二进制位记录了左右转向，最后一次右转 (或左转) 的节点
+        即前驱 (或后继)，用一次 ctz 得到
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "detail/aligned_allocator.hpp"
+#include "detail/prefetch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace my_stl {
+
+namespace detail {
+
+inline unsigned ctz64(std::uint64_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(v));
+#else
+    unsigned r = 0;
+    while (!(v & 1)) {
+        v >>= 1;
+        ++r;
+    }
+    return r;
+#endif
+}
+
+} // namespace detail
+
+template <typename K, typename V>
+class static_index {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = pair<K, V>;
+    using size_type = std::size_t;
+
+    static_index() = default;
+
+    template <typename InputIt>
+    static_index(InputIt first, InputIt last) {
+        std::vector<value_type> sorted(first, last);
+        auto by_first = [](const value_type& a, const value_type& b) { return a.first < b.first; };
+        if (!std::is_sorted(sorted.begin(), sorted.end(), by_first)) {
+            std::stable_sort(sorted.begin(), sorted.end(), by_first);
+        }
+        build(sorted);
+    }
+
+    explicit static_index(const std::vector<value_type>& data)
+        : static_index(data.begin(), data.end()) {}
+
+    size_type size() const noexcept { return n_; }
+    bool empty() const noexcept { return n_ == 0; }
+
+    // 键数组与值数组占用的字节数
+    size_type memory_usage() const noexcept {
+        return keys_.capacity() * sizeof(K) + values_.capacity() * sizeof(V);
+    }
+
+    // 点查；键重复时返回排序后第一个的值
+    const V* find(const K& key) const noexcept {
+        size_type pos = successor_pos(key);
+        return pos != 0 && !(key < keys_[pos]) ? &values_[pos - 1] : nullptr;
+    }
+
+    bool contains(const K& key) const noexcept { return find(key) != nullptr; }
+
+    // first <= key 的最大元素
+    std::optional<value_type> predecessor(const K& key) const {
+        size_type pos = predecessor_pos(key);
+        if (pos == 0) return std::nullopt;
+        return value_type(keys_[pos], values_[pos - 1]);
+    }
+
+    // first >= key 的最小元素
+    std::optional<value_type> successor(const K& key) const {
+        size_type pos = successor_pos(key);
+        if (pos == 0) return std::nullopt;
+        return value_type(keys_[pos], values_[pos - 1]);
+    }
+
+    // 按排序顺序访问 (中序遍历)，f(key, value)
+    template <typename Fn>
+    void for_each(Fn&& f) const {
+        for_each_from(1, f);
+    }
+
+private:
+    // 每个缓存行的键数，也是一次预取覆盖的后代个数
+    static constexpr size_type keys_per_line = sizeof(K) >= 64 ? 1 : 64 / sizeof(K);
+
+    void build(const std::vector<value_type>& sorted) {
+        n_ = sorted.size();
+        keys_.assign(n_ + 1, K());
+        values_.clear();
+        values_.reserve(n_);
+        values_.resize(n_, V());
+        size_type next = 0;
+        fill(sorted, 1, next);
+    }
+
+    // 中序遍历 Eytzinger 树依次放入排序后的元素；树高不超过 64，递归深度有界
+    void fill(const std::vector<value_type>& sorted, size_type i, size_type& next) {
+        if (i > n_) return;
+        fill(sorted, 2 * i, next);
+        keys_[i] = sorted[next].first;
+        values_[i - 1] = sorted[next].second;
+        ++next;
+        fill(sorted, 2 * i + 1, next);
+    }
+
+    void prefetch_descendants(size_type i) const noexcept {
+        // 越过数组末尾的预取不会出错，只是无效，因此用整数运算得到地址
+        auto addr = reinterpret_cast<std::uintptr_t>(keys_.data()) + keys_per_line * i * sizeof(K);
+        detail::prefetch_read(reinterpret_cast<const void*>(addr));
+    }
+
+    // 第一个 >= key 的节点 (最后一次左转)，不存在时为 0
+    size_type successor_pos(const K& key) const noexcept {
+        size_type i = 1;
+        while (i <= n_) {
+            prefetch_descendants(i);
+            i = 2 * i + static_cast<size_type>(keys_[i] < key);
+        }
+        return i >> (detail::ctz64(~static_cast<std::uint64_t>(i)) + 1);
+    }
+
+    // 最后一个 <= key 的节点 (最后一次右转)，不存在时为 0
+    size_type predecessor_pos(const K& key) const noexcept {
+        size_type i = 1;
+        while (i <= n_) {
+            prefetch_descendants(i);
+            i = 2 * i + static_cast<size_type>(!(key < keys_[i]));
+        }
+        return i >> (detail::ctz64(static_cast<std::uint64_t>(i)) + 1);
+    }
+
+    template <typename Fn>
+    void for_each_from(size_type i, Fn& f) const {
+        if (i > n_) return;
+        for_each_from(2 * i, f);
+        f(keys_[i], values_[i - 1]);
+        for_each_from(2 * i + 1, f);
+    }
+
+    size_type n_ = 0;
+    std::vector<K, detail::aligned_allocator<K, 64>> keys_;   // keys_[0] 不使用
+    std::vector<V> values_;                                    // values_[i - 1] 对应 keys_[i]
+};
+
+} // namespace my_stl
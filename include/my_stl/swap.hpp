@@ -0,0 +1,241 @@
+/*
+    关键特性说明
+    1. 区间交换
+        swap_ranges(first1, last1, first2) 交换两个不重叠的 pair 区间，返回 first2 + (last1 - first1)
+        成员都平凡可拷贝的 pair 按字节块交换，每次用一个 16/32/64 字节的寄存器读写两边；
+        其他类型逐元素调用 swap，与 std::swap_ranges 相同；含 const 成员的 pair 不可交换，编译期拒绝
+
+    2. 成员交换
+        swap_members(data, n) 把 pair<T, T> 数组中每个元素的 first 和 second 原地对调
+        (例如把边 (u, v) 反向为 (v, u))，一个寄存器一次处理多个 pair:
+        32/64 位成员用 pshufd 重排，8/16 位成员把 16/32 位通道左右移位后合并，
+        AVX-512 上 16/32 位成员直接用 vprord/vprorq 循环移位
+
+    3. 运行时分派
+        通过 cpu_dispatch.hpp 的 dispatch_table 选择 SSE4.2/AVX2/AVX-512 实现，
+        结果与标量实现逐位相同；成员大小不是 1/2/4/8 字节或 pair 含填充时逐元素交换
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "cpu_dispatch.hpp"
+#include "transpose.hpp"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace my_stl {
+
+namespace detail {
+
+// 交换 a[0..bytes) 与 b[0..bytes)，两段不重叠
+using swap_bytes_fn = void (*)(unsigned char* a, unsigned char* b, std::size_t bytes);
+
+inline void swap_bytes_scalar(unsigned char* a, unsigned char* b, std::size_t bytes) {
+    std::size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        std::uint64_t x, y;
+        std::memcpy(&x, a + i, 8);
+        std::memcpy(&y, b + i, 8);
+        std::memcpy(a + i, &y, 8);
+        std::memcpy(b + i, &x, 8);
+    }
+    for (; i < bytes; ++i) std::swap(a[i], b[i]);
+}
+
+// 交错数组 data[0..2n) 视为 n 个 (first, second)
+template <typename U>
+using swap_members_fn = void (*)(U* data, std::size_t n);
+
+// 与 transpose.hpp 的标量内核相同，成员可能是浮点，用 memcpy 搬运而不以 U 类型访问
+template <typename U>
+inline void swap_members_scalar(U* data, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        U a, b;
+        std::memcpy(&a, data + 2 * i, sizeof(U));
+        std::memcpy(&b, data + 2 * i + 1, sizeof(U));
+        std::memcpy(data + 2 * i, &b, sizeof(U));
+        std::memcpy(data + 2 * i + 1, &a, sizeof(U));
+    }
+}
+
+#if MYSTL_X86_DISPATCH
+
+// ============================================================================
+// SSE4.2 / AVX2: pair 不跨 16 字节通道，通道内重排即可
+// ============================================================================
+
+MYSTL_TARGET_SSE42 inline void swap_bytes_sse42(unsigned char* a, unsigned char* b, std::size_t bytes) {
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), y);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(b + i), x);
+    }
+    swap_bytes_scalar(a + i, b + i, bytes - i);
+}
+
+// 对调一个 16 字节通道内每个 pair 的两个成员
+template <typename U>
+MYSTL_TARGET_SSE42 inline __m128i swap_members_lane_sse42(__m128i x) {
+    if constexpr (sizeof(U) == 8) {
+        return _mm_shuffle_epi32(x, 0x4E);
+    } else if constexpr (sizeof(U) == 4) {
+        return _mm_shuffle_epi32(x, 0xB1);
+    } else if constexpr (sizeof(U) == 2) {
+        return _mm_or_si128(_mm_slli_epi32(x, 16), _mm_srli_epi32(x, 16));
+    } else {
+        return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+    }
+}
+
+template <typename U>
+MYSTL_TARGET_SSE42 inline void swap_members_sse42(U* data, std::size_t n) {
+    constexpr std::size_t step = 16 / (2 * sizeof(U));   // 每个寄存器包含的 pair 个数
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m128i* p = reinterpret_cast<__m128i*>(data + 2 * i);
+        _mm_storeu_si128(p, swap_members_lane_sse42<U>(_mm_loadu_si128(p)));
+    }
+    swap_members_scalar(data + 2 * i, n - i);
+}
+
+MYSTL_TARGET_AVX2 inline void swap_bytes_avx2(unsigned char* a, unsigned char* b, std::size_t bytes) {
+    std::size_t i = 0;
+    for (; i + 64 <= bytes; i += 64) {
+        __m256i x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32));
+        __m256i y0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i y1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), y0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i + 32), y1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), x0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i + 32), x1);
+    }
+    swap_bytes_scalar(a + i, b + i, bytes - i);
+}
+
+template <typename U>
+MYSTL_TARGET_AVX2 inline __m256i swap_members_lane_avx2(__m256i x) {
+    if constexpr (sizeof(U) == 8) {
+        return _mm256_shuffle_epi32(x, 0x4E);
+    } else if constexpr (sizeof(U) == 4) {
+        return _mm256_shuffle_epi32(x, 0xB1);
+    } else if constexpr (sizeof(U) == 2) {
+        return _mm256_or_si256(_mm256_slli_epi32(x, 16), _mm256_srli_epi32(x, 16));
+    } else {
+        return _mm256_or_si256(_mm256_slli_epi16(x, 8), _mm256_srli_epi16(x, 8));
+    }
+}
+
+template <typename U>
+MYSTL_TARGET_AVX2 inline void swap_members_avx2(U* data, std::size_t n) {
+    constexpr std::size_t step = 32 / (2 * sizeof(U));
+    std::size_t i = 0;
+    for (; i + 2 * step <= n; i += 2 * step) {
+        __m256i* p = reinterpret_cast<__m256i*>(data + 2 * i);
+        __m256i a = _mm256_loadu_si256(p);
+        __m256i b = _mm256_loadu_si256(p + 1);
+        _mm256_storeu_si256(p, swap_members_lane_avx2<U>(a));
+        _mm256_storeu_si256(p + 1, swap_members_lane_avx2<U>(b));
+    }
+    swap_members_sse42(data + 2 * i, n - i);
+}
+
+// ============================================================================
+// AVX-512: 16/32 位成员用 vprord/vprorq 循环移位，64 位成员用 vpshufd
+// ============================================================================
+
+MYSTL_TARGET_AVX512 inline void swap_bytes_avx512(unsigned char* a, unsigned char* b, std::size_t bytes) {
+    std::size_t i = 0;
+    for (; i + 64 <= bytes; i += 64) {
+        __m512i x = _mm512_loadu_si512(a + i);
+        __m512i y = _mm512_loadu_si512(b + i);
+        _mm512_storeu_si512(a + i, y);
+        _mm512_storeu_si512(b + i, x);
+    }
+    swap_bytes_scalar(a + i, b + i, bytes - i);
+}
+
+template <typename U>
+MYSTL_TARGET_AVX512 inline __m512i swap_members_lane_avx512(__m512i x) {
+    if constexpr (sizeof(U) == 8) {
+        return _mm512_shuffle_epi32(x, static_cast<_MM_PERM_ENUM>(0x4E));
+    } else if constexpr (sizeof(U) == 4) {
+        return _mm512_ror_epi64(x, 32);
+    } else if constexpr (sizeof(U) == 2) {
+        return _mm512_ror_epi32(x, 16);
+    } else {
+        return _mm512_or_si512(_mm512_slli_epi16(x, 8), _mm512_srli_epi16(x, 8));
+    }
+}
+
+template <typename U>
+MYSTL_TARGET_AVX512 inline void swap_members_avx512(U* data, std::size_t n) {
+    constexpr std::size_t step = 64 / (2 * sizeof(U));
+    std::size_t i = 0;
+    for (; i + 2 * step <= n; i += 2 * step) {
+        unsigned char* p = reinterpret_cast<unsigned char*>(data + 2 * i);
+        __m512i a = _mm512_loadu_si512(p);
+        __m512i b = _mm512_loadu_si512(p + 64);
+        _mm512_storeu_si512(p, swap_members_lane_avx512<U>(a));
+        _mm512_storeu_si512(p + 64, swap_members_lane_avx512<U>(b));
+    }
+    swap_members_avx2(data + 2 * i, n - i);
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+inline const simd::dispatch_table<swap_bytes_fn>& swap_bytes_table() {
+    static const simd::dispatch_table<swap_bytes_fn> table =
+        MYSTL_DISPATCH_TABLE(&swap_bytes_scalar, &swap_bytes_sse42, &swap_bytes_avx2, &swap_bytes_avx512);
+    return table;
+}
+
+template <typename U>
+inline const simd::dispatch_table<swap_members_fn<U>>& swap_members_table() {
+    static const simd::dispatch_table<swap_members_fn<U>> table = MYSTL_DISPATCH_TABLE(
+        &swap_members_scalar<U>, &swap_members_sse42<U>, &swap_members_avx2<U>, &swap_members_avx512<U>);
+    return table;
+}
+
+} // namespace detail
+
+// 交换 [first1, last1) 与 [first2, first2 + (last1 - first1))，两个区间不得重叠
+template <typename A, typename B>
+inline pair<A, B>* swap_ranges(pair<A, B>* first1, pair<A, B>* last1, pair<A, B>* first2) {
+    static_assert(!std::is_const_v<A> && !std::is_const_v<B>, "swap_ranges requires non-const pair members");
+    const std::size_t n = static_cast<std::size_t>(last1 - first1);
+    assert(first1 + n <= first2 || first2 + n <= first1 || n == 0);
+    if constexpr (detail::is_bitwise_copyable_v<pair<A, B>>) {
+        static const auto fn = detail::swap_bytes_table().resolve();
+        if (n != 0) {
+            fn(reinterpret_cast<unsigned char*>(first1), reinterpret_cast<unsigned char*>(first2),
+               n * sizeof(pair<A, B>));
+        }
+    } else {
+        for (std::size_t i = 0; i < n; ++i) swap(first1[i], first2[i]);
+    }
+    return first2 + n;
+}
+
+// 原地对调每个元素的 first 与 second
+template <typename T>
+inline void swap_members(pair<T, T>* data, std::size_t n) {
+    static_assert(!std::is_const_v<T>, "swap_members requires non-const pair members");
+    if constexpr (detail::is_transposable_v<T>) {
+        using U = typename detail::uint_of_size<sizeof(T)>::type;
+        static const auto fn = detail::swap_members_table<U>().resolve();
+        if (n != 0) fn(reinterpret_cast<U*>(data), n);
+    } else {
+        using std::swap;
+        for (std::size_t i = 0; i < n; ++i) swap(data[i].first, data[i].second);
+    }
+}
+
+} // namespace my_stl
@@ -0,0 +1,320 @@
+/*
+    关键特性说明
+    1. AoS ↔ SoA 转置
+        deinterleave 把 pair<T, T> 数组拆成 first 数组和 second 数组，interleave 反向合并
+        支持 8/16/32/64 位的任意平凡可拷贝成员 (整数、浮点)，按位搬运，不做数值转换
+
+    2. SIMD 实现
+        SSE4.2:  pshufb 把一个寄存器内的偶数/奇数元素分到两半，再用 unpack 拼接
+        AVX2:    同样的通道内 shuffle/unpack，最后用 vpermq/vperm2i128 修正跨通道顺序
+        AVX-512: 16/32/64 位用 vpermt2w/d/q 一步完成；8 位需要 VBMI，退回 AVX2 实现
+        通过 cpu_dispatch.hpp 的 dispatch_table 在运行时选择，结果与标量实现逐位相同
+
+    3. 其他类型
+        成员大小不是 1/2/4/8 字节或 pair 含填充时使用逐元素拷贝
+*/
+
+#pragma once
+
+#include "pair.hpp"
+#include "cpu_dispatch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace my_stl {
+
+namespace detail {
+
+template <std::size_t Size> struct uint_of_size;
+template <> struct uint_of_size<1> { using type = std::uint8_t; };
+template <> struct uint_of_size<2> { using type = std::uint16_t; };
+template <> struct uint_of_size<4> { using type = std::uint32_t; };
+template <> struct uint_of_size<8> { using type = std::uint64_t; };
+
+template <typename T>
+inline constexpr bool is_transposable_v =
+    std::is_trivially_copyable_v<T> && sizeof(pair<T, T>) == 2 * sizeof(T) &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+// 交错数组 in[0..2n) 视为 n 个 (first, second)
+template <typename U>
+using deinterleave_fn = void (*)(const U* in, std::size_t n, U* first, U* second);
+template <typename U>
+using interleave_fn = void (*)(const U* first, const U* second, std::size_t n, U* out);
+
+// ============================================================================
+// scalar
+// ============================================================================
+
+// 数组里实际存放的可能是浮点等同样大小的其他类型，用 memcpy 按位搬运，
+// 不通过 U 类型的左值访问 (否则违反严格别名规则)；编译器会把它生成为单条 mov
+template <typename U>
+inline void deinterleave_scalar(const U* in, std::size_t n, U* first, U* second) {
+    for (std::size_t i = 0; i < n; ++i) {
+        std::memcpy(first + i, in + 2 * i, sizeof(U));
+        std::memcpy(second + i, in + 2 * i + 1, sizeof(U));
+    }
+}
+
+template <typename U>
+inline void interleave_scalar(const U* first, const U* second, std::size_t n, U* out) {
+    for (std::size_t i = 0; i < n; ++i) {
+        std::memcpy(out + 2 * i, first + i, sizeof(U));
+        std::memcpy(out + 2 * i + 1, second + i, sizeof(U));
+    }
+}
+
+#if MYSTL_X86_DISPATCH
+
+// ============================================================================
+// SSE4.2: 每次处理 16 字节的 first 和 16 字节的 second
+// ============================================================================
+
+template <typename U>
+MYSTL_TARGET_SSE42 inline void deinterleave_sse42(const U* in, std::size_t n, U* first, U* second) {
+    constexpr std::size_t step = 16 / sizeof(U);
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i + step));
+        __m128i f, s;
+        if constexpr (sizeof(U) == 8) {
+            f = _mm_unpacklo_epi64(a, b);
+            s = _mm_unpackhi_epi64(a, b);
+        } else if constexpr (sizeof(U) == 4) {
+            __m128 fa = _mm_castsi128_ps(a), fb = _mm_castsi128_ps(b);
+            f = _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0)));
+            s = _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1)));
+        } else {
+            // 每个寄存器内偶数元素移到低 8 字节，奇数元素移到高 8 字节
+            const __m128i mask = sizeof(U) == 1
+                ? _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15)
+                : _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+            a = _mm_shuffle_epi8(a, mask);
+            b = _mm_shuffle_epi8(b, mask);
+            f = _mm_unpacklo_epi64(a, b);
+            s = _mm_unpackhi_epi64(a, b);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(first + i), f);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(second + i), s);
+    }
+    deinterleave_scalar(in + 2 * i, n - i, first + i, second + i);
+}
+
+template <typename U>
+MYSTL_TARGET_SSE42 inline void interleave_sse42(const U* first, const U* second, std::size_t n, U* out) {
+    constexpr std::size_t step = 16 / sizeof(U);
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m128i f = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + i));
+        __m128i lo, hi;
+        if constexpr (sizeof(U) == 8) {
+            lo = _mm_unpacklo_epi64(f, s);
+            hi = _mm_unpackhi_epi64(f, s);
+        } else if constexpr (sizeof(U) == 4) {
+            lo = _mm_unpacklo_epi32(f, s);
+            hi = _mm_unpackhi_epi32(f, s);
+        } else if constexpr (sizeof(U) == 2) {
+            lo = _mm_unpacklo_epi16(f, s);
+            hi = _mm_unpackhi_epi16(f, s);
+        } else {
+            lo = _mm_unpacklo_epi8(f, s);
+            hi = _mm_unpackhi_epi8(f, s);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + step), hi);
+    }
+    interleave_scalar(first + i, second + i, n - i, out + 2 * i);
+}
+
+// ============================================================================
+// AVX2: 通道内 shuffle/unpack 后修正跨通道顺序
+// ============================================================================
+
+template <typename U>
+MYSTL_TARGET_AVX2 inline void deinterleave_avx2(const U* in, std::size_t n, U* first, U* second) {
+    constexpr std::size_t step = 32 / sizeof(U);
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 2 * i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 2 * i + step));
+        __m256i f, s;
+        if constexpr (sizeof(U) == 8) {
+            // unpack 得到 f0 f2 | f1 f3，vpermq 调整为 f0 f1 f2 f3
+            f = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xd8);
+            s = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), 0xd8);
+        } else if constexpr (sizeof(U) == 4) {
+            __m256 fa = _mm256_castsi256_ps(a), fb = _mm256_castsi256_ps(b);
+            f = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))), 0xd8);
+            s = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1))), 0xd8);
+        } else {
+            const __m256i mask = sizeof(U) == 1
+                ? _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                                   0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15)
+                : _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+                                   0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+            // 每个通道变为 [偶数 | 奇数]，vpermq 后寄存器变为 [偶数 偶数 | 奇数 奇数]
+            a = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a, mask), 0xd8);
+            b = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(b, mask), 0xd8);
+            f = _mm256_permute2x128_si256(a, b, 0x20);
+            s = _mm256_permute2x128_si256(a, b, 0x31);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(first + i), f);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(second + i), s);
+    }
+    deinterleave_scalar(in + 2 * i, n - i, first + i, second + i);
+}
+
+template <typename U>
+MYSTL_TARGET_AVX2 inline void interleave_avx2(const U* first, const U* second, std::size_t n, U* out) {
+    constexpr std::size_t step = 32 / sizeof(U);
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + i));
+        __m256i lo, hi;
+        if constexpr (sizeof(U) == 8) {
+            lo = _mm256_unpacklo_epi64(f, s);
+            hi = _mm256_unpackhi_epi64(f, s);
+        } else if constexpr (sizeof(U) == 4) {
+            lo = _mm256_unpacklo_epi32(f, s);
+            hi = _mm256_unpackhi_epi32(f, s);
+        } else if constexpr (sizeof(U) == 2) {
+            lo = _mm256_unpacklo_epi16(f, s);
+            hi = _mm256_unpackhi_epi16(f, s);
+        } else {
+            lo = _mm256_unpacklo_epi8(f, s);
+            hi = _mm256_unpackhi_epi8(f, s);
+        }
+        // lo/hi 按通道分别持有低半和高半，重新组合为连续输出
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + step), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    interleave_scalar(first + i, second + i, n - i, out + 2 * i);
+}
+
+// ============================================================================
+// AVX-512: 双源置换 vpermt2w/d/q (16/32/64 位)
+// ============================================================================
+
+template <typename U>
+MYSTL_TARGET_AVX512 inline __m512i permutex2var(__m512i a, __m512i idx, __m512i b) {
+    if constexpr (sizeof(U) == 8) return _mm512_permutex2var_epi64(a, idx, b);
+    else if constexpr (sizeof(U) == 4) return _mm512_permutex2var_epi32(a, idx, b);
+    else return _mm512_permutex2var_epi16(a, idx, b);
+}
+
+// 元素宽度为 sizeof(U) 的索引向量
+template <typename U, typename Fn>
+MYSTL_TARGET_AVX512 inline __m512i make_index(Fn&& index_of) {
+    constexpr std::size_t lanes = 64 / sizeof(U);
+    alignas(64) U idx[lanes];
+    for (std::size_t j = 0; j < lanes; ++j) idx[j] = static_cast<U>(index_of(j));
+    return _mm512_load_si512(idx);
+}
+
+template <typename U>
+MYSTL_TARGET_AVX512 inline void deinterleave_avx512(const U* in, std::size_t n, U* first, U* second) {
+    static_assert(sizeof(U) >= 2, "8-bit AVX-512 transpose needs VBMI");
+    constexpr std::size_t step = 64 / sizeof(U);
+    const __m512i even = make_index<U>([](std::size_t j) { return 2 * j; });
+    const __m512i odd = make_index<U>([](std::size_t j) { return 2 * j + 1; });
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m512i a = _mm512_loadu_si512(in + 2 * i);
+        __m512i b = _mm512_loadu_si512(in + 2 * i + step);
+        _mm512_storeu_si512(first + i, permutex2var<U>(a, even, b));
+        _mm512_storeu_si512(second + i, permutex2var<U>(a, odd, b));
+    }
+    deinterleave_scalar(in + 2 * i, n - i, first + i, second + i);
+}
+
+template <typename U>
+MYSTL_TARGET_AVX512 inline void interleave_avx512(const U* first, const U* second, std::size_t n, U* out) {
+    static_assert(sizeof(U) >= 2, "8-bit AVX-512 transpose needs VBMI");
+    constexpr std::size_t step = 64 / sizeof(U);
+    // 索引 >= step 取自第二个源 (second)
+    const __m512i lo_idx = make_index<U>([](std::size_t j) { return (j / 2) + (j % 2) * step; });
+    const __m512i hi_idx = make_index<U>([](std::size_t j) { return step / 2 + (j / 2) + (j % 2) * step; });
+    std::size_t i = 0;
+    for (; i + step <= n; i += step) {
+        __m512i f = _mm512_loadu_si512(first + i);
+        __m512i s = _mm512_loadu_si512(second + i);
+        _mm512_storeu_si512(out + 2 * i, permutex2var<U>(f, lo_idx, s));
+        _mm512_storeu_si512(out + 2 * i + step, permutex2var<U>(f, hi_idx, s));
+    }
+    interleave_scalar(first + i, second + i, n - i, out + 2 * i);
+}
+
+#endif // MYSTL_X86_DISPATCH
+
+// ============================================================================
+// 分派表
+// ============================================================================
+
+template <typename U>
+inline const simd::dispatch_table<deinterleave_fn<U>>& deinterleave_table() {
+#if MYSTL_X86_DISPATCH
+    constexpr deinterleave_fn<U> avx512 = [] {
+        if constexpr (sizeof(U) == 1) return deinterleave_fn<U>(nullptr);
+        else return deinterleave_fn<U>(&deinterleave_avx512<U>);
+    }();
+#endif
+    static const simd::dispatch_table<deinterleave_fn<U>> table = MYSTL_DISPATCH_TABLE(
+        &deinterleave_scalar<U>, &deinterleave_sse42<U>, &deinterleave_avx2<U>, avx512);
+    return table;
+}
+
+template <typename U>
+inline const simd::dispatch_table<interleave_fn<U>>& interleave_table() {
+#if MYSTL_X86_DISPATCH
+    constexpr interleave_fn<U> avx512 = [] {
+        if constexpr (sizeof(U) == 1) return interleave_fn<U>(nullptr);
+        else return interleave_fn<U>(&interleave_avx512<U>);
+    }();
+#endif
+    static const simd::dispatch_table<interleave_fn<U>> table = MYSTL_DISPATCH_TABLE(
+        &interleave_scalar<U>, &interleave_sse42<U>, &interleave_avx2<U>, avx512);
+    return table;
+}
+
+} // namespace detail
+
+// ============================================================================
+// 公共接口
+// ============================================================================
+
+// in[0..n) → first[0..n), second[0..n)
+template <typename T>
+inline void deinterleave(const pair<T, T>* in, std::size_t n, T* first, T* second) {
+    if constexpr (detail::is_transposable_v<T>) {
+        using U = typename detail::uint_of_size<sizeof(T)>::type;
+        static const auto fn = detail::deinterleave_table<U>().resolve();
+        fn(reinterpret_cast<const U*>(in), n, reinterpret_cast<U*>(first), reinterpret_cast<U*>(second));
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            first[i] = in[i].first;
+            second[i] = in[i].second;
+        }
+    }
+}
+
+// first[0..n), second[0..n) → out[0..n)
+template <typename T>
+inline void interleave(const T* first, const T* second, std::size_t n, pair<T, T>* out) {
+    if constexpr (detail::is_transposable_v<T>) {
+        using U = typename detail::uint_of_size<sizeof(T)>::type;
+        static const auto fn = detail::interleave_table<U>().resolve();
+        fn(reinterpret_cast<const U*>(first), reinterpret_cast<const U*>(second), n, reinterpret_cast<U*>(out));
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i].first = first[i];
+            out[i].second = second[i];
+        }
+    }
+}
+
+} // namespace my_stl
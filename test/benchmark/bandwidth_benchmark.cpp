@@ -0,0 +1,366 @@
+// 内存带宽与 roofline 基准测试
+//
+// 先用 STREAM 风格的 copy/scale/add/triad 测出本机可达的内存带宽峰值，再对不同
+// 成员大小的 pair 数组在 AoS (my_stl::pair 数组)、SoA (两个成员数组)、AoSoA
+// (每块 16 个元素的成员数组) 和 packed (无填充) 四种布局下运行扫描类内核：
+//   scan     只读 first 求和
+//   compare  与固定键做字典序比较并计数
+//   hash     对每个元素计算组合哈希并求和
+// 每个内核分别在 L1 常驻 (计算上限) 和远大于 LLC (内存上限) 的数据量上测量。
+// 若大数据量下的吞吐明显低于缓存内吞吐，则该内核受带宽限制，布局 (减少无用字节)
+// 值得优化；否则受计算限制，布局收益有限。
+//
+// 输出 CSV（标准输出）:
+//   kernel,layout,types,streamed_bytes_per_item,gbps,peak_pct,dram_mitems_s,cache_mitems_s,bound
+// streamed_bytes_per_item 按缓存行粒度估算内核实际从内存读入的字节数。
+//
+// 参数:
+//   --bytes=N             大数据量下每种布局的内存占用 (默认 max(4 * L3, 256MB))
+//   --min-time-ms=T       每个测量点的最短累计时间 (默认 200)
+//   --kernels=a,b         scan,compare,hash (默认全部)
+//   --layouts=a,b         aos,soa,aosoa,packed (默认全部)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../include/my_stl/pair.hpp"
+#include "../../include/my_stl/detail/hash.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+struct Options {
+    std::uint64_t bytes = 0;
+    double min_time_ns = 200e6;
+    std::vector<std::string> kernels = {"scan", "compare", "hash"};
+    std::vector<std::string> layouts = {"aos", "soa", "aosoa", "packed"};
+};
+
+std::vector<std::string> split(const std::string& text) {
+    std::vector<std::string> parts;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) parts.push_back(item);
+    }
+    return parts;
+}
+
+bool contains(const std::vector<std::string>& list, const std::string& item) {
+    return std::find(list.begin(), list.end(), item) != list.end();
+}
+
+constexpr std::size_t cache_line = 64;
+
+// 反复运行 fn 直到累计时间超过 min_time_ns，返回单次最短耗时 (ns)
+template <typename Fn>
+double best_time(double min_time_ns, Fn&& fn) {
+    double best = 0;
+    double total = 0;
+    int reps = 0;
+    while (total < min_time_ns || reps < 3) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = reps == 0 ? t : std::min(best, t);
+        total += t;
+        ++reps;
+    }
+    return best;
+}
+
+// ============================================================================
+// STREAM 峰值
+// ============================================================================
+
+double stream_peak_gbps(std::uint64_t bytes, double min_time_ns) {
+    std::size_t n = std::max<std::size_t>(1024, bytes / (3 * sizeof(double)));
+    std::vector<double> a(n, 1.0), b(n, 2.0), c(n, 0.0);
+    const double s = 3.0;
+
+    double t;
+
+    t = best_time(min_time_ns, [&] {
+        for (std::size_t i = 0; i < n; ++i) c[i] = a[i];
+        bench::clobber_memory();
+    });
+    double copy = 16.0 * n / t;
+    t = best_time(min_time_ns, [&] {
+        for (std::size_t i = 0; i < n; ++i) b[i] = s * c[i];
+        bench::clobber_memory();
+    });
+    double scale = 16.0 * n / t;
+    t = best_time(min_time_ns, [&] {
+        for (std::size_t i = 0; i < n; ++i) c[i] = a[i] + b[i];
+        bench::clobber_memory();
+    });
+    double add = 24.0 * n / t;
+    t = best_time(min_time_ns, [&] {
+        for (std::size_t i = 0; i < n; ++i) a[i] = b[i] + s * c[i];
+        bench::clobber_memory();
+    });
+    double triad = 24.0 * n / t;
+    bench::do_not_optimize(a[n / 2]);
+
+    std::cout << "# stream copy=" << copy << " scale=" << scale << " add=" << add
+              << " triad=" << triad << " GB/s" << std::endl;
+    return std::max({copy, scale, add, triad});
+}
+
+// ============================================================================
+// 布局
+// ============================================================================
+
+#pragma pack(push, 1)
+template <typename A, typename B>
+struct packed_pair {
+    A first;
+    B second;
+};
+#pragma pack(pop)
+
+template <typename A, typename B>
+struct AosLayout {
+    std::vector<my_stl::pair<A, B>> data;
+
+    explicit AosLayout(std::size_t n) : data(n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i] = my_stl::pair<A, B>(static_cast<A>(bench::mix64(i)), static_cast<B>(i));
+        }
+    }
+    std::size_t size() const { return data.size(); }
+    std::size_t footprint() const { return data.size() * sizeof(my_stl::pair<A, B>); }
+    std::size_t first_stream() const { return footprint(); }
+
+    template <typename F>
+    void for_each(F&& f) const {
+        for (const auto& p : data) f(p.first, p.second);
+    }
+    template <typename F>
+    void for_each_first(F&& f) const {
+        for (const auto& p : data) f(p.first);
+    }
+};
+
+template <typename A, typename B>
+struct SoaLayout {
+    std::vector<A> first;
+    std::vector<B> second;
+
+    explicit SoaLayout(std::size_t n) : first(n), second(n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            first[i] = static_cast<A>(bench::mix64(i));
+            second[i] = static_cast<B>(i);
+        }
+    }
+    std::size_t size() const { return first.size(); }
+    std::size_t footprint() const { return first.size() * (sizeof(A) + sizeof(B)); }
+    std::size_t first_stream() const { return first.size() * sizeof(A); }
+
+    template <typename F>
+    void for_each(F&& f) const {
+        const std::size_t n = first.size();
+        for (std::size_t i = 0; i < n; ++i) f(first[i], second[i]);
+    }
+    template <typename F>
+    void for_each_first(F&& f) const {
+        for (A a : first) f(a);
+    }
+};
+
+template <typename A, typename B>
+struct AosoaLayout {
+    static constexpr std::size_t lanes = 16;
+    struct alignas(cache_line) Block {
+        A first[lanes];
+        B second[lanes];
+    };
+    std::vector<Block> blocks;
+
+    explicit AosoaLayout(std::size_t count) : blocks((count + lanes - 1) / lanes) {
+        for (std::size_t i = 0; i < size(); ++i) {
+            blocks[i / lanes].first[i % lanes] = static_cast<A>(bench::mix64(i));
+            blocks[i / lanes].second[i % lanes] = static_cast<B>(i);
+        }
+    }
+    std::size_t size() const { return blocks.size() * lanes; }
+    std::size_t footprint() const { return blocks.size() * sizeof(Block); }
+    // first 段按整缓存行排列时只读入 first 所在的行
+    std::size_t first_stream() const {
+        std::size_t segment = lanes * sizeof(A);
+        return segment % cache_line == 0 ? blocks.size() * segment : footprint();
+    }
+
+    template <typename F>
+    void for_each(F&& f) const {
+        for (const auto& b : blocks) {
+            for (std::size_t j = 0; j < lanes; ++j) f(b.first[j], b.second[j]);
+        }
+    }
+    template <typename F>
+    void for_each_first(F&& f) const {
+        for (const auto& b : blocks) {
+            for (std::size_t j = 0; j < lanes; ++j) f(b.first[j]);
+        }
+    }
+};
+
+template <typename A, typename B>
+struct PackedLayout {
+    std::vector<packed_pair<A, B>> data;
+
+    explicit PackedLayout(std::size_t n) : data(n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i].first = static_cast<A>(bench::mix64(i));
+            data[i].second = static_cast<B>(i);
+        }
+    }
+    std::size_t size() const { return data.size(); }
+    std::size_t footprint() const { return data.size() * sizeof(packed_pair<A, B>); }
+    std::size_t first_stream() const { return footprint(); }
+
+    template <typename F>
+    void for_each(F&& f) const {
+        for (const auto& p : data) f(A(p.first), B(p.second));
+    }
+    template <typename F>
+    void for_each_first(F&& f) const {
+        for (const auto& p : data) f(A(p.first));
+    }
+};
+
+// ============================================================================
+// 内核
+// ============================================================================
+
+struct KernelResult {
+    double ns_per_item = 0;
+    double streamed_bytes_per_item = 0;
+};
+
+template <typename Layout>
+KernelResult run_kernel(const std::string& kernel, const Layout& layout, double min_time_ns) {
+    const std::size_t n = layout.size();
+    KernelResult r;
+    double t = 0;
+    if (kernel == "scan") {
+        t = best_time(min_time_ns, [&] {
+            std::uint64_t sum = 0;
+            layout.for_each_first([&](auto a) { sum += static_cast<std::uint64_t>(a); });
+            bench::do_not_optimize(sum);
+        });
+        r.streamed_bytes_per_item = static_cast<double>(layout.first_stream()) / n;
+    } else if (kernel == "compare") {
+        t = best_time(min_time_ns, [&] {
+            std::uint64_t less = 0;
+            layout.for_each([&](auto a, auto b) {
+                using A = decltype(a);
+                using B = decltype(b);
+                const A ka = std::numeric_limits<A>::max() / 2;
+                const B kb = std::numeric_limits<B>::max() / 2;
+                less += (a < ka) | (!(ka < a) & (b < kb));
+            });
+            bench::do_not_optimize(less);
+        });
+        r.streamed_bytes_per_item = static_cast<double>(layout.footprint()) / n;
+    } else if (kernel == "hash") {
+        t = best_time(min_time_ns, [&] {
+            std::uint64_t acc = 0;
+            layout.for_each([&](auto a, auto b) {
+                acc += my_stl::detail::hash_combine64(static_cast<std::uint64_t>(a), static_cast<std::uint64_t>(b));
+            });
+            bench::do_not_optimize(acc);
+        });
+        r.streamed_bytes_per_item = static_cast<double>(layout.footprint()) / n;
+    }
+    r.ns_per_item = t / static_cast<double>(n);
+    return r;
+}
+
+template <template <typename, typename> class Layout, typename A, typename B>
+void run_layout(const Options& opt, const std::string& layout_name, const std::string& types,
+                double peak_gbps, std::size_t cache_items, std::size_t dram_items) {
+    Layout<A, B> small(cache_items);
+    Layout<A, B> large(dram_items);
+    for (const auto& kernel : opt.kernels) {
+        auto cached = run_kernel(kernel, small, opt.min_time_ns / 4);
+        auto dram = run_kernel(kernel, large, opt.min_time_ns);
+        double gbps = dram.streamed_bytes_per_item / dram.ns_per_item;
+        double dram_mitems = 1e3 / dram.ns_per_item;
+        double cache_mitems = 1e3 / cached.ns_per_item;
+        // 大数据量下吞吐不到缓存内的 80%：时间主要花在等待内存上
+        const char* bound = dram_mitems < 0.8 * cache_mitems ? "memory" : "compute";
+        std::cout << kernel << ',' << layout_name << ',' << types << ','
+                  << dram.streamed_bytes_per_item << ',' << gbps << ',' << 100.0 * gbps / peak_gbps << ','
+                  << dram_mitems << ',' << cache_mitems << ',' << bound << std::endl;
+    }
+}
+
+template <typename A, typename B>
+void run_types(const Options& opt, const std::string& types, double peak_gbps, std::uint64_t cache_bytes) {
+    const std::size_t item = sizeof(my_stl::pair<A, B>);
+    const std::size_t cache_items = std::max<std::size_t>(256, cache_bytes / item);
+    const std::size_t dram_items = std::max<std::size_t>(cache_items, opt.bytes / item);
+    if (contains(opt.layouts, "aos")) run_layout<AosLayout, A, B>(opt, "aos", types, peak_gbps, cache_items, dram_items);
+    if (contains(opt.layouts, "soa")) run_layout<SoaLayout, A, B>(opt, "soa", types, peak_gbps, cache_items, dram_items);
+    if (contains(opt.layouts, "aosoa")) run_layout<AosoaLayout, A, B>(opt, "aosoa", types, peak_gbps, cache_items, dram_items);
+    if (contains(opt.layouts, "packed")) run_layout<PackedLayout, A, B>(opt, "packed", types, peak_gbps, cache_items, dram_items);
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--bytes=")) opt.bytes = bench::parse_size(v);
+        else if (auto v = value("--min-time-ms=")) opt.min_time_ns = std::atof(v) * 1e6;
+        else if (auto v = value("--kernels=")) opt.kernels = split(v);
+        else if (auto v = value("--layouts=")) opt.layouts = split(v);
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0]
+                  << " [--bytes=N] [--min-time-ms=T] [--kernels=scan,compare,hash]"
+                     " [--layouts=aos,soa,aosoa,packed]"
+                  << std::endl;
+        return 2;
+    }
+
+    auto caches = bench::cache_sizes();
+    if (opt.bytes == 0) {
+        opt.bytes = std::max<std::uint64_t>(4 * static_cast<std::uint64_t>(std::max(0L, caches.l3)), 256ull << 20);
+    }
+    // 缓存内测量用 L1d 的一半，L1d 未知时按 32KB 计
+    const std::uint64_t cache_bytes = (caches.l1d > 0 ? static_cast<std::uint64_t>(caches.l1d) : 32768) / 2;
+
+    bench::print_build_warning(std::cout);
+    std::cout << "# cache l1d=" << caches.l1d << " l2=" << caches.l2 << " l3=" << caches.l3
+              << " bytes=" << opt.bytes << std::endl;
+    double peak = stream_peak_gbps(opt.bytes, opt.min_time_ns);
+    std::cout << "# peak_gbps=" << peak << std::endl;
+    std::cout << "kernel,layout,types,streamed_bytes_per_item,gbps,peak_pct,dram_mitems_s,cache_mitems_s,bound"
+              << std::endl;
+
+    run_types<std::uint32_t, std::uint32_t>(opt, "u32/u32", peak, cache_bytes);
+    run_types<std::uint64_t, std::uint64_t>(opt, "u64/u64", peak, cache_bytes);
+    run_types<std::uint8_t, std::uint64_t>(opt, "u8/u64", peak, cache_bytes);
+    run_types<std::uint16_t, std::uint32_t>(opt, "u16/u32", peak, cache_bytes);
+    return 0;
+}
@@ -0,0 +1,135 @@
+// 基准测试公共工具
+//
+// - do_not_optimize / clobber_memory: 防止编译器消除被测代码
+// - Stopwatch: 纳秒计时
+// - ZipfGenerator: 固定内存的 Zipf 分布采样 (Gray et al. "Quickly generating
+//   billion-record synthetic databases")，用于偏斜键分布
+// - cache_sizes(): 读取 L1d/L2/L3 大小，用于标注吞吐曲线
+// - print_build_warning(): 未开启优化时提示结果不可信
+
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+template <typename T>
+inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+class Stopwatch {
+public:
+    Stopwatch() : start_(clock::now()) {}
+
+    void reset() { start_ = clock::now(); }
+
+    double elapsed_ns() const {
+        return static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start_).count());
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+    clock::time_point start_;
+};
+
+// 64 位混合函数 (splitmix64 终结步骤)，用于把序号打散成键
+inline std::uint64_t mix64(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Zipf 分布，返回 [0, n) 中的秩，0 最热
+class ZipfGenerator {
+public:
+    ZipfGenerator(std::uint64_t n, double theta = 0.99, std::uint64_t seed = 42)
+        : n_(n), theta_(theta), rng_(seed), uniform_(0.0, 1.0) {
+        zeta_n_ = zeta(n_, theta_);
+        double zeta2 = zeta(2, theta_);
+        alpha_ = 1.0 / (1.0 - theta_);
+        eta_ = (1.0 - std::pow(2.0 / static_cast<double>(n_), 1.0 - theta_)) / (1.0 - zeta2 / zeta_n_);
+    }
+
+    std::uint64_t operator()() {
+        double u = uniform_(rng_);
+        double uz = u * zeta_n_;
+        if (uz < 1.0) return 0;
+        if (uz < 1.0 + std::pow(0.5, theta_)) return 1;
+        auto r = static_cast<std::uint64_t>(static_cast<double>(n_) * std::pow(eta_ * u - eta_ + 1.0, alpha_));
+        return r < n_ ? r : n_ - 1;
+    }
+
+private:
+    static double zeta(std::uint64_t n, double theta) {
+        double sum = 0.0;
+        for (std::uint64_t i = 1; i <= n; ++i) {
+            sum += 1.0 / std::pow(static_cast<double>(i), theta);
+        }
+        return sum;
+    }
+
+    std::uint64_t n_;
+    double theta_;
+    double zeta_n_;
+    double alpha_;
+    double eta_;
+    std::mt19937_64 rng_;
+    std::uniform_real_distribution<double> uniform_;
+};
+
+struct CacheSizes {
+    long l1d = 0;
+    long l2 = 0;
+    long l3 = 0;
+};
+
+inline CacheSizes cache_sizes() {
+    CacheSizes sizes;
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+    sizes.l1d = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    sizes.l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    sizes.l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+    return sizes;
+}
+
+inline void print_build_warning(std::ostream& os) {
+#if !defined(__OPTIMIZE__) && !defined(NDEBUG)
+    os << "# WARNING: built without optimization; configure with -DCMAKE_BUILD_TYPE=Release" << std::endl;
+#else
+    (void)os;
+#endif
+}
+
+// 解析 "1e6"、"1000000" 这类大小参数
+inline std::uint64_t parse_size(const std::string& text) {
+    return static_cast<std::uint64_t>(std::strtod(text.c_str(), nullptr));
+}
+
+} // namespace bench
@@ -6,32 +6,56 @@
 #include <algorithm>
 #include <memory>
 #include <functional>
+#include <cstdint>
 #include "../../include/my_stl/pair.hpp"
+#include "../../include/my_stl/histogram.hpp"
 
 // Benchmark utilities
 class Benchmark {
 public:
-    static double measure_time(std::function<void()> func, int iterations = 1) {
-        auto start = std::chrono::high_resolution_clock::now();
-        for (int i = 0; i < iterations; ++i) {
-            func();
+    // Iterations are timed in about 1000 batches; each batch's mean cost per op is
+    // recorded into a histogram. Single ops are too short to time individually, so
+    // the percentiles are over batch means, not over individual operations
+    static double measure_time(std::function<void()> func, int iterations,
+                               my_stl::latency_histogram& batches) {
+        const int batch_size = std::max(1, iterations / 1000);
+        double total_ns = 0;
+        for (int done = 0; done < iterations; done += batch_size) {
+            int n = std::min(batch_size, iterations - done);
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < n; ++i) {
+                func();
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            total_ns += duration.count();
+            // Histogram values are integers; keep a 1/100 ns resolution
+            batches.record(static_cast<std::uint64_t>(duration.count() * 100.0 / n));
         }
-        auto end = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
-        return duration.count() / static_cast<double>(iterations);
+        return total_ns / static_cast<double>(iterations);
     }
-    
+
+    static void print_result(const char* label, double mean, const my_stl::latency_histogram& batches) {
+        std::cout << label << mean << " ns/op"
+                  << " (batch-mean p50 " << batches.value_at_percentile(50) / 100.0
+                  << ", p99 " << batches.value_at_percentile(99) / 100.0
+                  << ", p99.9 " << batches.value_at_percentile(99.9) / 100.0
+                  << ", max " << batches.max() / 100.0 << ")" << std::endl;
+    }
+
     static void compare_performance(const std::string& test_name,
                                   std::function<void()> my_stl_func,
                                   std::function<void()> std_func,
                                   int iterations = 1000000) {
         std::cout << "\n=== " << test_name << " ===" << std::endl;
         
-        double my_time = measure_time(my_stl_func, iterations);
-        double std_time = measure_time(std_func, iterations);
+        my_stl::latency_histogram my_batches;
+        my_stl::latency_histogram std_batches;
+        double my_time = measure_time(my_stl_func, iterations, my_batches);
+        double std_time = measure_time(std_func, iterations, std_batches);
         
-        std::cout << "my_stl::pair: " << my_time << " ns/op" << std::endl;
-        std::cout << "std::pair:    " << std_time << " ns/op" << std::endl;
+        print_result("my_stl::pair: ", my_time, my_batches);
+        print_result("std::pair:    ", std_time, std_batches);
         
         double ratio = my_time / std_time;
         std::cout << "Ratio (my_stl/std): " << ratio << "x";
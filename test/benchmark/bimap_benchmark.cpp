@@ -0,0 +1,132 @@
+// 双向映射基准测试
+//
+// 建立 --n 个 id (uint32_t) ↔ 名称 (短 std::string) 的一对一关联，比较两个 std::unordered_map
+// 与 bimap 的构建耗时、两个方向随机查找的耗时，以及构建期间累计分配的字节数 (含扩容时释放的旧数组) 与分配次数
+// (通过替换全局 operator new 统计)
+//
+// 输出 CSV（标准输出）:
+//   n,method,build_ms,ns_per_id_lookup,ns_per_name_lookup,alloc_bytes,allocations
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../../include/my_stl/bimap.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+std::size_t g_bytes = 0;
+std::size_t g_allocations = 0;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    g_bytes += size;
+    ++g_allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+struct Options {
+    std::size_t n = 1000000;
+    std::size_t lookups = 1000000;
+};
+
+void run(const Options& opt) {
+    std::vector<std::string> names(opt.n);
+    // 随机前缀加序号，名称互不相同且不超过短字符串优化的长度
+    for (std::size_t i = 0; i < opt.n; ++i) names[i] = "u" + std::to_string(bench::mix64(i) % 100000) + "-" + std::to_string(i);
+    std::vector<std::uint32_t> probes(opt.lookups);
+    for (std::size_t i = 0; i < opt.lookups; ++i) probes[i] = static_cast<std::uint32_t>(bench::mix64(i + opt.n) % opt.n);
+
+    auto report = [&](const char* method, double build_ns, double id_ns, double name_ns, std::size_t bytes,
+                      std::size_t allocations) {
+        std::cout << opt.n << ',' << method << ',' << build_ns / 1e6 << ',' << id_ns / static_cast<double>(opt.lookups)
+                  << ',' << name_ns / static_cast<double>(opt.lookups) << ',' << bytes << ',' << allocations << std::endl;
+    };
+
+    {
+        std::size_t bytes = g_bytes, allocations = g_allocations;
+        bench::Stopwatch sw;
+        std::unordered_map<std::uint32_t, std::string> by_id;
+        std::unordered_map<std::string, std::uint32_t> by_name;
+        for (std::size_t i = 0; i < opt.n; ++i) {
+            by_id.emplace(static_cast<std::uint32_t>(i), names[i]);
+            by_name.emplace(names[i], static_cast<std::uint32_t>(i));
+        }
+        double build = sw.elapsed_ns();
+        bytes = g_bytes - bytes;
+        allocations = g_allocations - allocations;
+
+        std::size_t sum = 0;
+        sw.reset();
+        for (std::uint32_t id : probes) sum += by_id.find(id)->second.size();
+        double id_ns = sw.elapsed_ns();
+        sw.reset();
+        for (std::uint32_t id : probes) sum += by_name.find(names[id])->second;
+        double name_ns = sw.elapsed_ns();
+        bench::do_not_optimize(sum);
+        report("two_unordered_maps", build, id_ns, name_ns, bytes, allocations);
+    }
+    {
+        std::size_t bytes = g_bytes, allocations = g_allocations;
+        bench::Stopwatch sw;
+        my_stl::bimap<std::uint32_t, std::string> map;
+        for (std::size_t i = 0; i < opt.n; ++i) map.insert(static_cast<std::uint32_t>(i), names[i]);
+        double build = sw.elapsed_ns();
+        bytes = g_bytes - bytes;
+        allocations = g_allocations - allocations;
+
+        std::size_t sum = 0;
+        sw.reset();
+        for (std::uint32_t id : probes) sum += map.right_of(id)->size();
+        double id_ns = sw.elapsed_ns();
+        sw.reset();
+        for (std::uint32_t id : probes) sum += *map.left_of(names[id]);
+        double name_ns = sw.elapsed_ns();
+        bench::do_not_optimize(sum);
+        report("bimap", build, id_ns, name_ns, bytes, allocations);
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--n=")) opt.n = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--lookups=")) opt.lookups = static_cast<std::size_t>(bench::parse_size(v));
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.n > 0 && opt.lookups > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--n=N] [--lookups=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "n,method,build_ms,ns_per_id_lookup,ns_per_name_lookup,alloc_bytes,allocations" << std::endl;
+    run(opt);
+    return 0;
+}
@@ -0,0 +1,167 @@
+// 分块 Bloom 过滤器基准测试
+//
+// 插入 --keys 个 (tenant, key) 键，再用 --probes 个探测 (命中比例为 --hit-rate，其余都不存在) 查询，
+// 比较 std::unordered_set 精确查找、blocked_bloom_filter 逐个查询、contains_batch 批量查询，
+// 以及各可运行指令集等级上批量查询内核 (预先求好哈希) 的每次耗时、内存与实测误判率
+//
+// 输出 CSV（标准输出）:
+//   method,isa,ns_per_op,bytes,false_positive_rate
+//
+// 参数:
+//   --keys=N              插入的键数 (默认 1e7)
+//   --probes=N            探测次数 (默认 1e7)
+//   --hit-rate=F          探测中存在的键所占比例 (默认 0.01)
+//   --bits-per-key=F      每键位数 (默认 10)
+//   --repeat=N            每个测量点的重复次数，取最短 (默认 3)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "../../include/my_stl/bloom_filter.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+using tenant_key = my_stl::pair<std::uint32_t, std::uint64_t>;
+using filter = my_stl::blocked_bloom_filter<std::uint32_t, std::uint64_t>;
+using isa = my_stl::simd::isa;
+
+struct Options {
+    std::size_t keys = 10000000;
+    std::size_t probes = 10000000;
+    double hit_rate = 0.01;
+    double bits_per_key = 10.0;
+    int repeat = 3;
+};
+
+template <typename Fn>
+double best_of(int repeat, Fn&& fn) {
+    double best = 0;
+    for (int r = 0; r < repeat; ++r) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = r == 0 ? t : std::min(best, t);
+    }
+    return best;
+}
+
+void run(const Options& opt) {
+    // 存在的键用偶数序号，不存在的键用奇数序号
+    auto make_key = [](std::uint64_t i) {
+        std::uint64_t h = bench::mix64(i);
+        return tenant_key(static_cast<std::uint32_t>(h % 1000), h);
+    };
+    std::vector<tenant_key> keys(opt.keys);
+    for (std::size_t i = 0; i < opt.keys; ++i) keys[i] = make_key(2 * i);
+    std::vector<tenant_key> probes(opt.probes);
+    std::size_t misses = 0;
+    for (std::size_t i = 0; i < opt.probes; ++i) {
+        bool hit = static_cast<double>(bench::mix64(i + 12345) % 1000000) < opt.hit_rate * 1e6;
+        probes[i] = hit ? keys[bench::mix64(i) % opt.keys] : make_key(2 * i + 1);
+        misses += !hit;
+    }
+    const double ops = static_cast<double>(opt.probes);
+    auto report = [&](const char* method, const char* level, double ns, double n, std::size_t bytes, double fpr) {
+        std::cout << method << ',' << level << ',' << ns / n << ',' << bytes << ',' << fpr << std::endl;
+    };
+    // 命中的探测总为真，其余为真的都是误判
+    auto false_positive_rate = [&](std::size_t positives) {
+        return misses ? static_cast<double>(positives - (opt.probes - misses)) / static_cast<double>(misses) : 0.0;
+    };
+
+    {
+        std::unordered_set<tenant_key> set(keys.begin(), keys.end());
+        std::size_t found = 0;
+        double ns = best_of(opt.repeat, [&] {
+            found = 0;
+            for (const auto& p : probes) found += set.count(p);
+        });
+        // 每个节点至少包含键、next 指针和缓存的哈希值，加上桶数组
+        std::size_t bytes = set.size() * (sizeof(tenant_key) + 2 * sizeof(void*)) + set.bucket_count() * sizeof(void*);
+        report("unordered_set", "-", ns, ops, bytes, false_positive_rate(found));
+    }
+
+    filter f(opt.keys, opt.bits_per_key);
+    {
+        double ns = best_of(opt.repeat, [&] {
+            f.clear();
+            f.insert_batch(keys.data(), keys.size());
+        });
+        report("insert_batch", my_stl::simd::isa_name(my_stl::simd::active_isa()), ns,
+               static_cast<double>(opt.keys), f.memory_usage(), f.false_positive_rate());
+    }
+    {
+        std::size_t found = 0;
+        double ns = best_of(opt.repeat, [&] {
+            found = 0;
+            for (const auto& p : probes) found += f.contains(p);
+        });
+        report("contains", my_stl::simd::isa_name(my_stl::simd::active_isa()), ns, ops, f.memory_usage(),
+               false_positive_rate(found));
+    }
+    std::unique_ptr<bool[]> out(new bool[probes.size()]);
+    {
+        double ns = best_of(opt.repeat, [&] { f.contains_batch(probes.data(), probes.size(), out.get()); });
+        report("contains_batch", my_stl::simd::isa_name(my_stl::simd::active_isa()), ns, ops, f.memory_usage(),
+               false_positive_rate(static_cast<std::size_t>(std::count(out.get(), out.get() + probes.size(), true))));
+    }
+
+    std::vector<std::uint64_t> hashes(probes.size());
+    for (std::size_t i = 0; i < probes.size(); ++i) hashes[i] = filter::view_type::hash_of(probes[i], f.seed());
+    const my_stl::detail::bloom_block* blocks = f.view().blocks();
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        auto level = static_cast<isa>(l);
+        if (my_stl::detail::bloom_contains_table().resolved_level(level) != level) continue;
+        auto contains = my_stl::detail::bloom_contains_table().resolve(level);
+        double ns = best_of(opt.repeat, [&] {
+            contains(blocks, f.num_blocks(), hashes.data(), hashes.size(), out.get());
+        });
+        bench::do_not_optimize(out.get());
+        report("contains_kernel", my_stl::simd::isa_name(level), ns, ops, f.memory_usage(),
+               false_positive_rate(static_cast<std::size_t>(std::count(out.get(), out.get() + probes.size(), true))));
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--keys=")) opt.keys = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--probes=")) opt.probes = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--hit-rate=")) opt.hit_rate = std::atof(v);
+        else if (auto v = value("--bits-per-key=")) opt.bits_per_key = std::atof(v);
+        else if (auto v = value("--repeat=")) opt.repeat = std::atoi(v);
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.keys > 0 && opt.probes > 0 && opt.hit_rate >= 0 && opt.hit_rate <= 1 && opt.bits_per_key > 0 &&
+           opt.repeat > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0]
+                  << " [--keys=N] [--probes=N] [--hit-rate=F] [--bits-per-key=F] [--repeat=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "method,isa,ns_per_op,bytes,false_positive_rate" << std::endl;
+    run(opt);
+    return 0;
+}
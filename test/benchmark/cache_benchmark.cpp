@@ -0,0 +1,147 @@
+// 有界缓存基准测试
+//
+// 按 Zipf 分布生成 --ops 次 (flow, port) 键的访问，未命中时插入；比较
+// std::list<std::pair> + std::unordered_map 手写 LRU、lru_cache 与 clock_cache
+// 每次访问的耗时与命中率
+//
+// 输出 CSV（标准输出）:
+//   capacity,keys,method,ns_per_op,hit_ratio
+//
+// 参数:
+//   --capacity=N          缓存容量 (默认 1e5)
+//   --keys=N              不同键的个数 (默认 1e6)
+//   --ops=N               访问次数 (默认 1e7)
+//   --theta=X             Zipf 参数 (默认 0.99)
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../../include/my_stl/cache.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+using key = my_stl::pair<std::uint32_t, std::uint32_t>;
+
+struct Options {
+    std::size_t capacity = 100000;
+    std::size_t keys = 1000000;
+    std::size_t ops = 10000000;
+    double theta = 0.99;
+};
+
+// 常见的手写 LRU，每次插入分配一个链表节点和一个哈希表节点
+class list_lru {
+public:
+    explicit list_lru(std::size_t capacity) : capacity_(capacity) { index_.reserve(capacity); }
+
+    const std::uint64_t* get(const key& k) {
+        auto it = index_.find(k);
+        if (it == index_.end()) return nullptr;
+        order_.splice(order_.begin(), order_, it->second);
+        return &it->second->second;
+    }
+
+    void put(const key& k, std::uint64_t v) {
+        if (order_.size() == capacity_) {
+            index_.erase(order_.back().first);
+            order_.pop_back();
+        }
+        order_.emplace_front(k, v);
+        index_[k] = order_.begin();
+    }
+
+private:
+    using list_type = std::list<std::pair<key, std::uint64_t>>;
+
+    std::size_t capacity_;
+    list_type order_;
+    std::unordered_map<key, list_type::iterator> index_;
+};
+
+template <typename Cache>
+std::size_t replay(Cache& cache, const std::vector<key>& trace) {
+    std::size_t hits = 0;
+    for (const auto& k : trace) {
+        if (const auto* v = cache.get(k)) {
+            hits += *v != 0;
+        } else {
+            cache.put(k, std::uint64_t(k.first) + 1);
+        }
+    }
+    return hits;
+}
+
+void run(const Options& opt) {
+    bench::ZipfGenerator zipf(opt.keys, opt.theta);
+    std::vector<key> trace(opt.ops);
+    for (auto& k : trace) {
+        // 打散秩，避免热点键在哈希表中相邻
+        std::uint64_t h = bench::mix64(zipf());
+        k = key(static_cast<std::uint32_t>(h), static_cast<std::uint32_t>(h >> 48));
+    }
+
+    auto report = [&](const char* method, double ns, std::size_t hits) {
+        std::cout << opt.capacity << ',' << opt.keys << ',' << method << ',' << ns / static_cast<double>(opt.ops) << ','
+                  << static_cast<double>(hits) / static_cast<double>(opt.ops) << std::endl;
+    };
+
+    {
+        list_lru cache(opt.capacity);
+        bench::Stopwatch sw;
+        std::size_t hits = replay(cache, trace);
+        report("list_unordered_map", sw.elapsed_ns(), hits);
+    }
+    {
+        my_stl::lru_cache<key, std::uint64_t> cache(opt.capacity);
+        bench::Stopwatch sw;
+        std::size_t hits = replay(cache, trace);
+        report("lru_cache", sw.elapsed_ns(), hits);
+    }
+    {
+        my_stl::clock_cache<key, std::uint64_t> cache(opt.capacity);
+        bench::Stopwatch sw;
+        std::size_t hits = replay(cache, trace);
+        report("clock_cache", sw.elapsed_ns(), hits);
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--capacity=")) opt.capacity = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--keys=")) opt.keys = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--ops=")) opt.ops = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--theta=")) opt.theta = std::strtod(v, nullptr);
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.capacity > 0 && opt.keys > 1 && opt.ops > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--capacity=N] [--keys=N] [--ops=N] [--theta=X]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "capacity,keys,method,ns_per_op,hit_ratio" << std::endl;
+    run(opt);
+    return 0;
+}
@@ -0,0 +1,261 @@
+// 并发 pair 结构的多线程扩展性基准测试
+//
+// 对 atomic_pair、seqlock_pair、sharded_map 和 mpmc_queue 在 1..N 个线程、
+// 不同读写比例下测量总吞吐量和尾延迟。线程按“物理核心优先”的顺序绑定，
+// 输出中标明该线程数下是否用到了 SMT 兄弟线程。延迟按线程记入
+// latency_histogram，结束后合并再取百分位。
+//
+// 输出 CSV（标准输出）:
+//   structure,threads,read_ratio,smt,mops,p50_ns,p99_ns,p999_ns,max_ns
+//
+// 参数:
+//   --threads=1,2,4       线程数列表 (默认 1,2,4,... 直到允许的 CPU 数)
+//   --reads=0.5,0.9       读操作比例列表 (默认 0.5,0.9,0.99)
+//   --duration-ms=T       每个测量点的运行时间 (默认 300)
+//   --structures=a,b      atomic,seqlock,map,queue (默认全部)
+//   --keys=N              sharded_map 的键空间大小 (默认 65536)
+//   --sample=K            每 K 次操作采样一次延迟 (默认 16)
+//   --no-pin              不绑定线程
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../include/my_stl/concurrent.hpp"
+#include "../../include/my_stl/histogram.hpp"
+#include "bench_util.hpp"
+#include "cpu_topology.hpp"
+
+namespace {
+
+struct Options {
+    std::vector<int> threads;
+    std::vector<double> reads = {0.5, 0.9, 0.99};
+    std::vector<std::string> structures = {"atomic", "seqlock", "map", "queue"};
+    double duration_ms = 300;
+    std::uint32_t keys = 65536;
+    std::uint32_t sample_every = 16;
+    bool pin = true;
+};
+
+template <typename T>
+std::vector<T> split_list(const std::string& text) {
+    std::vector<T> out;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) continue;
+        std::stringstream conv(item);
+        T value;
+        conv >> value;
+        out.push_back(value);
+    }
+    return out;
+}
+
+struct XorShift {
+    std::uint64_t state;
+    explicit XorShift(std::uint64_t seed) : state(bench::mix64(seed) | 1) {}
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+struct ThreadResult {
+    std::uint64_t ops = 0;
+    my_stl::latency_histogram latencies;
+};
+
+struct RunResult {
+    double mops = 0;
+    std::uint64_t p50 = 0;
+    std::uint64_t p99 = 0;
+    std::uint64_t p999 = 0;
+    std::uint64_t max = 0;
+};
+
+// 在 threads 个线程上运行 op(rng, is_read)，直到时间用完
+template <typename Op>
+RunResult run_threads(const Options& opt, const std::vector<int>& cpus, int threads,
+                      double read_ratio, Op&& op) {
+    std::atomic<int> ready{0};
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::vector<ThreadResult> results(threads);
+    std::vector<std::thread> workers;
+    const auto read_threshold = static_cast<std::uint64_t>(read_ratio * 1024.0);
+
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            if (opt.pin) bench::pin_current_thread(cpus[static_cast<std::size_t>(t) % cpus.size()]);
+            XorShift rng(static_cast<std::uint64_t>(t) + 1);
+            auto& result = results[t];
+
+            ready.fetch_add(1);
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+
+            std::uint64_t ops = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                bool is_read = (rng.next() & 1023) < read_threshold;
+                if (ops % opt.sample_every == 0) {
+                    bench::Stopwatch sw;
+                    op(rng, is_read);
+                    result.latencies.record(static_cast<std::uint64_t>(sw.elapsed_ns()));
+                } else {
+                    op(rng, is_read);
+                }
+                ++ops;
+            }
+            result.ops = ops;
+        });
+    }
+
+    while (ready.load() != threads) std::this_thread::yield();
+    bench::Stopwatch wall;
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::microseconds(static_cast<long>(opt.duration_ms * 1000)));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& w : workers) w.join();
+    double elapsed_ns = wall.elapsed_ns();
+
+    RunResult run;
+    my_stl::latency_histogram all;
+    std::uint64_t total_ops = 0;
+    for (auto& r : results) {
+        total_ops += r.ops;
+        all.merge(r.latencies);
+    }
+    run.mops = static_cast<double>(total_ops) / elapsed_ns * 1e3;
+    run.p50 = all.value_at_percentile(50);
+    run.p99 = all.value_at_percentile(99);
+    run.p999 = all.value_at_percentile(99.9);
+    run.max = all.max();
+    return run;
+}
+
+void emit(const std::string& name, int threads, double read_ratio, bool smt, const RunResult& r) {
+    std::cout << name << ',' << threads << ',' << read_ratio << ',' << (smt ? 1 : 0) << ','
+              << r.mops << ',' << r.p50 << ',' << r.p99 << ',' << r.p999 << ',' << r.max << std::endl;
+}
+
+using Key = my_stl::pair<std::uint32_t, std::uint32_t>;
+
+void run_structure(const Options& opt, const std::string& name, const std::vector<int>& cpus,
+                   int threads, double read_ratio) {
+    std::vector<int> used(cpus.begin(), cpus.begin() + std::min<std::size_t>(threads, cpus.size()));
+    bool smt = bench::smt_siblings_used(used) || static_cast<std::size_t>(threads) > cpus.size();
+    RunResult r;
+
+    if (name == "atomic") {
+        my_stl::atomic_pair<std::uint32_t, std::uint32_t> cell(Key(0, 0));
+        r = run_threads(opt, cpus, threads, read_ratio, [&](XorShift& rng, bool is_read) {
+            if (is_read) {
+                bench::do_not_optimize(cell.load(std::memory_order_acquire));
+            } else {
+                auto v = static_cast<std::uint32_t>(rng.next());
+                cell.store(Key(v, ~v), std::memory_order_release);
+            }
+        });
+    } else if (name == "seqlock") {
+        my_stl::seqlock_pair<std::uint64_t, std::uint64_t> cell;
+        r = run_threads(opt, cpus, threads, read_ratio, [&](XorShift& rng, bool is_read) {
+            if (is_read) {
+                bench::do_not_optimize(cell.load());
+            } else {
+                auto v = rng.next();
+                cell.store(my_stl::pair<std::uint64_t, std::uint64_t>(v, ~v));
+            }
+        });
+    } else if (name == "map") {
+        my_stl::sharded_map<Key, std::uint64_t> map;
+        for (std::uint32_t i = 0; i < opt.keys; i += 2) map.insert(Key(i, i * 7), i);
+        r = run_threads(opt, cpus, threads, read_ratio, [&](XorShift& rng, bool is_read) {
+            auto k = static_cast<std::uint32_t>(rng.next() % opt.keys);
+            if (is_read) {
+                bench::do_not_optimize(map.contains(Key(k, k * 7)));
+            } else {
+                map.insert_or_assign(Key(k, k * 7), k);
+            }
+        });
+    } else if (name == "queue") {
+        // 读 = 出队，写 = 入队；队列预先填充一半
+        my_stl::mpmc_queue<my_stl::pair<std::uint64_t, std::uint64_t>> queue(1 << 14);
+        for (std::size_t i = 0; i < queue.capacity() / 2; ++i) queue.try_emplace(i, i);
+        r = run_threads(opt, cpus, threads, read_ratio, [&](XorShift& rng, bool is_read) {
+            if (is_read) {
+                my_stl::pair<std::uint64_t, std::uint64_t> out;
+                bench::do_not_optimize(queue.try_pop(out));
+            } else {
+                auto v = rng.next();
+                bench::do_not_optimize(queue.try_emplace(v, v));
+            }
+        });
+    } else {
+        std::cerr << "unknown structure: " << name << std::endl;
+        return;
+    }
+
+    emit(name, threads, read_ratio, smt, r);
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--threads=")) opt.threads = split_list<int>(v);
+        else if (auto v = value("--reads=")) opt.reads = split_list<double>(v);
+        else if (auto v = value("--structures=")) opt.structures = split_list<std::string>(v);
+        else if (auto v = value("--duration-ms=")) opt.duration_ms = std::atof(v);
+        else if (auto v = value("--keys=")) opt.keys = static_cast<std::uint32_t>(bench::parse_size(v));
+        else if (auto v = value("--sample=")) opt.sample_every = std::max(1, std::atoi(v));
+        else if (arg == "--no-pin") opt.pin = false;
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.keys > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0]
+                  << " [--threads=1,2,4] [--reads=0.5,0.9] [--duration-ms=T]"
+                     " [--structures=atomic,seqlock,map,queue] [--keys=N] [--sample=K] [--no-pin]"
+                  << std::endl;
+        return 2;
+    }
+
+    auto cpus = bench::placement_order();
+    if (opt.threads.empty()) {
+        for (int t = 1; t < static_cast<int>(cpus.size()); t *= 2) opt.threads.push_back(t);
+        opt.threads.push_back(static_cast<int>(cpus.size()));
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "# cpus=" << cpus.size() << " physical_cores=" << bench::physical_core_count()
+              << " pinning=" << (opt.pin ? "on" : "off") << std::endl;
+    std::cout << "structure,threads,read_ratio,smt,mops,p50_ns,p99_ns,p999_ns,max_ns" << std::endl;
+
+    for (const auto& name : opt.structures) {
+        for (double reads : opt.reads) {
+            for (int threads : opt.threads) {
+                run_structure(opt, name, cpus, threads, reads);
+            }
+        }
+    }
+    return 0;
+}
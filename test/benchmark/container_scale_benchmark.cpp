@@ -0,0 +1,306 @@
+// 容器规模基准测试
+//
+// 在从 L1 常驻到 DRAM 受限的一系列规模上，比较 my_stl::pair 与 std::pair 作为键时
+// sort、lower_bound、顺序遍历、std::map、std::unordered_map 以及有序 vector
+// (flat_map) 的插入/查找吞吐量，键分布包括均匀分布和 Zipf 偏斜分布。
+//
+// 输出 CSV（标准输出），可用 tools/plot_scaling.py 绘制吞吐曲线：
+//   container_scale_benchmark --max=1e8 > scale.csv
+//   python3 tools/plot_scaling.py scale.csv -o scale.png
+//
+// 参数:
+//   --min=N               最小元素数 (默认 1e3)
+//   --max=N               最大元素数 (默认 1e6)
+//   --max-node=N          std::map/unordered_map 的最大元素数 (默认 1e7，节点容器内存开销大)
+//   --steps=K             每个数量级的采样点数 (默认 2)
+//   --min-time-ms=T       每个测量点的最短累计时间 (默认 100)
+//   --ops=a,b,...         sort,lower_bound,iterate,map,unordered_map,flat_map (默认全部)
+//   --dist=a,b            uniform,zipf (默认两者)
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../../include/my_stl/pair.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+struct Options {
+    std::uint64_t min_n = 1000;
+    std::uint64_t max_n = 1000000;
+    std::uint64_t max_node_n = 10000000;
+    int steps_per_decade = 2;
+    double min_time_ns = 100e6;
+    std::vector<std::string> ops = {"sort", "lower_bound", "iterate", "map", "unordered_map", "flat_map"};
+    std::vector<std::string> dists = {"uniform", "zipf"};
+
+    bool has_op(const std::string& op) const {
+        return std::find(ops.begin(), ops.end(), op) != ops.end();
+    }
+};
+
+std::vector<std::string> split(const std::string& text) {
+    std::vector<std::string> parts;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) parts.push_back(item);
+    }
+    return parts;
+}
+
+template <template <typename, typename> class P>
+struct PairName;
+
+template <>
+struct PairName<my_stl::pair> {
+    static const char* get() { return "my_stl::pair"; }
+};
+
+template <>
+struct PairName<std::pair> {
+    static const char* get() { return "std::pair"; }
+};
+
+// std::pair 没有 std::hash 特化，使用与 my_stl::pair 相同的组合方式
+struct StdPairHash {
+    std::size_t operator()(const std::pair<std::uint32_t, std::uint32_t>& p) const {
+        return std::hash<my_stl::pair<std::uint32_t, std::uint32_t>>{}(
+            my_stl::pair<std::uint32_t, std::uint32_t>(p.first, p.second));
+    }
+};
+
+template <template <typename, typename> class P>
+struct HashFor {
+    using type = std::hash<P<std::uint32_t, std::uint32_t>>;
+};
+
+template <>
+struct HashFor<std::pair> {
+    using type = StdPairHash;
+};
+
+// 把秩映射为打散的二元键
+template <typename Key>
+Key key_for_rank(std::uint64_t rank) {
+    std::uint64_t h = bench::mix64(rank);
+    return Key(static_cast<std::uint32_t>(h >> 32), static_cast<std::uint32_t>(h));
+}
+
+std::vector<std::uint64_t> draw_ranks(const std::string& dist, std::uint64_t universe,
+                                      std::uint64_t count, std::uint64_t seed) {
+    std::vector<std::uint64_t> ranks(count);
+    if (dist == "zipf") {
+        bench::ZipfGenerator zipf(universe, 0.99, seed);
+        for (auto& r : ranks) r = zipf();
+    } else {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<std::uint64_t> uniform(0, universe - 1);
+        for (auto& r : ranks) r = uniform(rng);
+    }
+    return ranks;
+}
+
+// 反复执行直到累计时间达到下限，返回每个元素的平均纳秒数（不计 setup 时间）
+template <typename Setup, typename Body>
+double measure(const Options& opt, std::uint64_t items, Setup&& setup, Body&& body) {
+    double total_ns = 0.0;
+    std::uint64_t reps = 0;
+    do {
+        setup();
+        bench::clobber_memory();
+        bench::Stopwatch sw;
+        body();
+        bench::clobber_memory();
+        total_ns += sw.elapsed_ns();
+        ++reps;
+    } while (total_ns < opt.min_time_ns);
+    return total_ns / (static_cast<double>(reps) * static_cast<double>(items));
+}
+
+void emit(const char* op, const char* pair_name, const std::string& dist,
+          std::uint64_t n, std::uint64_t bytes, double ns_per_item) {
+    std::cout << op << ',' << pair_name << ',' << dist << ',' << n << ',' << bytes << ','
+              << ns_per_item << ',' << (1e3 / ns_per_item) << std::endl;
+}
+
+template <template <typename, typename> class P>
+void run_size(const Options& opt, const std::string& dist, std::uint64_t n) {
+    using Key = P<std::uint32_t, std::uint32_t>;
+    using Entry = P<Key, std::uint64_t>;
+    const char* name = PairName<P>::get();
+
+    std::uint64_t query_count = std::min<std::uint64_t>(std::max<std::uint64_t>(n, 100000), 4000000);
+
+    std::vector<Key> keys;
+    keys.reserve(n);
+    for (auto r : draw_ranks(dist, n, n, 1)) keys.push_back(key_for_rank<Key>(r));
+
+    std::vector<Key> queries;
+    queries.reserve(query_count);
+    for (auto r : draw_ranks(dist, n, query_count, 2)) queries.push_back(key_for_rank<Key>(r));
+
+    std::vector<Key> sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    const std::uint64_t key_bytes = n * sizeof(Key);
+
+    if (opt.has_op("sort")) {
+        std::vector<Key> work;
+        double ns = measure(opt, n,
+            [&] { work = keys; },
+            [&] { std::sort(work.begin(), work.end()); });
+        emit("sort", name, dist, n, key_bytes, ns);
+    }
+
+    if (opt.has_op("lower_bound")) {
+        std::uint64_t hits = 0;
+        double ns = measure(opt, query_count, [] {}, [&] {
+            for (const auto& q : queries) {
+                auto it = std::lower_bound(sorted.begin(), sorted.end(), q);
+                hits += (it != sorted.end() && *it == q);
+            }
+        });
+        bench::do_not_optimize(hits);
+        emit("lower_bound", name, dist, n, key_bytes, ns);
+    }
+
+    if (opt.has_op("iterate")) {
+        std::uint64_t sum = 0;
+        double ns = measure(opt, n, [] {}, [&] {
+            for (const auto& k : sorted) sum += k.first ^ k.second;
+        });
+        bench::do_not_optimize(sum);
+        emit("iterate", name, dist, n, key_bytes, ns);
+    }
+
+    if (opt.has_op("map") && n <= opt.max_node_n) {
+        std::map<Key, std::uint64_t> m;
+        double insert_ns = measure(opt, n,
+            [&] { m.clear(); },
+            [&] {
+                std::uint64_t i = 0;
+                for (const auto& k : keys) m.emplace(k, i++);
+            });
+        emit("map_insert", name, dist, n, m.size() * (sizeof(Key) + sizeof(std::uint64_t) + 32), insert_ns);
+
+        std::uint64_t found = 0;
+        double lookup_ns = measure(opt, query_count, [] {}, [&] {
+            for (const auto& q : queries) found += m.count(q);
+        });
+        bench::do_not_optimize(found);
+        emit("map_lookup", name, dist, n, m.size() * (sizeof(Key) + sizeof(std::uint64_t) + 32), lookup_ns);
+    }
+
+    if (opt.has_op("unordered_map") && n <= opt.max_node_n) {
+        std::unordered_map<Key, std::uint64_t, typename HashFor<P>::type> m;
+        double insert_ns = measure(opt, n,
+            [&] { m.clear(); },
+            [&] {
+                std::uint64_t i = 0;
+                for (const auto& k : keys) m.emplace(k, i++);
+            });
+        std::uint64_t bytes = m.size() * (sizeof(Key) + sizeof(std::uint64_t) + 16) + m.bucket_count() * sizeof(void*);
+        emit("unordered_map_insert", name, dist, n, bytes, insert_ns);
+
+        std::uint64_t found = 0;
+        double lookup_ns = measure(opt, query_count, [] {}, [&] {
+            for (const auto& q : queries) found += m.count(q);
+        });
+        bench::do_not_optimize(found);
+        emit("unordered_map_lookup", name, dist, n, bytes, lookup_ns);
+    }
+
+    if (opt.has_op("flat_map")) {
+        // 有序 vector 上的映射：批量构建 (sort + unique) 与二分查找
+        std::vector<Entry> flat;
+        auto less_first = [](const Entry& a, const Entry& b) { return a.first < b.first; };
+        auto equal_first = [](const Entry& a, const Entry& b) { return a.first == b.first; };
+        double build_ns = measure(opt, n,
+            [&] { flat.clear(); flat.reserve(n); },
+            [&] {
+                std::uint64_t i = 0;
+                for (const auto& k : keys) flat.emplace_back(k, i++);
+                std::stable_sort(flat.begin(), flat.end(), less_first);
+                flat.erase(std::unique(flat.begin(), flat.end(), equal_first), flat.end());
+            });
+        std::uint64_t bytes = flat.size() * sizeof(Entry);
+        emit("flat_map_insert", name, dist, n, bytes, build_ns);
+
+        std::uint64_t found = 0;
+        double lookup_ns = measure(opt, query_count, [] {}, [&] {
+            for (const auto& q : queries) {
+                auto it = std::lower_bound(flat.begin(), flat.end(), q,
+                                           [](const Entry& e, const Key& k) { return e.first < k; });
+                found += (it != flat.end() && it->first == q);
+            }
+        });
+        bench::do_not_optimize(found);
+        emit("flat_map_lookup", name, dist, n, bytes, lookup_ns);
+    }
+}
+
+std::vector<std::uint64_t> size_series(const Options& opt) {
+    std::vector<std::uint64_t> sizes;
+    double step = std::pow(10.0, 1.0 / opt.steps_per_decade);
+    for (double n = static_cast<double>(opt.min_n); n <= static_cast<double>(opt.max_n) * 1.0001; n *= step) {
+        sizes.push_back(static_cast<std::uint64_t>(std::llround(n)));
+    }
+    return sizes;
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--min=")) opt.min_n = bench::parse_size(v);
+        else if (auto v = value("--max=")) opt.max_n = bench::parse_size(v);
+        else if (auto v = value("--max-node=")) opt.max_node_n = bench::parse_size(v);
+        else if (auto v = value("--steps=")) opt.steps_per_decade = std::max(1, std::atoi(v));
+        else if (auto v = value("--min-time-ms=")) opt.min_time_ns = std::atof(v) * 1e6;
+        else if (auto v = value("--ops=")) opt.ops = split(v);
+        else if (auto v = value("--dist=")) opt.dists = split(v);
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.min_n > 0 && opt.min_n <= opt.max_n;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0]
+                  << " [--min=N] [--max=N] [--max-node=N] [--steps=K] [--min-time-ms=T]"
+                     " [--ops=sort,lower_bound,iterate,map,unordered_map,flat_map] [--dist=uniform,zipf]"
+                  << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    auto caches = bench::cache_sizes();
+    std::cout << "# cache l1d=" << caches.l1d << " l2=" << caches.l2 << " l3=" << caches.l3 << std::endl;
+    std::cout << "op,pair,dist,n,bytes,ns_per_item,mitems_per_s" << std::endl;
+
+    for (auto n : size_series(opt)) {
+        for (const auto& dist : opt.dists) {
+            run_size<my_stl::pair>(opt, dist, n);
+            run_size<std::pair>(opt, dist, n);
+        }
+    }
+    return 0;
+}
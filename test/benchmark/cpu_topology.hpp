@@ -0,0 +1,118 @@
+// CPU 拓扑与线程绑定工具（Linux 实现，其他平台退化为不绑定）
+//
+// - allowed_cpus(): 当前进程允许运行的 CPU
+// - placement_order(): 先为每个物理核心选一个逻辑 CPU，再追加 SMT 兄弟线程，
+//   这样前 N 个线程总是落在不同的物理核心上
+// - smt_siblings_used(): 给定前 N 个 CPU 中是否出现同一物理核心的兄弟线程
+// - pin_current_thread(): 把当前线程绑定到指定 CPU
+
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace bench {
+
+struct CpuInfo {
+    int cpu = 0;
+    int package = 0;
+    int core = 0;
+};
+
+inline int read_int_file(const std::string& path, int fallback) {
+    std::ifstream in(path);
+    int value = fallback;
+    if (in) in >> value;
+    return value;
+}
+
+inline std::vector<int> allowed_cpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int i = 0; i < CPU_SETSIZE; ++i) {
+            if (CPU_ISSET(i, &set)) cpus.push_back(i);
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        unsigned n = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 0; i < n; ++i) cpus.push_back(static_cast<int>(i));
+    }
+    return cpus;
+}
+
+inline CpuInfo cpu_info(int cpu) {
+    std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+    CpuInfo info;
+    info.cpu = cpu;
+    info.package = read_int_file(base + "physical_package_id", 0);
+    info.core = read_int_file(base + "core_id", cpu);
+    return info;
+}
+
+// 物理核心优先的 CPU 顺序
+inline std::vector<int> placement_order() {
+    std::map<std::pair<int, int>, std::vector<int>> by_core;
+    for (int cpu : allowed_cpus()) {
+        auto info = cpu_info(cpu);
+        by_core[{info.package, info.core}].push_back(cpu);
+    }
+
+    std::vector<int> order;
+    for (std::size_t round = 0;; ++round) {
+        bool added = false;
+        for (auto& entry : by_core) {
+            if (round < entry.second.size()) {
+                order.push_back(entry.second[round]);
+                added = true;
+            }
+        }
+        if (!added) break;
+    }
+    return order;
+}
+
+inline bool smt_siblings_used(const std::vector<int>& cpus) {
+    std::set<std::pair<int, int>> cores;
+    for (int cpu : cpus) {
+        auto info = cpu_info(cpu);
+        if (!cores.insert({info.package, info.core}).second) return true;
+    }
+    return false;
+}
+
+inline int physical_core_count() {
+    std::set<std::pair<int, int>> cores;
+    for (int cpu : allowed_cpus()) {
+        auto info = cpu_info(cpu);
+        cores.insert({info.package, info.core});
+    }
+    return static_cast<int>(cores.size());
+}
+
+inline bool pin_current_thread(int cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+} // namespace bench
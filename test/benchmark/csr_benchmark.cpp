@@ -0,0 +1,118 @@
+// CSR 构建基准测试
+//
+// 生成 --edges 条随机有向边 (源顶点按幂律偏斜，模拟社交图)，比较通过
+// std::map<uint32_t, std::vector<uint32_t>> 构建邻接表与 build_csr 的耗时；
+// 两种方式都做对称化、行内排序和去重，最后核对弧数一致
+//
+// 输出 CSV（标准输出）:
+//   vertices,edges,method,threads,ms,arcs
+//
+// 参数:
+//   --vertices=N          顶点数 (默认 1e6)
+//   --edges=N             边数 (默认 1e7)
+//   --threads=N           build_csr 的最大线程数 (默认为硬件线程数，依次测 1, 2, 4 ... N)
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../include/my_stl/csr_graph.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+using edge = my_stl::pair<std::uint32_t, std::uint32_t>;
+
+struct Options {
+    std::size_t vertices = 1000000;
+    std::size_t edges = 10000000;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+};
+
+void run(const Options& opt) {
+    std::vector<edge> edges(opt.edges);
+    const double n = static_cast<double>(opt.vertices);
+    for (std::size_t i = 0; i < opt.edges; ++i) {
+        std::uint64_t h = bench::mix64(i);
+        // u = n^x，x 均匀分布，小编号的顶点出度大
+        double x = static_cast<double>(h >> 11) * 0x1.0p-53;
+        auto u = static_cast<std::uint32_t>(std::min(n - 1, std::pow(n, x) - 1));
+        auto v = static_cast<std::uint32_t>(bench::mix64(h) % opt.vertices);
+        edges[i] = edge(u, v);
+    }
+
+    auto report = [&](const char* method, unsigned threads, double ns, std::size_t arcs) {
+        std::cout << opt.vertices << ',' << opt.edges << ',' << method << ',' << threads << ',' << ns / 1e6 << ','
+                  << arcs << std::endl;
+    };
+
+    std::size_t expected = 0;
+    {
+        bench::Stopwatch sw;
+        std::map<std::uint32_t, std::vector<std::uint32_t>> adjacency;
+        for (const auto& e : edges) {
+            adjacency[e.first].push_back(e.second);
+            if (e.first != e.second) adjacency[e.second].push_back(e.first);
+        }
+        for (auto& row : adjacency) {
+            std::sort(row.second.begin(), row.second.end());
+            row.second.erase(std::unique(row.second.begin(), row.second.end()), row.second.end());
+            expected += row.second.size();
+        }
+        report("std_map", 1, sw.elapsed_ns(), expected);
+    }
+
+    my_stl::csr_options options;
+    options.num_vertices = static_cast<std::uint32_t>(opt.vertices);
+    options.symmetrize = true;
+    options.dedup = true;
+    for (unsigned threads = 1;; threads = std::min(threads * 2, opt.threads)) {
+        options.threads = threads;
+        bench::Stopwatch sw;
+        auto g = my_stl::build_csr(edges, options);
+        double ns = sw.elapsed_ns();
+        bench::do_not_optimize(g.targets().data());
+        report("build_csr", threads, ns, g.num_edges());
+        if (g.num_edges() != expected) std::exit(1);
+        if (threads == opt.threads) break;
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--vertices=")) opt.vertices = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--edges=")) opt.edges = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--threads=")) opt.threads = static_cast<unsigned>(bench::parse_size(v));
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.vertices > 0 && opt.vertices <= 0xFFFFFFFFu && opt.threads > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--vertices=N] [--edges=N] [--threads=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "vertices,edges,method,threads,ms,arcs" << std::endl;
+    run(opt);
+    return 0;
+}
@@ -0,0 +1,119 @@
+// 按成员过滤 pair 数组的基准测试
+//
+// 在 (uint64_t 时间戳, double 值) 和 (uint32_t, float) 数组上按 first 的区间过滤，
+// 比较带分支的 copy_if 式循环与 filter_pairs 每个可运行的指令集等级。
+// 时间戳随机排列，选择率 1%、10%、50% 时带分支的循环分别受分支预测失败影响。
+//
+// 输出 CSV（标准输出）:
+//   types,selectivity_pct,method,ns_per_item
+//
+// 参数:
+//   --n=N                 元素个数 (默认 1e7)
+//   --repeat=N            每个测量点的重复次数，取最短 (默认 5)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../include/my_stl/filter.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+struct Options {
+    std::size_t n = 10000000;
+    int repeat = 5;
+};
+
+template <typename Fn>
+double best_of(int repeat, Fn&& fn) {
+    double best = 0;
+    for (int r = 0; r < repeat; ++r) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = r == 0 ? t : std::min(best, t);
+    }
+    return best;
+}
+
+template <typename A, typename B>
+void run_types(const Options& opt, const char* types) {
+    using P = my_stl::pair<A, B>;
+    std::vector<P> data(opt.n);
+    for (std::size_t i = 0; i < opt.n; ++i) {
+        data[i] = P(static_cast<A>(bench::mix64(i) % 1000), static_cast<B>(i % 100));
+    }
+    std::vector<P> out(opt.n);
+
+    for (int pct : {1, 10, 50}) {
+        const auto on_first = my_stl::member_range<A>::between(A(0), static_cast<A>(10 * pct - 1));
+        const auto on_second = my_stl::member_range<B>::any();
+        auto report = [&](const std::string& method, double ns) {
+            std::cout << types << ',' << pct << ',' << method << ',' << ns / opt.n << std::endl;
+        };
+
+        std::size_t expected = 0;
+        report("branchy", best_of(opt.repeat, [&] {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < opt.n; ++i) {
+                if (on_first(data[i].first) && on_second(data[i].second)) out[count++] = data[i];
+            }
+            expected = count;
+            bench::clobber_memory();
+        }));
+
+        const auto& table = my_stl::detail::filter_table<A, B>();
+        for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+            auto level = static_cast<my_stl::simd::isa>(l);
+            if (table.resolved_level(level) != level) continue;
+            auto fn = table.resolve(level);
+            std::size_t count = 0;
+            report(std::string("filter_pairs/") + my_stl::simd::isa_name(level), best_of(opt.repeat, [&] {
+                count = fn(data.data(), opt.n, on_first, on_second, out.data());
+                bench::clobber_memory();
+            }));
+            if (count != expected) {
+                std::cerr << "result mismatch: " << count << " != " << expected << std::endl;
+                std::exit(1);
+            }
+        }
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--n=")) opt.n = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--repeat=")) opt.repeat = std::max(1, std::atoi(v));
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--n=N] [--repeat=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "# " << my_stl::simd::describe_cpu() << std::endl;
+    std::cout << "types,selectivity_pct,method,ns_per_item" << std::endl;
+    run_types<std::uint64_t, double>(opt, "u64/f64");
+    run_types<std::uint32_t, float>(opt, "u32/f32");
+    return 0;
+}
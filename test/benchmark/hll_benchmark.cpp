@@ -0,0 +1,171 @@
+// 基数估计基准测试
+//
+// 生成 --windows 个时间窗口，每个窗口 --events 个 (user, item) 事件 (用户按 Zipf 分布偏斜，
+// 不同窗口的 item 部分重叠)，比较每个窗口一个 std::unordered_set 精确计数与一个 hyperloglog 的
+// 每个事件耗时、全部窗口占用的内存与平均相对误差，以及在每个可运行指令集等级上把所有窗口合并为总数的耗时
+//
+// 输出 CSV（标准输出）:
+//   method,isa,ns_per_op,bytes,mean_rel_error
+//
+// 参数:
+//   --windows=N           窗口数 (默认 200)
+//   --events=N            每个窗口的事件数 (默认 1e5)
+//   --users=N             不同用户数 (默认 1e5)
+//   --precision=P         hyperloglog 精度 (默认 14)
+//   --repeat=N            每个测量点的重复次数，取最短 (默认 3)
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "../../include/my_stl/hyperloglog.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+using user_item = my_stl::pair<std::uint32_t, std::uint32_t>;
+using estimator = my_stl::hyperloglog<std::uint32_t, std::uint32_t>;
+using isa = my_stl::simd::isa;
+
+struct Options {
+    std::size_t windows = 200;
+    std::size_t events = 100000;
+    std::size_t users = 100000;
+    unsigned precision = 14;
+    int repeat = 3;
+};
+
+template <typename Fn>
+double best_of(int repeat, Fn&& fn) {
+    double best = 0;
+    for (int r = 0; r < repeat; ++r) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = r == 0 ? t : std::min(best, t);
+    }
+    return best;
+}
+
+void run(const Options& opt) {
+    bench::ZipfGenerator zipf(opt.users);
+    std::vector<std::vector<user_item>> windows(opt.windows);
+    for (std::size_t w = 0; w < opt.windows; ++w) {
+        windows[w].resize(opt.events);
+        for (std::size_t i = 0; i < opt.events; ++i) {
+            auto user = static_cast<std::uint32_t>(zipf());
+            // 每个窗口的 item 在前后窗口之间滑动，相邻窗口约一半重叠
+            auto item = static_cast<std::uint32_t>(w * 500 + bench::mix64(w * opt.events + i) % 1000);
+            windows[w][i] = user_item(user, item);
+        }
+    }
+    const double total_events = static_cast<double>(opt.windows * opt.events);
+    auto report = [&](const char* method, const char* level, double ns, double ops, std::size_t bytes,
+                      double error) {
+        std::cout << method << ',' << level << ',' << ns / ops << ',' << bytes << ',' << error << std::endl;
+    };
+
+    std::vector<std::size_t> exact(opt.windows);
+    {
+        std::size_t bytes = 0;
+        double ns = best_of(opt.repeat, [&] {
+            bytes = 0;
+            for (std::size_t w = 0; w < opt.windows; ++w) {
+                std::unordered_set<user_item> set(windows[w].begin(), windows[w].end());
+                exact[w] = set.size();
+                // 每个节点至少包含键、next 指针和缓存的哈希值，加上桶数组
+                bytes += set.size() * (sizeof(user_item) + 2 * sizeof(void*)) + set.bucket_count() * sizeof(void*);
+            }
+        });
+        report("unordered_set", "-", ns, total_events, bytes, 0);
+    }
+
+    std::vector<estimator> sketches;
+    {
+        double ns = best_of(opt.repeat, [&] {
+            sketches.assign(opt.windows, estimator(opt.precision));
+            for (std::size_t w = 0; w < opt.windows; ++w) sketches[w].add_batch(windows[w]);
+        });
+        std::size_t bytes = 0;
+        double error = 0;
+        for (std::size_t w = 0; w < opt.windows; ++w) {
+            bytes += sketches[w].memory_usage();
+            error += std::fabs(sketches[w].estimate() - static_cast<double>(exact[w])) / static_cast<double>(exact[w]);
+        }
+        report("hyperloglog", my_stl::simd::isa_name(my_stl::simd::active_isa()), ns, total_events, bytes,
+               error / static_cast<double>(opt.windows));
+    }
+
+    // 合并的是稠密寄存器，只测量内核本身
+    std::vector<std::vector<std::uint8_t>> registers(opt.windows, std::vector<std::uint8_t>(std::size_t(1) << opt.precision));
+    for (auto& r : registers) {
+        for (std::size_t i = 0; i < r.size(); ++i) r[i] = static_cast<std::uint8_t>(bench::mix64(i + r.size()) % 20);
+    }
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        auto level = static_cast<isa>(l);
+        if (my_stl::detail::hll_merge_table().resolved_level(level) != level) continue;
+        auto merge = my_stl::detail::hll_merge_table().resolve(level);
+        std::vector<std::uint8_t> total(registers[0].size());
+        double ns = best_of(opt.repeat, [&] {
+            std::fill(total.begin(), total.end(), std::uint8_t(0));
+            for (const auto& r : registers) merge(total.data(), r.data(), r.size());
+        });
+        bench::do_not_optimize(total.data());
+        report("merge_registers", my_stl::simd::isa_name(level), ns, static_cast<double>(opt.windows), total.size(), 0);
+    }
+
+    {
+        estimator all(opt.precision);
+        double ns = best_of(opt.repeat, [&] {
+            all.clear();
+            for (const auto& s : sketches) all.merge(s);
+        });
+        std::unordered_set<user_item> set;
+        for (const auto& w : windows) set.insert(w.begin(), w.end());
+        report("hyperloglog::merge", my_stl::simd::isa_name(my_stl::simd::active_isa()), ns,
+               static_cast<double>(opt.windows), all.memory_usage(),
+               std::fabs(all.estimate() - static_cast<double>(set.size())) / static_cast<double>(set.size()));
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--windows=")) opt.windows = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--events=")) opt.events = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--users=")) opt.users = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--precision=")) opt.precision = static_cast<unsigned>(std::atoi(v));
+        else if (auto v = value("--repeat=")) opt.repeat = std::atoi(v);
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.windows > 0 && opt.events > 0 && opt.users > 1 && opt.precision >= my_stl::detail::hll_min_precision &&
+           opt.precision <= my_stl::detail::hll_max_precision && opt.repeat > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--windows=N] [--events=N] [--users=N] [--precision=4..18] [--repeat=N]"
+                  << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "method,isa,ns_per_op,bytes,mean_rel_error" << std::endl;
+    run(opt);
+    return 0;
+}
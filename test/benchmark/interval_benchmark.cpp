@@ -0,0 +1,108 @@
+// 区间查询基准测试
+//
+// 生成 --rules 条 IP 范围规则 (大多是短区间，少量覆盖很宽的范围)，对随机地址做包含点查询
+// (stab)，比较线性扫描 (begin, end) 列表、interval_map 与 static_interval_map 每次查询的耗时。
+//
+// 输出 CSV（标准输出）:
+//   rules,method,ns_per_query,matches
+//
+// 参数:
+//   --rules=N             规则条数 (默认 1e5)
+//   --queries=N           查询次数 (默认 1e5)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../include/my_stl/interval_map.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+using range = my_stl::pair<std::uint32_t, std::uint32_t>;
+
+struct Options {
+    std::size_t rules = 100000;
+    std::size_t queries = 100000;
+};
+
+void run(const Options& opt) {
+    std::vector<my_stl::pair<range, std::uint32_t>> rules;
+    for (std::size_t i = 0; i < opt.rules; ++i) {
+        std::uint64_t h = bench::mix64(i);
+        auto begin = static_cast<std::uint32_t>(h);
+        std::uint32_t width = (h >> 32) % 100 == 0 ? (1u << 24) : 256u << ((h >> 40) % 4);
+        std::uint32_t end = begin > ~width ? ~0u : begin + width;
+        if (end == begin) continue;
+        rules.emplace_back(range(begin, end), static_cast<std::uint32_t>(i));
+    }
+    std::vector<std::uint32_t> addresses(opt.queries);
+    for (std::size_t i = 0; i < opt.queries; ++i) addresses[i] = static_cast<std::uint32_t>(bench::mix64(i + opt.rules));
+
+    auto report = [&](const char* method, double ns, std::size_t matches) {
+        std::cout << rules.size() << ',' << method << ',' << ns / opt.queries << ',' << matches << std::endl;
+    };
+
+    std::size_t expected = 0;
+    {
+        bench::Stopwatch sw;
+        for (std::uint32_t a : addresses) {
+            for (const auto& r : rules) expected += r.first.first <= a && a < r.first.second;
+        }
+        report("linear", sw.elapsed_ns(), expected);
+    }
+
+    my_stl::interval_map<std::uint32_t, std::uint32_t> dynamic;
+    for (const auto& r : rules) dynamic.insert(r);
+    {
+        std::size_t matches = 0;
+        bench::Stopwatch sw;
+        for (std::uint32_t a : addresses) dynamic.for_each_stab(a, [&](const range&, std::uint32_t) { ++matches; });
+        report("interval_map", sw.elapsed_ns(), matches);
+        if (matches != expected) std::exit(1);
+    }
+
+    my_stl::static_interval_map<std::uint32_t, std::uint32_t> frozen(rules.begin(), rules.end());
+    {
+        std::size_t matches = 0;
+        bench::Stopwatch sw;
+        for (std::uint32_t a : addresses) frozen.for_each_stab(a, [&](const range&, std::uint32_t) { ++matches; });
+        report("static_interval_map", sw.elapsed_ns(), matches);
+        if (matches != expected) std::exit(1);
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--rules=")) opt.rules = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--queries=")) opt.queries = static_cast<std::size_t>(bench::parse_size(v));
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.queries > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--rules=N] [--queries=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "rules,method,ns_per_query,matches" << std::endl;
+    run(opt);
+    return 0;
+}
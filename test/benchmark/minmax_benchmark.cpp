@@ -0,0 +1,148 @@
+// 最小/最大值的基准测试
+//
+// 在 uint32_t、double 数组和 pair<float, uint32_t> (分数, id) 数组上比较
+// std::minmax_element / std::min_element 与 minmax_element、argmin_pair 每个可运行的指令集等级，
+// 以及并行版本 (线程数为 hardware_concurrency)。
+//
+// 输出 CSV（标准输出）:
+//   data,method,ns_per_item
+//
+// 参数:
+//   --n=N                 元素个数 (默认 1e7)
+//   --repeat=N            每个测量点的重复次数，取最短 (默认 5)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../include/my_stl/minmax.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+struct Options {
+    std::size_t n = 10000000;
+    int repeat = 5;
+};
+
+template <typename Fn>
+double best_of(int repeat, Fn&& fn) {
+    double best = 0;
+    for (int r = 0; r < repeat; ++r) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = r == 0 ? t : std::min(best, t);
+    }
+    return best;
+}
+
+void check(bool ok) {
+    if (!ok) {
+        std::cerr << "result mismatch" << std::endl;
+        std::exit(1);
+    }
+}
+
+template <typename T>
+void run_elements(const Options& opt, const char* name) {
+    std::vector<T> data(opt.n);
+    for (std::size_t i = 0; i < opt.n; ++i) data[i] = static_cast<T>(bench::mix64(i) % 1000000007);
+    auto report = [&](const std::string& method, double ns) {
+        std::cout << name << ',' << method << ',' << ns / opt.n << std::endl;
+    };
+
+    const T* lo = nullptr;
+    const T* hi = nullptr;
+    report("std::minmax_element", best_of(opt.repeat, [&] {
+        auto r = std::minmax_element(data.data(), data.data() + opt.n);
+        lo = r.first;
+        hi = r.second;
+        bench::do_not_optimize(lo);
+    }));
+
+    const auto& table = my_stl::detail::minmax_table<T, 1>();
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        auto level = static_cast<my_stl::simd::isa>(l);
+        if (table.resolved_level(level) != level) continue;
+        auto fn = table.resolve(level);
+        T got_lo, got_hi;
+        report(std::string("minmax/") + my_stl::simd::isa_name(level), best_of(opt.repeat, [&] {
+            fn(data.data(), opt.n, got_lo, got_hi);
+            bench::do_not_optimize(got_lo);
+            bench::do_not_optimize(got_hi);
+        }));
+        check(got_lo == *lo && got_hi == *hi);
+    }
+
+    report("minmax_element", best_of(opt.repeat, [&] {
+        auto r = my_stl::minmax_element(data.data(), data.data() + opt.n);
+        check(r.first == lo && r.second == hi);
+    }));
+    report("minmax_element_parallel", best_of(opt.repeat, [&] {
+        auto r = my_stl::minmax_element_parallel(data.data(), data.data() + opt.n);
+        check(r.first == lo && r.second == hi);
+    }));
+}
+
+void run_scores(const Options& opt) {
+    using P = my_stl::pair<float, std::uint32_t>;
+    std::vector<P> data(opt.n);
+    for (std::size_t i = 0; i < opt.n; ++i) {
+        data[i] = P(static_cast<float>(bench::mix64(i) % 1000003) / 1000.0f, static_cast<std::uint32_t>(i));
+    }
+    auto report = [&](const std::string& method, double ns) {
+        std::cout << "pair<f32,u32>," << method << ',' << ns / opt.n << std::endl;
+    };
+
+    const P* expected = nullptr;
+    report("std::min_element", best_of(opt.repeat, [&] {
+        expected = std::min_element(data.data(), data.data() + opt.n,
+                                    [](const P& a, const P& b) { return a.first < b.first; });
+        bench::do_not_optimize(expected);
+    }));
+    report("argmin_pair", best_of(opt.repeat, [&] {
+        check(my_stl::argmin_pair(data.data(), data.data() + opt.n) == expected);
+    }));
+    report("argmin_pair_parallel", best_of(opt.repeat, [&] {
+        check(my_stl::argmin_pair_parallel(data.data(), data.data() + opt.n) == expected);
+    }));
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--n=")) opt.n = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--repeat=")) opt.repeat = std::max(1, std::atoi(v));
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return opt.n > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--n=N] [--repeat=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "# " << my_stl::simd::describe_cpu() << std::endl;
+    std::cout << "data,method,ns_per_item" << std::endl;
+    run_elements<std::uint32_t>(opt, "u32");
+    run_elements<double>(opt, "f64");
+    run_scores(opt);
+    return 0;
+}
@@ -0,0 +1,131 @@
+// Morton 编码与 Z-order 排序的基准测试
+//
+// encode/decode: 在 pair<uint32_t, uint32_t> 坐标数组上测量每个可运行指令集等级的批量编码/解码
+// sort:          比较以编码为比较键的 std::sort 与 morton_sort (批量编码 + 基数排序 + 解码)
+// 坐标取自一个 sqrt(n) × sqrt(n) 网格的随机排列
+//
+// 输出 CSV（标准输出）:
+//   op,method,ns_per_item
+//
+// 参数:
+//   --n=N                 元素个数 (默认 1e7)
+//   --repeat=N            每个测量点的重复次数，取最短 (默认 5)
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../include/my_stl/morton.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+using my_stl::morton_point;
+
+struct Options {
+    std::size_t n = 10000000;
+    int repeat = 5;
+};
+
+template <typename Fn>
+double best_of(int repeat, Fn&& fn) {
+    double best = 0;
+    for (int r = 0; r < repeat; ++r) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = r == 0 ? t : std::min(best, t);
+    }
+    return best;
+}
+
+void run(const Options& opt) {
+    const auto side = static_cast<std::uint32_t>(std::sqrt(static_cast<double>(opt.n))) + 1;
+    std::vector<morton_point> points(opt.n);
+    for (std::size_t i = 0; i < opt.n; ++i) {
+        std::uint64_t h = bench::mix64(i);
+        points[i] = morton_point(static_cast<std::uint32_t>(h % side), static_cast<std::uint32_t>((h >> 32) % side));
+    }
+    std::vector<std::uint64_t> codes(opt.n);
+    std::vector<morton_point> decoded(opt.n);
+    auto report = [&](const char* op, const std::string& method, double ns) {
+        std::cout << op << ',' << method << ',' << ns / opt.n << std::endl;
+    };
+
+    const auto& encode = my_stl::detail::morton_encode_table();
+    const auto& decode = my_stl::detail::morton_decode_table();
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        auto level = static_cast<my_stl::simd::isa>(l);
+        if (encode.resolved_level(level) != level) continue;
+        auto enc = encode.resolve(level);
+        auto dec = decode.resolve(level);
+        report("encode", my_stl::simd::isa_name(level), best_of(opt.repeat, [&] {
+            enc(points.data(), opt.n, codes.data());
+            bench::clobber_memory();
+        }));
+        report("decode", my_stl::simd::isa_name(level), best_of(opt.repeat, [&] {
+            dec(codes.data(), opt.n, decoded.data());
+            bench::clobber_memory();
+        }));
+        if (!std::equal(points.begin(), points.end(), decoded.begin())) {
+            std::cerr << "round trip mismatch" << std::endl;
+            std::exit(1);
+        }
+    }
+
+    std::vector<morton_point> sorted;
+    report("sort", "std::sort", best_of(opt.repeat, [&] {
+        sorted = points;
+        std::sort(sorted.begin(), sorted.end(), [](const morton_point& a, const morton_point& b) {
+            return my_stl::morton_encode(a) < my_stl::morton_encode(b);
+        });
+        bench::clobber_memory();
+    }));
+    std::vector<morton_point> radix_sorted;
+    report("sort", "morton_sort", best_of(opt.repeat, [&] {
+        radix_sorted = points;
+        my_stl::morton_sort(radix_sorted.data(), radix_sorted.size());
+        bench::clobber_memory();
+    }));
+    if (sorted != radix_sorted) {
+        std::cerr << "sort mismatch" << std::endl;
+        std::exit(1);
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--n=")) opt.n = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--repeat=")) opt.repeat = std::max(1, std::atoi(v));
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--n=N] [--repeat=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "# " << my_stl::simd::describe_cpu() << std::endl;
+    std::cout << "op,method,ns_per_item" << std::endl;
+    run(opt);
+    return 0;
+}
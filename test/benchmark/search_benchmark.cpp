@@ -0,0 +1,138 @@
+// 有序 pair 数组查找基准测试
+//
+// 在按 first 排序的 pair<uint32_t, uint32_t> / pair<uint64_t, uint64_t> 数组上比较:
+//   std      std::lower_bound + pair::operator< (以 (key, 0) 为键，结果与按 first 查找相同)
+//   single   my_stl::lower_bound_first (无分支二分 + SIMD 窗口)
+//   batch    my_stl::lower_bound_first_batch (16 个键交错推进并预取)
+//   eytzinger my_stl::static_index::successor (Eytzinger 布局，预取后代)
+//   learned  my_stl::learned_index::lower_bound (RadixSpline，误差 32)
+// 数组大小从 L1 常驻到远超 LLC，键近似线性增长 (带随机抖动，类似时间戳)，
+// 查找键在键范围内均匀随机选取。
+//
+// 输出 CSV（标准输出）:
+//   types,n,method,isa,ns_per_lookup
+//
+// 参数:
+//   --max-n=N             最大元素个数 (默认 1e7)
+//   --lookups=N           每个测量点的查找次数 (默认 1e6)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../include/my_stl/search.hpp"
+#include "../../include/my_stl/static_index.hpp"
+#include "../../include/my_stl/learned_index.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+struct Options {
+    std::size_t max_n = 10000000;
+    std::size_t lookups = 1000000;
+};
+
+template <typename K>
+void run_types(const Options& opt, const char* types) {
+    using P = my_stl::pair<K, K>;
+    const char* isa = my_stl::simd::isa_name(my_stl::detail::lower_bound_table<K>().resolved_level(my_stl::simd::active_isa()));
+
+    for (std::size_t n = 1000; n <= opt.max_n; n *= 10) {
+        // 键为 4i 或 4i + 2，查找时也会命中不存在的键
+        std::vector<P> data(n);
+        for (std::size_t i = 0; i < n; ++i) data[i] = P(static_cast<K>(4 * i + (bench::mix64(i) & 2)), static_cast<K>(i));
+        std::vector<K> keys(opt.lookups);
+        for (std::size_t j = 0; j < keys.size(); ++j) keys[j] = static_cast<K>(bench::mix64(j + n) % (4 * n));
+
+        const P* first = data.data();
+        const P* last = data.data() + n;
+        std::vector<std::size_t> out(keys.size());
+        auto report = [&](const char* method, double ns) {
+            std::cout << types << ',' << n << ',' << method << ',' << isa << ',' << ns / keys.size() << std::endl;
+        };
+
+        {
+            bench::Stopwatch sw;
+            for (std::size_t j = 0; j < keys.size(); ++j) {
+                out[j] = static_cast<std::size_t>(std::lower_bound(first, last, P(keys[j], 0)) - first);
+            }
+            bench::clobber_memory();
+            report("std", sw.elapsed_ns());
+        }
+        std::vector<std::size_t> expected = out;
+        {
+            bench::Stopwatch sw;
+            for (std::size_t j = 0; j < keys.size(); ++j) {
+                out[j] = static_cast<std::size_t>(my_stl::lower_bound_first(first, last, keys[j]) - first);
+            }
+            bench::clobber_memory();
+            report("single", sw.elapsed_ns());
+        }
+        {
+            bench::Stopwatch sw;
+            my_stl::lower_bound_first_batch(first, last, keys.data(), keys.size(), out.data());
+            bench::clobber_memory();
+            report("batch", sw.elapsed_ns());
+        }
+        {
+            my_stl::static_index<K, K> index(data.begin(), data.end());
+            bench::Stopwatch sw;
+            for (std::size_t j = 0; j < keys.size(); ++j) {
+                auto found = index.successor(keys[j]);
+                out[j] = found ? static_cast<std::size_t>(found->second) : n;
+            }
+            bench::clobber_memory();
+            report("eytzinger", sw.elapsed_ns());
+        }
+        {
+            my_stl::learned_index<K, K> index(first, last, 32);
+            bench::Stopwatch sw;
+            for (std::size_t j = 0; j < keys.size(); ++j) {
+                out[j] = static_cast<std::size_t>(index.lower_bound(keys[j]) - first);
+            }
+            bench::clobber_memory();
+            report("learned", sw.elapsed_ns());
+        }
+        if (out != expected) {
+            std::cerr << "result mismatch at n=" << n << std::endl;
+            std::exit(1);
+        }
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--max-n=")) opt.max_n = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--lookups=")) opt.lookups = static_cast<std::size_t>(bench::parse_size(v));
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--max-n=N] [--lookups=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "# " << my_stl::simd::describe_cpu() << std::endl;
+    std::cout << "types,n,method,isa,ns_per_lookup" << std::endl;
+    run_types<std::uint32_t>(opt, "u32/u32");
+    run_types<std::uint64_t>(opt, "u64/u64");
+    return 0;
+}
@@ -0,0 +1,164 @@
+// 计数草图基准测试
+//
+// 生成 --events 个 (src_ip, dst_port) 流事件 (按 Zipf 分布偏斜)，比较 std::unordered_map 精确计数、
+// count_min_sketch 在每个可运行指令集等级上的批量更新 (普通与保守更新) 和批量估计，
+// 以及 space_saving top-k 的每个事件耗时与内存
+//
+// 输出 CSV（标准输出）:
+//   method,isa,ns_per_event,bytes
+//
+// 参数:
+//   --events=N            事件数 (默认 1e7)
+//   --flows=N             不同流的个数 (默认 1e6)
+//   --width=N             草图宽度 (默认 2^16)
+//   --depth=N             草图深度 (默认 4)
+//   --k=N                 top-k 的条目数 (默认 1000)
+//   --repeat=N            每个测量点的重复次数，取最短 (默认 3)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../../include/my_stl/sketch.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+using flow = my_stl::pair<std::uint32_t, std::uint16_t>;
+using isa = my_stl::simd::isa;
+
+struct Options {
+    std::size_t events = 10000000;
+    std::size_t flows = 1000000;
+    std::size_t width = 1 << 16;
+    std::size_t depth = 4;
+    std::size_t k = 1000;
+    int repeat = 3;
+};
+
+template <typename Fn>
+double best_of(int repeat, Fn&& fn) {
+    double best = 0;
+    for (int r = 0; r < repeat; ++r) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = r == 0 ? t : std::min(best, t);
+    }
+    return best;
+}
+
+void run(const Options& opt) {
+    bench::ZipfGenerator zipf(opt.flows);
+    std::vector<flow> events(opt.events);
+    for (auto& e : events) {
+        std::uint64_t h = bench::mix64(zipf());
+        e = flow(static_cast<std::uint32_t>(h), static_cast<std::uint16_t>(h >> 48));
+    }
+    auto report = [&](const std::string& method, const char* level, double ns, std::size_t bytes) {
+        std::cout << method << ',' << level << ',' << ns / static_cast<double>(opt.events) << ',' << bytes << std::endl;
+    };
+
+    {
+        std::size_t distinct = 0;
+        double ns = best_of(opt.repeat, [&] {
+            std::unordered_map<flow, std::uint32_t> exact;
+            for (const auto& e : events) ++exact[e];
+            distinct = exact.size();
+        });
+        // 每个节点至少包含键、计数、next 指针和缓存的哈希值
+        report("unordered_map", "-", ns, distinct * (sizeof(flow) + 4 + 2 * sizeof(void*)));
+    }
+
+    using sketch = my_stl::count_min_sketch<std::uint32_t, std::uint16_t>;
+    std::vector<std::uint64_t> hashes(events.size());
+    for (std::size_t i = 0; i < events.size(); ++i) hashes[i] = bench::mix64(my_stl::pair_hash{}(events[i]));
+    std::vector<std::uint32_t> table(opt.width * opt.depth);
+    // 只测量在该等级有专门实现的内核
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        auto level = static_cast<isa>(l);
+        if (my_stl::detail::cms_update_table().resolved_level(level) != level) continue;
+        auto update = my_stl::detail::cms_update_table().resolve(level);
+        for (bool conservative : {false, true}) {
+            double ns = best_of(opt.repeat, [&] {
+                std::fill(table.begin(), table.end(), 0u);
+                update(table.data(), opt.width, opt.depth, hashes.data(), hashes.size(), 1, conservative);
+            });
+            report(conservative ? "cms_update_conservative" : "cms_update", my_stl::simd::isa_name(level), ns,
+                   table.size() * 4);
+        }
+    }
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        auto level = static_cast<isa>(l);
+        if (my_stl::detail::cms_estimate_table().resolved_level(level) != level) continue;
+        auto estimate = my_stl::detail::cms_estimate_table().resolve(level);
+        std::vector<std::uint32_t> out(hashes.size());
+        double ns = best_of(opt.repeat, [&] {
+            estimate(table.data(), opt.width, opt.depth, hashes.data(), hashes.size(), out.data());
+        });
+        bench::do_not_optimize(out.data());
+        report("cms_estimate", my_stl::simd::isa_name(level), ns, table.size() * 4);
+    }
+
+    {
+        sketch cms(opt.width, opt.depth, my_stl::cms_update::conservative);
+        double ns = best_of(opt.repeat, [&] {
+            cms.clear();
+            cms.add_batch(events.data(), events.size());
+        });
+        report("count_min_sketch::add_batch", my_stl::simd::isa_name(my_stl::simd::active_isa()), ns,
+               cms.memory_usage());
+    }
+    {
+        std::size_t bytes = 0;
+        double ns = best_of(opt.repeat, [&] {
+            my_stl::space_saving<std::uint32_t, std::uint16_t> top_k(opt.k);
+            top_k.offer_batch(events.data(), events.size());
+            bytes = opt.k * (sizeof(my_stl::space_saving<std::uint32_t, std::uint16_t>::counter) + 8 + 8 + 8);
+        });
+        report("space_saving", "-", ns, bytes);
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--events=")) opt.events = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--flows=")) opt.flows = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--width=")) opt.width = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--depth=")) opt.depth = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--k=")) opt.k = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--repeat=")) opt.repeat = std::atoi(v);
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    // 内核要求宽度为 2 的幂
+    return opt.events > 0 && opt.flows > 1 && opt.width > 0 && (opt.width & (opt.width - 1)) == 0 && opt.depth > 0 &&
+           opt.k > 0 && opt.repeat > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0]
+                  << " [--events=N] [--flows=N] [--width=POW2] [--depth=N] [--k=N] [--repeat=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "method,isa,ns_per_event,bytes" << std::endl;
+    run(opt);
+    return 0;
+}
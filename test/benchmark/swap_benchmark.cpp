@@ -0,0 +1,122 @@
+// 成员交换与区间交换的基准测试
+//
+// swap_members: 在 pair<uint32_t, uint32_t> (边) 和 pair<uint64_t, uint64_t> 数组上，
+//   比较逐元素 std::swap(p.first, p.second) 与 swap_members 每个可运行的指令集等级
+// swap_ranges:  比较 std::swap_ranges (逐元素 pair::swap) 与 my_stl::swap_ranges 每个等级
+//
+// 输出 CSV（标准输出）:
+//   op,types,method,ns_per_item
+//
+// 参数:
+//   --n=N                 元素个数 (默认 1e7)
+//   --repeat=N            每个测量点的重复次数，取最短 (默认 5)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../include/my_stl/swap.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+struct Options {
+    std::size_t n = 10000000;
+    int repeat = 5;
+};
+
+template <typename Fn>
+double best_of(int repeat, Fn&& fn) {
+    double best = 0;
+    for (int r = 0; r < repeat; ++r) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = r == 0 ? t : std::min(best, t);
+    }
+    return best;
+}
+
+template <typename T>
+void run_types(const Options& opt, const char* types) {
+    using P = my_stl::pair<T, T>;
+    std::vector<P> a(opt.n), b(opt.n);
+    for (std::size_t i = 0; i < opt.n; ++i) {
+        a[i] = P(static_cast<T>(i), static_cast<T>(bench::mix64(i)));
+        b[i] = P(static_cast<T>(bench::mix64(i + opt.n)), static_cast<T>(i));
+    }
+    auto report = [&](const char* op, const std::string& method, double ns) {
+        std::cout << op << ',' << types << ',' << method << ',' << ns / opt.n << std::endl;
+    };
+
+    // 每次测量都翻转一次，偶数次后恢复原状
+    report("swap_members", "std::swap", best_of(opt.repeat, [&] {
+        for (auto& p : a) std::swap(p.first, p.second);
+        bench::clobber_memory();
+    }));
+    using U = typename my_stl::detail::uint_of_size<sizeof(T)>::type;
+    const auto& members = my_stl::detail::swap_members_table<U>();
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        auto level = static_cast<my_stl::simd::isa>(l);
+        if (members.resolved_level(level) != level) continue;
+        auto fn = members.resolve(level);
+        report("swap_members", my_stl::simd::isa_name(level), best_of(opt.repeat, [&] {
+            fn(reinterpret_cast<U*>(a.data()), opt.n);
+            bench::clobber_memory();
+        }));
+    }
+
+    report("swap_ranges", "std::swap_ranges", best_of(opt.repeat, [&] {
+        std::swap_ranges(a.begin(), a.end(), b.begin());
+        bench::clobber_memory();
+    }));
+    const auto& bytes = my_stl::detail::swap_bytes_table();
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        auto level = static_cast<my_stl::simd::isa>(l);
+        if (bytes.resolved_level(level) != level) continue;
+        auto fn = bytes.resolve(level);
+        report("swap_ranges", my_stl::simd::isa_name(level), best_of(opt.repeat, [&] {
+            fn(reinterpret_cast<unsigned char*>(a.data()), reinterpret_cast<unsigned char*>(b.data()),
+               opt.n * sizeof(P));
+            bench::clobber_memory();
+        }));
+    }
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--n=")) opt.n = static_cast<std::size_t>(bench::parse_size(v));
+        else if (auto v = value("--repeat=")) opt.repeat = std::max(1, std::atoi(v));
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--n=N] [--repeat=N]" << std::endl;
+        return 2;
+    }
+
+    bench::print_build_warning(std::cout);
+    std::cout << "# " << my_stl::simd::describe_cpu() << std::endl;
+    std::cout << "op,types,method,ns_per_item" << std::endl;
+    run_types<std::uint32_t>(opt, "u32/u32");
+    run_types<std::uint64_t>(opt, "u64/u64");
+    return 0;
+}
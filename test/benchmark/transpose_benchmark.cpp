@@ -0,0 +1,141 @@
+// AoS ↔ SoA 转置基准测试
+//
+// 对 8/16/32/64 位成员的 pair<T, T> 数组，在每个可运行的指令集等级上测量
+// deinterleave (pair 数组 → 两个成员数组) 和 interleave (反向) 的吞吐，
+// 并与同样字节数的 memcpy 对比。转置读写的字节数与拷贝相同，因此 copy_pct
+// 接近 100 说明内核已达到内存带宽上限。
+//
+// 输出 CSV（标准输出）:
+//   op,width,isa,working_set,gbps,copy_pct
+// gbps 按读 + 写的总字节数计算；working_set 为 dram 或 cache。
+//
+// 参数:
+//   --bytes=N             大数据量下 pair 数组的大小 (默认 max(2 * L3, 128MB))
+//   --min-time-ms=T       每个测量点的最短累计时间 (默认 200)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../include/my_stl/transpose.hpp"
+#include "bench_util.hpp"
+
+namespace {
+
+using my_stl::simd::isa;
+
+struct Options {
+    std::uint64_t bytes = 0;
+    double min_time_ns = 200e6;
+};
+
+// 反复运行 fn 直到累计时间超过 min_time_ns，返回单次最短耗时 (ns)
+template <typename Fn>
+double best_time(double min_time_ns, Fn&& fn) {
+    double best = 0;
+    double total = 0;
+    int reps = 0;
+    while (total < min_time_ns || reps < 3) {
+        bench::Stopwatch sw;
+        fn();
+        double t = sw.elapsed_ns();
+        best = reps == 0 ? t : std::min(best, t);
+        total += t;
+        ++reps;
+    }
+    return best;
+}
+
+template <typename U>
+void run_width(const Options& opt, const char* width, const char* working_set, std::size_t bytes) {
+    const std::size_t n = std::max<std::size_t>(64, bytes / (2 * sizeof(U)));
+    std::vector<U> interleaved(2 * n), first(n), second(n);
+    for (std::size_t i = 0; i < interleaved.size(); ++i) interleaved[i] = static_cast<U>(bench::mix64(i));
+    const double moved = 2.0 * 2 * n * sizeof(U);
+
+    std::vector<U> copy(2 * n);
+    double copy_gbps = moved / best_time(opt.min_time_ns, [&] {
+        std::memcpy(copy.data(), interleaved.data(), 2 * n * sizeof(U));
+        bench::clobber_memory();
+    });
+
+    const auto& de = my_stl::detail::deinterleave_table<U>();
+    const auto& in = my_stl::detail::interleave_table<U>();
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        isa level = static_cast<isa>(l);
+        // 只测量真正登记了实现的等级
+        if (de.resolved_level(level) == level) {
+            auto fn = de.resolve(level);
+            double gbps = moved / best_time(opt.min_time_ns, [&] {
+                fn(interleaved.data(), n, first.data(), second.data());
+                bench::clobber_memory();
+            });
+            std::cout << "deinterleave," << width << ',' << my_stl::simd::isa_name(level) << ',' << working_set
+                      << ',' << gbps << ',' << 100.0 * gbps / copy_gbps << std::endl;
+        }
+        if (in.resolved_level(level) == level) {
+            auto fn = in.resolve(level);
+            double gbps = moved / best_time(opt.min_time_ns, [&] {
+                fn(first.data(), second.data(), n, interleaved.data());
+                bench::clobber_memory();
+            });
+            std::cout << "interleave," << width << ',' << my_stl::simd::isa_name(level) << ',' << working_set
+                      << ',' << gbps << ',' << 100.0 * gbps / copy_gbps << std::endl;
+        }
+    }
+    bench::do_not_optimize(first[n / 2]);
+}
+
+template <typename U>
+void run_width(const Options& opt, const char* width, std::size_t cache_bytes) {
+    run_width<U>(opt, width, "cache", cache_bytes);
+    run_width<U>(opt, width, "dram", static_cast<std::size_t>(opt.bytes));
+}
+
+bool parse_args(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::char_traits<char>::length(prefix);
+            return arg.compare(0, len, prefix) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--bytes=")) opt.bytes = bench::parse_size(v);
+        else if (auto v = value("--min-time-ms=")) opt.min_time_ns = std::atof(v) * 1e6;
+        else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, opt)) {
+        std::cerr << "usage: " << argv[0] << " [--bytes=N] [--min-time-ms=T]" << std::endl;
+        return 2;
+    }
+
+    auto caches = bench::cache_sizes();
+    if (opt.bytes == 0) {
+        opt.bytes = std::max<std::uint64_t>(2 * static_cast<std::uint64_t>(std::max(0L, caches.l3)), 128ull << 20);
+    }
+    // 缓存内测量：输入与两个输出共占 L2 的一半，L2 未知时按 256KB 计
+    const std::size_t cache_bytes = static_cast<std::size_t>(caches.l2 > 0 ? caches.l2 : 262144) / 4;
+
+    bench::print_build_warning(std::cout);
+    std::cout << "# " << my_stl::simd::describe_cpu() << std::endl;
+    std::cout << "# cache l2=" << caches.l2 << " l3=" << caches.l3 << " bytes=" << opt.bytes << std::endl;
+    std::cout << "op,width,isa,working_set,gbps,copy_pct" << std::endl;
+
+    run_width<std::uint8_t>(opt, "8", cache_bytes);
+    run_width<std::uint16_t>(opt, "16", cache_bytes);
+    run_width<std::uint32_t>(opt, "32", cache_bytes);
+    run_width<std::uint64_t>(opt, "64", cache_bytes);
+    return 0;
+}
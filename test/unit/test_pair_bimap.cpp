@@ -0,0 +1,161 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/bimap.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+// Check both directions of the bimap against a pair of unordered_maps
+template <typename Bimap, typename L, typename R>
+void check_consistent(const Bimap& map, const std::unordered_map<L, R>& forward,
+                      const std::unordered_map<R, L>& backward) {
+    assert(map.size() == forward.size() && forward.size() == backward.size());
+    for (const auto& kv : forward) {
+        assert(map.right_of(kv.first) && *map.right_of(kv.first) == kv.second);
+        assert(map.left_of(kv.second) && *map.left_of(kv.second) == kv.first);
+        (void)kv;
+    }
+    std::size_t visited = 0;
+    for (const auto& e : map) {
+        assert(forward.at(e.first) == e.second);
+        (void)e;
+        ++visited;
+    }
+    assert(visited == forward.size());
+    (void)visited;
+    (void)backward;
+}
+
+// Test random insert / insert_or_assign / erase against two unordered_maps
+void test_random() {
+    std::cout << "Testing bimap operations..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    my_stl::bimap<std::uint32_t, std::uint64_t> map;
+    std::unordered_map<std::uint32_t, std::uint64_t> forward;
+    std::unordered_map<std::uint64_t, std::uint32_t> backward;
+
+    for (int round = 0; round < 30000; ++round) {
+        auto l = static_cast<std::uint32_t>(rng() % 2000);
+        std::uint64_t r = rng() % 2000 + 1000000;
+        switch (rng() % 5) {
+        case 0: {
+            bool erased = map.erase_left(l);
+            auto it = forward.find(l);
+            assert(erased == (it != forward.end()));
+            (void)erased;
+            if (it != forward.end()) {
+                backward.erase(it->second);
+                forward.erase(it);
+            }
+            break;
+        }
+        case 1: {
+            bool erased = map.erase_right(r);
+            auto it = backward.find(r);
+            assert(erased == (it != backward.end()));
+            (void)erased;
+            if (it != backward.end()) {
+                forward.erase(it->second);
+                backward.erase(it);
+            }
+            break;
+        }
+        case 2: {
+            bool replaced = map.insert_or_assign(l, r);
+            bool expected = forward.count(l) != 0 || backward.count(r) != 0;
+            assert(replaced == expected);
+            (void)replaced;
+            (void)expected;
+            if (forward.count(l)) {
+                backward.erase(forward[l]);
+                forward.erase(l);
+            }
+            if (backward.count(r)) {
+                forward.erase(backward[r]);
+                backward.erase(r);
+            }
+            forward[l] = r;
+            backward[r] = l;
+            break;
+        }
+        default: {
+            bool inserted = map.insert(l, r);
+            bool expected = forward.count(l) == 0 && backward.count(r) == 0;
+            assert(inserted == expected);
+            (void)inserted;
+            if (expected) {
+                forward[l] = r;
+                backward[r] = l;
+            }
+            break;
+        }
+        }
+        if (round % 1000 == 0) check_consistent(map, forward, backward);
+    }
+    check_consistent(map, forward, backward);
+
+    map.clear();
+    assert(map.empty() && !map.contains_left(0) && map.right_of(1) == nullptr);
+
+    std::cout << "✓ bimap operations passed" << std::endl;
+}
+
+// Test id <-> name mapping with string keys, pair keys and growth from reserve
+void test_usage() {
+    std::cout << "Testing bimap usage..." << std::endl;
+
+    my_stl::bimap<int, std::string> names(4);
+    assert(names.insert(1, "alice") && names.insert(2, "bob") && names.insert(my_stl::pair<int, std::string>(3, "carol")));
+    assert(!names.insert(1, "dave") && !names.insert(4, "bob"));
+    assert(*names.left_of("bob") == 2 && *names.right_of(3) == "carol" && !names.left_of("dave"));
+
+    // Renaming through a pointer into the map itself
+    assert(names.insert_or_assign(*names.left_of("alice"), "alicia"));
+    assert(*names.right_of(1) == "alicia" && !names.contains_right("alice") && names.size() == 3);
+
+    for (int i = 10; i < 1000; ++i) names.insert(i, "user" + std::to_string(i));
+    assert(names.size() == 993 && *names.left_of("user500") == 500);
+    assert(names.erase_right("user10") && !names.contains_left(10));
+    assert(names.memory_usage() >= names.size() * sizeof(my_stl::pair<int, std::string>));
+
+    // Pair keys hash through std::hash<my_stl::pair>
+    my_stl::bimap<my_stl::pair<std::uint32_t, std::uint16_t>, std::uint32_t> flows;
+    flows.insert(my_stl::pair<std::uint32_t, std::uint16_t>(0x0A000001u, 443), 7);
+    assert(*flows.left_of(7) == (my_stl::pair<std::uint32_t, std::uint16_t>(0x0A000001u, 443)));
+
+    std::cout << "✓ bimap usage passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Bimap Tests ===" << std::endl;
+
+    try {
+        test_random();
+        test_usage();
+
+        std::cout << "\n✅ All bimap tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include <iostream>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/bloom_filter.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using isa = my_stl::simd::isa;
+using tenant_key = my_stl::pair<std::uint32_t, std::uint64_t>;
+using filter = my_stl::blocked_bloom_filter<std::uint32_t, std::uint64_t>;
+using filter_view = my_stl::blocked_bloom_view<std::uint32_t, std::uint64_t>;
+
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+std::vector<tenant_key> make_keys(std::size_t n, std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<tenant_key> keys(n);
+    for (auto& k : keys) k = tenant_key(static_cast<std::uint32_t>(rng() % 100), rng());
+    return keys;
+}
+
+// Test that every dispatch level sets the same bits and answers the same queries as the scalar kernels
+void test_kernels() {
+    std::cout << "Testing bloom kernels..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    std::vector<std::uint64_t> inserted(3000), probes(5000);
+    for (auto& h : inserted) h = rng();
+    for (auto& h : probes) h = rng();
+    for (std::size_t blocks : {1u, 7u, 500u}) {
+        std::vector<my_stl::detail::bloom_block> reference(blocks, my_stl::detail::bloom_block{});
+        my_stl::detail::bloom_insert_scalar(reference.data(), blocks, inserted.data(), inserted.size());
+        bool expected[5000];
+        my_stl::detail::bloom_contains_scalar(reference.data(), blocks, probes.data(), probes.size(), expected);
+        for (isa level : runnable_levels()) {
+            std::vector<my_stl::detail::bloom_block> got(blocks, my_stl::detail::bloom_block{});
+            my_stl::detail::bloom_insert_table().resolve(level)(got.data(), blocks, inserted.data(), inserted.size());
+            assert(std::memcmp(got.data(), reference.data(), blocks * sizeof(my_stl::detail::bloom_block)) == 0);
+            bool out[5000];
+            my_stl::detail::bloom_contains_table().resolve(level)(got.data(), blocks, probes.data(), probes.size(), out);
+            assert(std::memcmp(out, expected, sizeof(out)) == 0);
+            my_stl::detail::bloom_contains_table().resolve(level)(got.data(), blocks, inserted.data(), 3000, out);
+            for (std::size_t i = 0; i < 3000; ++i) assert(out[i]);
+        }
+    }
+
+    std::cout << "✓ bloom kernels passed" << std::endl;
+}
+
+// Test no false negatives, a false-positive rate near the estimate, and merge
+void test_filter() {
+    std::cout << "Testing blocked_bloom_filter..." << std::endl;
+
+    auto keys = make_keys(100000, 2);
+    auto misses = make_keys(100000, 3);
+    filter f(keys.size(), 10.0);
+    f.insert_batch(keys.data(), keys.size());
+    assert(f.inserted() == keys.size() && f.num_blocks() == 3907);
+
+    std::unique_ptr<bool[]> out(new bool[keys.size()]);
+    f.contains_batch(keys.data(), keys.size(), out.get());
+    for (std::size_t i = 0; i < keys.size(); ++i) assert(out[i] && f.contains(keys[i]));
+
+    f.contains_batch(misses.data(), misses.size(), out.get());
+    std::size_t false_positives = 0;
+    for (std::size_t i = 0; i < misses.size(); ++i) {
+        assert(out[i] == f.contains(misses[i]));
+        false_positives += out[i];
+    }
+    const double rate = static_cast<double>(false_positives) / static_cast<double>(misses.size());
+    assert(rate < 0.02 && rate > f.false_positive_rate() * 0.7 && rate < f.false_positive_rate() * 1.3);
+    (void)rate;
+
+    // Single inserts agree with the batch, and halves merge into the whole
+    filter left(keys.size(), 10.0), right(keys.size(), 10.0);
+    for (std::size_t i = 0; i < keys.size() / 2; ++i) left.insert(keys[i]);
+    right.insert_batch(keys.data() + keys.size() / 2, keys.size() - keys.size() / 2);
+    left.merge(right);
+    for (std::size_t i = 0; i < misses.size(); i += 7) assert(left.contains(misses[i]) == f.contains(misses[i]));
+    assert(left.inserted() == f.inserted());
+
+    left.clear();
+    assert(!left.contains(keys[0]) && left.inserted() == 0);
+
+    std::cout << "✓ blocked_bloom_filter passed" << std::endl;
+}
+
+// Test save / load round trips and that a view over the file bytes answers like the filter
+void test_file() {
+    std::cout << "Testing bloom file format..." << std::endl;
+
+    auto keys = make_keys(20000, 4);
+    auto misses = make_keys(20000, 5);
+    filter f(keys.size(), 12.0, 99);
+    f.insert_batch(keys.data(), keys.size());
+
+    std::stringstream stream;
+    const bool saved = f.save(stream);
+    assert(saved);
+    (void)saved;
+    const std::string bytes = stream.str();
+    assert(bytes.size() == f.file_size());
+
+    auto loaded = filter::load(stream);
+    assert(loaded && loaded->num_blocks() == f.num_blocks() && loaded->seed() == 99 && loaded->inserted() == 20000);
+    for (std::size_t i = 0; i < misses.size(); ++i) assert(loaded->contains(misses[i]) == f.contains(misses[i]));
+
+    // Stand-in for a page-aligned mmap of the file
+    std::vector<char, my_stl::detail::aligned_allocator<char, 64>> mapped(bytes.begin(), bytes.end());
+    auto view = filter_view::open(mapped.data(), mapped.size());
+    assert(view && view->num_blocks() == f.num_blocks());
+    for (const auto& k : keys) {
+        assert(view->contains(k));
+        (void)k;
+    }
+    std::unique_ptr<bool[]> out(new bool[misses.size()]);
+    view->contains_batch(misses.data(), misses.size(), out.get());
+    for (std::size_t i = 0; i < misses.size(); ++i) assert(out[i] == f.contains(misses[i]));
+
+    // Truncated, misaligned and corrupted files are rejected
+    assert(!filter_view::open(mapped.data(), mapped.size() - 1));
+    assert(!filter_view::open(mapped.data() + 1, mapped.size() - 1));
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 32));
+    assert(!filter::load(truncated));
+    mapped[0] = 'X';
+    assert(!filter_view::open(mapped.data(), mapped.size()));
+
+    // A header claiming 2^32 blocks in front of a short stream fails without allocating the claimed 128 GiB
+    std::string forged = bytes;
+    const std::uint64_t huge = std::uint64_t(1) << 32;
+    std::memcpy(&forged[offsetof(my_stl::detail::bloom_file_header, blocks)], &huge, sizeof(huge));
+    std::stringstream forged_stream(forged);
+    assert(!filter::load(forged_stream));
+
+    // Filters spanning several load chunks round-trip exactly
+    filter big(3000000, 10.0, 7);
+    assert(big.num_blocks() > 3 * my_stl::detail::bloom_load_chunk);
+    big.insert_batch(keys.data(), keys.size());
+    std::stringstream big_stream;
+    const bool big_saved = big.save(big_stream);
+    assert(big_saved);
+    (void)big_saved;
+    auto big_loaded = filter::load(big_stream);
+    assert(big_loaded && big_loaded->num_blocks() == big.num_blocks());
+    assert(big_loaded->memory_usage() == big.memory_usage());
+    assert(std::memcmp(big_loaded->view().blocks(), big.view().blocks(),
+                       big.num_blocks() * sizeof(my_stl::detail::bloom_block)) == 0);
+    (void)big_loaded;
+
+    std::cout << "✓ bloom file format passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Bloom Filter Tests ===" << std::endl;
+
+    try {
+        test_kernels();
+        test_filter();
+        test_file();
+
+        std::cout << "\n✅ All bloom filter tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
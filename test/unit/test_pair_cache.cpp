@@ -0,0 +1,236 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/cache.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+// Live value count, to check that evicted and erased entries are destroyed exactly once
+struct tracked {
+    static int live;
+    int value = 0;
+
+    explicit tracked(int v = 0) : value(v) { ++live; }
+    tracked(const tracked& other) : value(other.value) { ++live; }
+    tracked& operator=(const tracked& other) = default;
+    ~tracked() { --live; }
+};
+
+int tracked::live = 0;
+
+// Reference LRU: std::list + std::unordered_map
+class reference_lru {
+public:
+    explicit reference_lru(std::size_t capacity) : capacity_(capacity) {}
+
+    const int* get(std::uint64_t key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) return nullptr;
+        order_.splice(order_.begin(), order_, it->second);
+        return &it->second->second;
+    }
+
+    void put(std::uint64_t key, int value) {
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->second = value;
+            order_.splice(order_.begin(), order_, it->second);
+            return;
+        }
+        if (order_.size() == capacity_) {
+            index_.erase(order_.back().first);
+            order_.pop_back();
+        }
+        order_.emplace_front(key, value);
+        index_[key] = order_.begin();
+    }
+
+    bool erase(std::uint64_t key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) return false;
+        order_.erase(it->second);
+        index_.erase(it);
+        return true;
+    }
+
+    const std::list<std::pair<std::uint64_t, int>>& order() const { return order_; }
+
+private:
+    std::size_t capacity_;
+    std::list<std::pair<std::uint64_t, int>> order_;
+    std::unordered_map<std::uint64_t, std::list<std::pair<std::uint64_t, int>>::iterator> index_;
+};
+
+// Test lru_cache against the reference under random get/put/erase, including recency order
+void test_lru() {
+    std::cout << "Testing lru_cache..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    for (std::size_t capacity : {1u, 2u, 7u, 64u}) {
+        my_stl::lru_cache<std::uint64_t, tracked> cache(capacity);
+        reference_lru expected(capacity);
+        for (int round = 0; round < 20000; ++round) {
+            std::uint64_t key = rng() % (capacity * 3 + 2);
+            switch (rng() % 4) {
+            case 0: {
+                auto* got = cache.get(key);
+                auto* want = expected.get(key);
+                assert((got == nullptr) == (want == nullptr));
+                assert(!got || got->value == *want);
+                (void)got;
+                (void)want;
+                break;
+            }
+            case 1: {
+                bool erased = cache.erase(key);
+                assert(erased == expected.erase(key));
+                (void)erased;
+                break;
+            }
+            default: {
+                int value = static_cast<int>(rng() % 1000);
+                cache.put(key, tracked(value));
+                expected.put(key, value);
+                break;
+            }
+            }
+            assert(cache.size() == expected.order().size());
+            assert(tracked::live == static_cast<int>(cache.size()));
+        }
+        auto it = expected.order().begin();
+        cache.for_each([&](const my_stl::pair<const std::uint64_t, tracked>& e) {
+            assert(e.first == it->first && e.second.value == it->second);
+            (void)e;
+            ++it;
+        });
+        assert(it == expected.order().end());
+        assert(cache.evictions() > 0);
+        cache.clear();
+        assert(cache.empty() && tracked::live == 0 && !cache.contains(0));
+    }
+    assert(tracked::live == 0);
+
+    std::cout << "✓ lru_cache passed" << std::endl;
+}
+
+// Test second-chance eviction and pair keys in clock_cache
+void test_clock() {
+    std::cout << "Testing clock_cache..." << std::endl;
+
+    using key = my_stl::pair<std::uint32_t, std::uint16_t>;
+    my_stl::clock_cache<key, std::string> cache(4);
+    for (std::uint32_t i = 0; i < 4; ++i) assert(cache.put(key(i, 80), "v" + std::to_string(i)));
+    assert(!cache.put(key(0, 80), "zero"));
+    assert(*cache.peek(key(0, 80)) == "zero");
+
+    // Entries 0 and 2 were referenced, so 1 goes first and then 3
+    assert(cache.get(key(2, 80)) != nullptr);
+    cache.put(key(10, 80), "ten");
+    assert(!cache.contains(key(1, 80)) && cache.contains(key(0, 80)) && cache.contains(key(2, 80)));
+    cache.put(key(11, 80), "eleven");
+    assert(!cache.contains(key(3, 80)) && cache.size() == 4 && cache.evictions() == 2);
+
+    assert(cache.erase(key(10, 80)) && !cache.erase(key(10, 80)));
+    cache.put(key(12, 443), "twelve");
+    assert(cache.evictions() == 2 && cache.size() == 4);
+    std::size_t visited = 0;
+    cache.for_each([&](const auto&) { ++visited; });
+    assert(visited == 4);
+    (void)visited;
+
+    // Random workload: size bound, lookups agree with what was last put
+    std::mt19937_64 rng(2);
+    my_stl::clock_cache<std::uint64_t, tracked> random(50);
+    std::unordered_map<std::uint64_t, int> last;
+    for (int round = 0; round < 20000; ++round) {
+        std::uint64_t k = rng() % 200;
+        if (rng() % 2) {
+            int v = static_cast<int>(rng() % 1000);
+            random.put(k, tracked(v));
+            last[k] = v;
+        } else if (auto* got = random.get(k)) {
+            assert(got->value == last[k]);
+            (void)got;
+        }
+        assert(random.size() <= 50 && tracked::live == static_cast<int>(random.size()));
+    }
+
+    std::cout << "✓ clock_cache passed" << std::endl;
+}
+
+// Test the sharded caches from several threads; each key always maps to the same value
+template <typename Cache>
+void hammer(Cache& cache) {
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&, t] {
+            std::mt19937_64 rng(static_cast<std::uint64_t>(t));
+            for (int i = 0; i < 20000; ++i) {
+                std::uint64_t k = rng() % 1000;
+                if (rng() % 3 == 0) {
+                    cache.put(k, k * 7);
+                } else if (auto v = cache.get(k)) {
+                    assert(*v == k * 7);
+                }
+                if (i % 997 == 0) cache.erase(k);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    assert(cache.size() <= cache.capacity());
+}
+
+void test_sharded() {
+    std::cout << "Testing sharded caches..." << std::endl;
+
+    my_stl::concurrent_lru_cache<std::uint64_t, std::uint64_t> lru(256, 8);
+    assert(lru.shard_count() == 8 && lru.capacity() == 256);
+    hammer(lru);
+
+    my_stl::concurrent_clock_cache<std::uint64_t, std::uint64_t> clock(100, 6);
+    assert(clock.shard_count() == 8 && clock.capacity() == 8 * 13);
+    hammer(clock);
+
+    clock.put(5, 35);
+    assert(clock.contains(5) && *clock.get(5) == 35 && !clock.get(5000));
+    clock.clear();
+    assert(clock.size() == 0);
+
+    std::cout << "✓ sharded caches passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Cache Tests ===" << std::endl;
+
+    try {
+        test_lru();
+        test_clock();
+        test_sharded();
+
+        std::cout << "\n✅ All cache tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
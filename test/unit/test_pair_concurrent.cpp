@@ -0,0 +1,204 @@
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/concurrent.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using U32Pair = my_stl::pair<std::uint32_t, std::uint32_t>;
+using U64Pair = my_stl::pair<std::uint64_t, std::uint64_t>;
+
+void test_atomic_pair() {
+    std::cout << "Testing atomic_pair..." << std::endl;
+
+    my_stl::atomic_pair<std::uint32_t, std::uint32_t> cell(U32Pair(1, 2));
+    assert(cell.load() == U32Pair(1, 2));
+
+    cell.store(U32Pair(3, 4));
+    assert(cell.exchange(U32Pair(5, 6)) == U32Pair(3, 4));
+
+    U32Pair expected(0, 0);
+    assert(!cell.compare_exchange_strong(expected, U32Pair(7, 8)));
+    assert(expected == U32Pair(5, 6));
+    assert(cell.compare_exchange_strong(expected, U32Pair(7, 8)));
+    assert(cell.load() == U32Pair(7, 8));
+
+    // Concurrent increments of both members stay consistent
+    my_stl::atomic_pair<std::uint32_t, std::uint32_t> counter(U32Pair(0, 0));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 10000; ++i) {
+                U32Pair cur = counter.load();
+                while (!counter.compare_exchange_weak(cur, U32Pair(cur.first + 1, cur.second + 2))) {}
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    assert(counter.load() == U32Pair(40000, 80000));
+
+    std::cout << "✓ atomic_pair passed" << std::endl;
+}
+
+void test_seqlock_pair() {
+    std::cout << "Testing seqlock_pair..." << std::endl;
+
+    my_stl::seqlock_pair<std::uint64_t, std::uint64_t> cell(U64Pair(1, ~1ULL));
+    assert(cell.load() == U64Pair(1, ~1ULL));
+
+    // Readers must never observe a torn pair (second == ~first always holds)
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> torn{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&] {
+            while (!stop.load()) {
+                auto v = cell.load();
+                if (v.second != ~v.first) torn.fetch_add(1);
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 2; ++t) {
+        writers.emplace_back([&, t] {
+            for (std::uint64_t i = 0; i < 20000; ++i) {
+                std::uint64_t v = i * 2 + static_cast<std::uint64_t>(t);
+                cell.store(U64Pair(v, ~v));
+            }
+        });
+    }
+    for (auto& th : writers) th.join();
+    stop.store(true);
+    for (auto& th : readers) th.join();
+
+    assert(torn.load() == 0);
+    assert(cell.sequence() % 2 == 0);
+
+    auto next = cell.update([](U64Pair v) { return U64Pair(v.first + 1, ~(v.first + 1)); });
+    assert(cell.load() == next);
+    (void)next;
+
+    std::cout << "✓ seqlock_pair passed" << std::endl;
+}
+
+void test_sharded_map() {
+    std::cout << "Testing sharded_map..." << std::endl;
+
+    my_stl::sharded_map<U32Pair, std::string> map(8);
+    assert(map.shard_count() == 8);
+    assert(map.insert(U32Pair(1, 2), "a"));
+    assert(!map.insert(U32Pair(1, 2), "b"));
+    assert(*map.find(U32Pair(1, 2)) == "a");
+    assert(!map.insert_or_assign(U32Pair(1, 2), "c"));
+    assert(*map.find(U32Pair(1, 2)) == "c");
+    assert(!map.find(U32Pair(2, 1)).has_value());
+    assert(map.erase(U32Pair(1, 2)));
+    assert(map.size() == 0);
+
+    my_stl::sharded_map<U32Pair, std::uint64_t> counts;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (std::uint32_t i = 0; i < 1000; ++i) {
+                counts.update(U32Pair(i % 100, i % 7), [](std::uint64_t& c) { ++c; });
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    std::uint64_t total = 0;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        auto key = U32Pair(i % 100, i % 7);
+        if (auto v = counts.find(key)) {
+            total += *v;
+            counts.erase(key);
+        }
+    }
+    assert(total == 4000);
+
+    std::cout << "✓ sharded_map passed" << std::endl;
+}
+
+void test_mpmc_queue() {
+    std::cout << "Testing mpmc_queue..." << std::endl;
+
+    my_stl::mpmc_queue<my_stl::pair<int, std::string>> small(3);
+    assert(small.capacity() == 4);
+    for (int i = 0; i < 4; ++i) assert(small.try_emplace(i, std::to_string(i)));
+    assert(!small.try_emplace(9, "full"));
+    my_stl::pair<int, std::string> out;
+    assert(small.try_pop(out) && out.first == 0 && out.second == "0");
+
+    my_stl::mpmc_queue<U64Pair> queue(1024);
+    constexpr std::uint64_t per_producer = 20000;
+    std::atomic<std::uint64_t> consumed_sum{0};
+    std::atomic<std::uint64_t> consumed_count{0};
+
+    std::vector<std::thread> threads;
+    for (std::uint64_t p = 0; p < 2; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::uint64_t i = 0; i < per_producer; ++i) {
+                std::uint64_t v = p * per_producer + i;
+                while (!queue.try_emplace(v, v * 3)) std::this_thread::yield();
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&] {
+            U64Pair item;
+            while (consumed_count.load() < 2 * per_producer) {
+                if (queue.try_pop(item)) {
+                    assert(item.second == item.first * 3);
+                    consumed_sum.fetch_add(item.first);
+                    consumed_count.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    std::uint64_t n = 2 * per_producer;
+    assert(consumed_count.load() == n);
+    assert(consumed_sum.load() == n * (n - 1) / 2);
+    (void)n;
+
+    std::cout << "✓ mpmc_queue passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl Concurrent Pair Structure Tests ===" << std::endl;
+
+    try {
+        test_atomic_pair();
+        test_seqlock_pair();
+        test_sharded_map();
+        test_mpmc_queue();
+
+        std::cout << "\n✅ All concurrent tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/csr_graph.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using edge = my_stl::pair<std::uint32_t, std::uint32_t>;
+using weighted_edge = my_stl::pair<edge, int>;
+
+// Adjacency built through std::map, rows as sorted multisets of (target, weight)
+std::map<std::uint32_t, std::multiset<std::pair<std::uint32_t, int>>> reference_adjacency(
+    const std::vector<weighted_edge>& edges, const my_stl::csr_options& opt) {
+    std::map<std::uint32_t, std::multiset<std::pair<std::uint32_t, int>>> adj;
+    for (const auto& e : edges) {
+        std::uint32_t u = e.first.first, v = e.first.second;
+        if (u == v && opt.remove_self_loops) continue;
+        adj[u].emplace(v, e.second);
+        if (opt.symmetrize && u != v) adj[v].emplace(u, e.second);
+    }
+    if (opt.dedup) {
+        // Keep the smallest weight of each (u, v)
+        for (auto& row : adj) {
+            std::multiset<std::pair<std::uint32_t, int>> unique;
+            for (const auto& arc : row.second) {
+                if (unique.empty() || std::prev(unique.end())->first != arc.first) unique.insert(arc);
+            }
+            row.second = unique;
+        }
+    }
+    return adj;
+}
+
+// Compare a weighted CSR with the reference for every vertex
+void check_graph(const my_stl::csr_graph<int>& g, const std::vector<weighted_edge>& edges,
+                 const my_stl::csr_options& opt, std::size_t n) {
+    auto adj = reference_adjacency(edges, opt);
+    assert(g.num_vertices() == n);
+    std::size_t total = 0;
+    for (std::uint32_t v = 0; v < n; ++v) {
+        auto row = g.neighbors(v);
+        auto weights = g.edge_weights(v);
+        assert(static_cast<std::size_t>(row.second - row.first) == g.degree(v));
+        std::multiset<std::pair<std::uint32_t, int>> got;
+        for (std::size_t i = 0; i < g.degree(v); ++i) got.emplace(row.first[i], weights.first[i]);
+        auto it = adj.find(v);
+        assert(got == (it == adj.end() ? std::multiset<std::pair<std::uint32_t, int>>() : it->second));
+        (void)it;
+        if (opt.sort_neighbors || opt.dedup) assert(std::is_sorted(row.first, row.second));
+        total += g.degree(v);
+    }
+    assert(total == g.num_edges() && g.offsets().back() == g.num_edges());
+    (void)total;
+}
+
+// Test every option combination against std::map adjacency on small random graphs
+void test_options() {
+    std::cout << "Testing csr options..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    for (std::size_t m : {0u, 1u, 7u, 500u, 20000u}) {
+        std::vector<weighted_edge> edges;
+        for (std::size_t i = 0; i < m; ++i) {
+            auto u = static_cast<std::uint32_t>(rng() % 300);
+            auto v = static_cast<std::uint32_t>(rng() % 8 == 0 ? u : rng() % 300);
+            edges.emplace_back(edge(u, v), static_cast<int>(rng() % 100));
+        }
+        for (int mask = 0; mask < 16; ++mask) {
+            my_stl::csr_options opt;
+            opt.symmetrize = mask & 1;
+            opt.remove_self_loops = mask & 2;
+            opt.sort_neighbors = mask & 4;
+            opt.dedup = mask & 8;
+            opt.threads = 1;
+            auto g = my_stl::build_csr(edges, opt);
+            std::uint32_t highest = 0;
+            for (const auto& e : edges) highest = std::max({highest, e.first.first, e.first.second});
+            check_graph(g, edges, opt, m == 0 ? 0 : highest + 1);
+            assert(g.sorted() == (opt.sort_neighbors || opt.dedup));
+        }
+    }
+
+    std::cout << "✓ csr options passed" << std::endl;
+}
+
+// Test that several threads give the same graph as one, row contents compared as sets
+void test_parallel() {
+    std::cout << "Testing parallel csr build..." << std::endl;
+
+    std::mt19937_64 rng(2);
+    const std::size_t m = my_stl::detail::csr_parallel_grain * 5 + 123;
+    std::vector<edge> edges(m);
+    for (auto& e : edges) {
+        // Skewed sources so a few rows are long
+        auto u = static_cast<std::uint32_t>(rng() % 4 == 0 ? rng() % 16 : rng() % 50000);
+        e = edge(u, static_cast<std::uint32_t>(rng() % 50000));
+    }
+    for (bool dedup : {false, true}) {
+        my_stl::csr_options opt;
+        opt.symmetrize = true;
+        opt.sort_neighbors = true;
+        opt.dedup = dedup;
+        opt.threads = 1;
+        auto serial = my_stl::build_csr(edges, opt);
+        for (unsigned threads : {2u, 3u, 8u}) {
+            opt.threads = threads;
+            auto parallel = my_stl::build_csr(edges, opt);
+            assert(parallel.offsets() == serial.offsets());
+            assert(parallel.targets() == serial.targets());
+        }
+    }
+
+    // Unsorted rows: same multiset per row
+    my_stl::csr_options opt;
+    opt.threads = 1;
+    auto serial = my_stl::build_csr(edges, opt);
+    opt.threads = 4;
+    auto parallel = my_stl::build_csr(edges, opt);
+    assert(parallel.offsets() == serial.offsets());
+    for (std::uint32_t v = 0; v < serial.num_vertices(); ++v) {
+        auto a = serial.neighbors(v);
+        auto b = parallel.neighbors(v);
+        std::vector<std::uint32_t> x(a.first, a.second), y(b.first, b.second);
+        std::sort(x.begin(), x.end());
+        std::sort(y.begin(), y.end());
+        assert(x == y);
+    }
+
+    // Single thread keeps input order inside a row
+    std::vector<edge> ordered = {{0, 5}, {1, 2}, {0, 3}, {0, 9}};
+    opt.threads = 1;
+    auto g = my_stl::build_csr(ordered, opt);
+    auto row = g.neighbors(0);
+    assert((std::vector<std::uint32_t>(row.first, row.second) == std::vector<std::uint32_t>{5, 3, 9}));
+    (void)row;
+
+    std::cout << "✓ parallel csr build passed" << std::endl;
+}
+
+// Test queries, explicit vertex counts and isolated vertices
+void test_queries() {
+    std::cout << "Testing csr queries..." << std::endl;
+
+    std::vector<edge> edges = {{0, 1}, {1, 2}, {2, 0}, {2, 2}, {0, 1}};
+    my_stl::csr_options opt;
+    opt.num_vertices = 6;
+    opt.dedup = true;
+    auto g = my_stl::build_csr(edges.data(), edges.size(), opt);
+    assert(g.num_vertices() == 6 && g.num_edges() == 4);
+    assert(g.has_edge(0, 1) && g.has_edge(2, 2) && !g.has_edge(1, 0) && !g.has_edge(9, 0));
+    assert(g.degree(5) == 0 && g.degree(0) == 1);
+    assert(g.memory_usage() >= 7 * sizeof(std::uint64_t) + 4 * sizeof(std::uint32_t));
+
+    opt = my_stl::csr_options();
+    opt.symmetrize = true;
+    auto undirected = my_stl::build_csr(edges, opt);
+    assert(undirected.has_edge(1, 0) && undirected.has_edge(0, 2) && undirected.degree(2) == 3);
+
+    // Weighted dedup keeps the smallest weight
+    std::vector<my_stl::pair<edge, double>> weighted = {{{3, 1}, 2.5}, {{3, 1}, 0.5}, {{1, 3}, 4.0}};
+    opt = my_stl::csr_options();
+    opt.dedup = true;
+    auto wg = my_stl::build_csr(weighted, opt);
+    assert(wg.degree(3) == 1 && *wg.edge_weights(3).first == 0.5 && wg.weights().size() == 2);
+
+    auto none = my_stl::build_csr(std::vector<edge>());
+    assert(none.empty() && none.num_edges() == 0);
+
+    std::cout << "✓ csr queries passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair CSR Graph Tests ===" << std::endl;
+
+    try {
+        test_options();
+        test_parallel();
+        test_queries();
+
+        std::cout << "\n✅ All CSR graph tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/batch.hpp"
+#include "../../include/my_stl/hash.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using my_stl::batch::pair_u32;
+using my_stl::batch::pair_u64;
+using my_stl::simd::isa;
+
+// Every level the machine can run, from scalar up to the detected one
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+// Sizes around every vector width, so that the scalar tails are exercised
+const std::size_t sizes[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 64, 1000, 1027};
+
+// Test feature detection and dispatch table resolution
+void test_detection() {
+    std::cout << "Testing CPU feature detection..." << std::endl;
+
+    const auto& f = my_stl::simd::cpu();
+    isa level = my_stl::simd::detected_isa();
+    if (level >= isa::sse42) assert(f.sse42 && f.popcnt);
+    if (level >= isa::avx2) assert(f.avx2 && f.bmi2 && f.os_ymm);
+    if (level >= isa::avx512) assert(f.avx512f && f.avx512bw && f.avx512vl && f.avx512dq && f.os_zmm);
+    assert(static_cast<int>(my_stl::simd::active_isa()) <= static_cast<int>(level));
+    (void)f;
+
+    std::cout << "  " << my_stl::simd::describe_cpu() << std::endl;
+    std::cout << "  " << my_stl::batch::describe_kernels() << std::endl;
+
+    // Resolution falls back to the highest registered level not above the request
+    using fn = int (*)();
+    fn s = [] { return 0; };
+    fn a = [] { return 2; };
+    my_stl::simd::dispatch_table<fn> table{s, nullptr, a, nullptr};
+    assert(table.resolve(isa::scalar)() == 0);
+    assert(table.resolve(isa::sse42)() == 0);
+    assert(table.resolve(isa::avx2)() == 2);
+    assert(table.resolve(isa::avx512)() == 2);
+    assert(table.resolved_level(isa::avx512) == isa::avx2);
+    assert(table.resolved_level(isa::sse42) == isa::scalar);
+
+    isa parsed;
+    assert(my_stl::simd::detail::parse_isa("avx2", parsed) && parsed == isa::avx2);
+    assert(my_stl::simd::detail::parse_isa("sse4.2", parsed) && parsed == isa::sse42);
+    assert(!my_stl::simd::detail::parse_isa("neon", parsed));
+    assert(!my_stl::simd::detail::parse_isa(nullptr, parsed));
+    (void)table;
+    (void)parsed;
+
+    std::cout << "✓ CPU feature detection passed" << std::endl;
+}
+
+// Test that every implementation of the hash kernels matches the scalar one
+void test_hash_kernels() {
+    std::cout << "Testing batch hash kernels..." << std::endl;
+
+    std::mt19937_64 rng(11);
+    std::vector<pair_u32> small(1100);
+    std::vector<pair_u64> wide(1100);
+    for (std::size_t i = 0; i < small.size(); ++i) {
+        small[i] = pair_u32(static_cast<std::uint32_t>(rng()), static_cast<std::uint32_t>(rng()));
+        wide[i] = pair_u64(rng(), rng());
+    }
+
+    for (isa level : runnable_levels()) {
+        auto hash_u32 = my_stl::batch::detail::hash_u32_table().resolve(level);
+        auto hash_u64 = my_stl::batch::detail::hash_u64_table().resolve(level);
+        for (std::size_t n : sizes) {
+            // Offset by one element so the vector loads are unaligned
+            std::vector<std::uint64_t> out(n + 1, 0), expected(n + 1, 0);
+            hash_u32(small.data() + 1, n, out.data() + 1);
+            for (std::size_t i = 0; i < n; ++i) {
+                expected[i + 1] = my_stl::detail::hash_combine64(small[i + 1].first, small[i + 1].second);
+            }
+            assert(out == expected);
+
+            hash_u64(wide.data() + 1, n, out.data() + 1);
+            for (std::size_t i = 0; i < n; ++i) {
+                expected[i + 1] = my_stl::detail::hash_combine64(wide[i + 1].first, wide[i + 1].second);
+            }
+            assert(out == expected);
+            assert(out[0] == 0);
+        }
+    }
+
+    // The public entry point agrees with pair_hash where std::hash is the identity on integers
+    std::vector<std::uint64_t> out(small.size());
+    my_stl::batch::hash(small.data(), small.size(), out.data());
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+    my_stl::pair_hash hasher;
+    for (std::size_t i = 0; i < small.size(); ++i) assert(out[i] == hasher(small[i]));
+    (void)hasher;
+#endif
+
+    std::cout << "✓ Batch hash kernels passed" << std::endl;
+}
+
+// Test that every implementation of the comparison kernels matches the scalar one
+void test_compare_kernels() {
+    std::cout << "Testing batch comparison kernels..." << std::endl;
+
+    // Few distinct firsts so that ties on first (decided by second) are common,
+    // plus values with the top bit set to catch signed comparisons
+    std::mt19937 rng(5);
+    std::vector<pair_u32> data(1100);
+    for (auto& p : data) {
+        std::uint32_t f = rng() % 4;
+        if (rng() % 3 == 0) f |= 0x80000000u;
+        std::uint32_t s = rng() % 8;
+        if (rng() % 3 == 0) s |= 0x80000000u;
+        p = pair_u32(f, s);
+    }
+    const pair_u32 keys[] = {pair_u32(0, 0), pair_u32(1, 3), pair_u32(2, 0x80000003u),
+                             pair_u32(0x80000001u, 4), pair_u32(0xffffffffu, 0xffffffffu)};
+
+    for (isa level : runnable_levels()) {
+        auto count_less = my_stl::batch::detail::count_less_u32_table().resolve(level);
+        auto count_equal = my_stl::batch::detail::count_equal_u32_table().resolve(level);
+        for (std::size_t n : sizes) {
+            for (const auto& key : keys) {
+                std::size_t less = 0, equal = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const auto& p = data[i + 1];
+                    less += (p.first < key.first) || (p.first == key.first && p.second < key.second);
+                    equal += p.first == key.first && p.second == key.second;
+                }
+                assert(count_less(data.data() + 1, n, key) == less);
+                assert(count_equal(data.data() + 1, n, key) == equal);
+            }
+        }
+        (void)count_less;
+        (void)count_equal;
+    }
+
+    assert(my_stl::batch::count_equal(data.data(), data.size(), data[10]) >= 1);
+    assert(my_stl::batch::count_less(data.data(), data.size(), pair_u32(0, 0)) == 0);
+
+    std::cout << "✓ Batch comparison kernels passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair CPU Dispatch Tests ===" << std::endl;
+
+    try {
+        test_detection();
+        test_hash_kernels();
+        test_compare_kernels();
+
+        std::cout << "\n✅ All dispatch tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
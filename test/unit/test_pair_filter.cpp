@@ -0,0 +1,166 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/filter.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using my_stl::member_range;
+using my_stl::simd::isa;
+
+// Every level the machine can run, from scalar up to the detected one
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+template <typename A, typename B>
+std::vector<my_stl::pair<A, B>> reference_filter(const std::vector<my_stl::pair<A, B>>& in, std::size_t n,
+                                                 member_range<A> fa, member_range<B> fb) {
+    std::vector<my_stl::pair<A, B>> out;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (fa.lo <= in[i].first && in[i].first <= fa.hi && fb.lo <= in[i].second && in[i].second <= fb.hi) {
+            out.push_back(in[i]);
+        }
+    }
+    return out;
+}
+
+// Bitwise comparison, so that NaN members compare equal to themselves
+template <typename A, typename B>
+bool same_prefix(const std::vector<my_stl::pair<A, B>>& got, const std::vector<my_stl::pair<A, B>>& expected) {
+    return expected.empty() || std::memcmp(got.data(), expected.data(), expected.size() * sizeof(my_stl::pair<A, B>)) == 0;
+}
+
+// Test every dispatch level against the reference for a mix of range, equality and open predicates
+template <typename A, typename B>
+void check_types(const char* name, A (*make_a)(std::mt19937_64&), B (*make_b)(std::mt19937_64&),
+                 const std::vector<member_range<A>>& first_preds, const std::vector<member_range<B>>& second_preds) {
+    std::cout << "Testing filter_pairs on " << name << "..." << std::endl;
+
+    std::mt19937_64 rng(sizeof(A) * 13 + std::is_floating_point_v<B>);
+    std::vector<my_stl::pair<A, B>> data(1000);
+    for (auto& p : data) p = my_stl::pair<A, B>(make_a(rng), make_b(rng));
+
+    for (isa level : runnable_levels()) {
+        auto filter = my_stl::detail::filter_table<A, B>().resolve(level);
+        for (std::size_t n : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 17u, 1000u}) {
+            for (const auto& fa : first_preds) {
+                for (const auto& fb : second_preds) {
+                    auto expected = reference_filter(data, n, fa, fb);
+                    std::vector<my_stl::pair<A, B>> out(n);
+                    std::size_t count = filter(data.data(), n, fa, fb, out.data());
+                    assert(count == expected.size());
+                    assert(same_prefix(out, expected));
+                    (void)count;
+                }
+            }
+        }
+    }
+
+    std::cout << "✓ filter_pairs on " << name << " passed" << std::endl;
+}
+
+void test_kernels() {
+    // (timestamp, value) with 1%, 10% and 50% selectivity on the timestamp
+    check_types<std::uint64_t, double>(
+        "(uint64_t, double)", [](std::mt19937_64& r) { return static_cast<std::uint64_t>(r() % 1000 + (r() % 50 == 0 ? 0xf000000000000000ull : 0)); },
+        [](std::mt19937_64& r) { return r() % 20 == 0 ? std::nan("") : static_cast<double>(r() % 200) - 100.0; },
+        {member_range<std::uint64_t>::between(0, 9), member_range<std::uint64_t>::between(100, 199),
+         member_range<std::uint64_t>::between(0, 499), member_range<std::uint64_t>::equal_to(7),
+         member_range<std::uint64_t>::between(0xf000000000000000ull, ~0ull), member_range<std::uint64_t>::any()},
+        {member_range<double>::any(), member_range<double>::between(-10.0, 10.0), member_range<double>::equal_to(0.0)});
+
+    check_types<std::uint32_t, std::uint32_t>(
+        "(uint32_t, uint32_t)", [](std::mt19937_64& r) { return static_cast<std::uint32_t>(r() % 100 + (r() % 3 == 0 ? 0x80000000u : 0)); },
+        [](std::mt19937_64& r) { return static_cast<std::uint32_t>(r()); },
+        {member_range<std::uint32_t>::between(10, 20), member_range<std::uint32_t>::between(0x80000000u, 0x8000000fu),
+         member_range<std::uint32_t>::any(), member_range<std::uint32_t>::between(5, 4)},
+        {member_range<std::uint32_t>::any(), member_range<std::uint32_t>::between(0, 0x7fffffffu)});
+
+    check_types<std::int32_t, float>(
+        "(int32_t, float)", [](std::mt19937_64& r) { return static_cast<std::int32_t>(r() % 200) - 100; },
+        [](std::mt19937_64& r) { return static_cast<float>(r() % 1000) / 10.0f - 50.0f; },
+        {member_range<std::int32_t>::between(-5, 5), member_range<std::int32_t>::equal_to(-100),
+         member_range<std::int32_t>::any()},
+        {member_range<float>::between(-1.0f, 1.0f), member_range<float>::any()});
+
+    check_types<std::int64_t, std::int64_t>(
+        "(int64_t, int64_t)", [](std::mt19937_64& r) { return static_cast<std::int64_t>(r()); },
+        [](std::mt19937_64& r) { return static_cast<std::int64_t>(r() % 7) - 3; },
+        {member_range<std::int64_t>::between(std::numeric_limits<std::int64_t>::min(), -1),
+         member_range<std::int64_t>::any()},
+        {member_range<std::int64_t>::equal_to(0), member_range<std::int64_t>::between(-3, -1)});
+}
+
+// Test the public entry point, including types that take the scalar paths
+void test_public_api() {
+    std::cout << "Testing filter_pairs public API..." << std::endl;
+
+    std::vector<my_stl::pair<std::uint64_t, double>> samples;
+    for (std::uint64_t ts = 0; ts < 10000; ++ts) samples.emplace_back(ts, static_cast<double>(ts % 100));
+    std::vector<my_stl::pair<std::uint64_t, double>> out(samples.size());
+    std::size_t count = my_stl::filter_pairs(samples.data(), samples.size(),
+                                             member_range<std::uint64_t>::between(1000, 1999),
+                                             member_range<double>::between(90.0, 99.0), out.data());
+    assert(count == 100);
+    for (std::size_t i = 0; i < count; ++i) assert(out[i].first >= 1000 && out[i].first < 2000 && out[i].second >= 90.0);
+
+    // Mixed member sizes (scalar branchless path)
+    static_assert(my_stl::detail::is_bitwise_copyable_v<my_stl::pair<std::uint16_t, std::uint64_t>>);
+    std::vector<my_stl::pair<std::uint16_t, std::uint64_t>> mixed = {{1, 10}, {2, 20}, {3, 30}, {2, 40}, {5, 50}};
+    std::vector<my_stl::pair<std::uint16_t, std::uint64_t>> mixed_out(mixed.size());
+    count = my_stl::filter_pairs(mixed.data(), mixed.size(), member_range<std::uint16_t>::equal_to(2),
+                                 member_range<std::uint64_t>::any(), mixed_out.data());
+    assert(count == 2 && mixed_out[0].second == 20 && mixed_out[1].second == 40);
+    // The branchless path stores every element, so the rejected last one lands just past the matches
+    assert(mixed_out[count].first == 5 && mixed_out[count].second == 50);
+
+    // Non-trivially-copyable members (branchy path, leaves the tail alone)
+    std::vector<my_stl::pair<int, std::string>> names = {{1, "a"}, {5, "b"}, {9, "c"}};
+    std::vector<my_stl::pair<int, std::string>> names_out(names.size(), my_stl::pair<int, std::string>(0, "x"));
+    count = my_stl::filter_pairs(names.data(), names.size(), member_range<int>::between(2, 9),
+                                 member_range<std::string>::between("a", "bz"), names_out.data());
+    assert(count == 1 && names_out[0].second == "b" && names_out[1].second == "x");
+    (void)count;
+
+    std::cout << "✓ filter_pairs public API passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Filter Tests ===" << std::endl;
+
+    try {
+        test_kernels();
+        test_public_api();
+
+        std::cout << "\n✅ All filter tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,330 @@
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/hash.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+// Hash quality suite for pair hashers.
+//
+// Every hasher in the list is evaluated on several key sets against both
+// power-of-two and prime bucket counts:
+//   - chi-squared of the bucket distribution (h % buckets), normalized by its
+//     degrees of freedom (~1.0 for a uniform hash)
+//   - mean / max probe length of a linear-probing table at load factor 0.5
+//   - full 64-bit collisions
+//   - worst avalanche bias over all (input bit, output bit) combinations
+// Gated hashers must pass the thresholds below. The legacy combiner
+// h1 ^ (h2 << 1) is kept as a reference and must be rejected, which checks
+// that the suite actually detects the regressions it is meant to stop.
+
+using IntPair = my_stl::pair<std::uint32_t, std::uint32_t>;
+using StringPair = my_stl::pair<std::string, std::string>;
+
+constexpr double max_chi2_ratio = 1.15;
+constexpr double max_mean_probe = 2.0;
+constexpr std::size_t max_probe_limit = 64;
+constexpr double max_avalanche_bias = 0.1;
+
+struct LegacyPairHash {
+    template <typename T1, typename T2>
+    std::uint64_t operator()(const my_stl::pair<T1, T2>& p) const {
+        auto h1 = std::hash<T1>{}(p.first);
+        auto h2 = std::hash<T2>{}(p.second);
+        return h1 ^ (h2 << 1);
+    }
+};
+
+struct StdPairHash {
+    template <typename T1, typename T2>
+    std::uint64_t operator()(const my_stl::pair<T1, T2>& p) const {
+        return std::hash<my_stl::pair<T1, T2>>{}(p);
+    }
+};
+
+struct Metrics {
+    double chi2_ratio = 0.0;
+    double mean_probe = 0.0;
+    std::size_t max_probe = 0;
+    std::size_t collisions = 0;
+
+    bool passes() const {
+        return chi2_ratio <= max_chi2_ratio && mean_probe <= max_mean_probe &&
+               max_probe <= max_probe_limit && collisions == 0;
+    }
+};
+
+// ============================================================================
+// Key sets
+// ============================================================================
+
+std::vector<IntPair> sequential_keys(std::uint32_t n) {
+    std::vector<IntPair> keys;
+    for (std::uint32_t i = 0; i < n; ++i) keys.emplace_back(i, i + 1);
+    return keys;
+}
+
+std::vector<IntPair> grid_keys(std::uint32_t side) {
+    std::vector<IntPair> keys;
+    for (std::uint32_t x = 0; x < side; ++x) {
+        for (std::uint32_t y = 0; y < side; ++y) keys.emplace_back(x, y);
+    }
+    return keys;
+}
+
+// (a, a), (a, b) and (b, a) for all a < b < side
+std::vector<IntPair> symmetric_keys(std::uint32_t side) {
+    std::vector<IntPair> keys;
+    for (std::uint32_t a = 0; a < side; ++a) {
+        keys.emplace_back(a, a);
+        for (std::uint32_t b = a + 1; b < side; ++b) {
+            keys.emplace_back(a, b);
+            keys.emplace_back(b, a);
+        }
+    }
+    return keys;
+}
+
+std::vector<StringPair> string_keys(std::uint32_t n) {
+    std::vector<StringPair> keys;
+    for (std::uint32_t i = 0; i < n; ++i) {
+        keys.emplace_back("user:" + std::to_string(i), "item:" + std::to_string(i % 997));
+    }
+    return keys;
+}
+
+// ============================================================================
+// Metrics
+// ============================================================================
+
+std::size_t next_prime(std::size_t n) {
+    auto is_prime = [](std::size_t v) {
+        if (v < 2) return false;
+        for (std::size_t d = 2; d * d <= v; ++d) {
+            if (v % d == 0) return false;
+        }
+        return true;
+    };
+    while (!is_prime(n)) ++n;
+    return n;
+}
+
+std::size_t next_power_of_two(std::size_t n) {
+    std::size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+double chi2_ratio(const std::vector<std::uint64_t>& hashes, std::size_t buckets) {
+    std::vector<std::size_t> counts(buckets, 0);
+    for (auto h : hashes) ++counts[h % buckets];
+    double expected = static_cast<double>(hashes.size()) / static_cast<double>(buckets);
+    double chi2 = 0.0;
+    for (auto c : counts) {
+        double d = static_cast<double>(c) - expected;
+        chi2 += d * d / expected;
+    }
+    return chi2 / static_cast<double>(buckets - 1);
+}
+
+// Linear probing placement. Occupied slots are linked to their successor in a
+// union-find structure so that even badly clustered hashes (the legacy
+// combiner on grid keys) are measured in near-linear time.
+void probe_lengths(const std::vector<std::uint64_t>& hashes, std::size_t capacity,
+                   double& mean, std::size_t& max) {
+    std::vector<std::size_t> next_free(capacity);
+    for (std::size_t i = 0; i < capacity; ++i) next_free[i] = i;
+
+    auto find = [&](std::size_t slot) {
+        while (next_free[slot] != slot) {
+            next_free[slot] = next_free[next_free[slot]];
+            slot = next_free[slot];
+        }
+        return slot;
+    };
+
+    std::size_t total = 0;
+    max = 0;
+    for (auto h : hashes) {
+        std::size_t home = h % capacity;
+        std::size_t slot = find(home);
+        std::size_t probes = (slot >= home ? slot - home : slot + capacity - home) + 1;
+        next_free[slot] = find(slot + 1 == capacity ? 0 : slot + 1);
+        total += probes;
+        if (probes > max) max = probes;
+    }
+    mean = static_cast<double>(total) / static_cast<double>(hashes.size());
+}
+
+template <typename Key, typename Hasher>
+Metrics evaluate(const std::vector<Key>& keys, Hasher hasher, bool prime_buckets) {
+    std::vector<std::uint64_t> hashes;
+    hashes.reserve(keys.size());
+    for (const auto& k : keys) hashes.push_back(hasher(k));
+
+    Metrics m;
+    std::size_t buckets = prime_buckets ? next_prime(keys.size()) : next_power_of_two(keys.size());
+    m.chi2_ratio = chi2_ratio(hashes, buckets);
+
+    std::size_t capacity = prime_buckets ? next_prime(2 * keys.size()) : next_power_of_two(2 * keys.size());
+    probe_lengths(hashes, capacity, m.mean_probe, m.max_probe);
+
+    std::unordered_set<std::uint64_t> distinct(hashes.begin(), hashes.end());
+    m.collisions = hashes.size() - distinct.size();
+    return m;
+}
+
+// Worst |P(output bit flips) - 0.5| when a single input bit flips
+template <typename Hasher>
+double avalanche_bias(Hasher hasher, int samples) {
+    constexpr int input_bits = 64;
+    constexpr int output_bits = static_cast<int>(sizeof(std::size_t) * 8);
+    std::vector<int> flips(input_bits * output_bits, 0);
+    std::mt19937_64 rng(7);
+
+    for (int s = 0; s < samples; ++s) {
+        std::uint64_t x = rng();
+        IntPair base(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(x >> 32));
+        std::uint64_t h0 = hasher(base);
+        for (int bit = 0; bit < input_bits; ++bit) {
+            std::uint64_t y = x ^ (1ULL << bit);
+            IntPair flipped(static_cast<std::uint32_t>(y), static_cast<std::uint32_t>(y >> 32));
+            std::uint64_t diff = h0 ^ hasher(flipped);
+            for (int out = 0; out < output_bits; ++out) {
+                flips[bit * output_bits + out] += static_cast<int>((diff >> out) & 1);
+            }
+        }
+    }
+
+    double worst = 0.0;
+    for (int f : flips) {
+        double bias = std::fabs(static_cast<double>(f) / samples - 0.5);
+        if (bias > worst) worst = bias;
+    }
+    return worst;
+}
+
+// ============================================================================
+// Suite
+// ============================================================================
+
+void print_row(const std::string& hasher, const std::string& keyset, bool prime, const Metrics& m) {
+    std::cout << std::left << std::setw(22) << hasher << std::setw(12) << keyset
+              << std::setw(8) << (prime ? "prime" : "pow2") << std::right << std::fixed
+              << std::setprecision(3) << std::setw(10) << m.chi2_ratio
+              << std::setw(10) << m.mean_probe << std::setw(8) << m.max_probe
+              << std::setw(10) << m.collisions << (m.passes() ? "   ok" : "   FAIL") << std::endl;
+}
+
+template <typename Hasher>
+bool run_hasher(const std::string& name, Hasher hasher) {
+    const auto sequential = sequential_keys(1 << 16);
+    const auto grid = grid_keys(256);
+    const auto symmetric = symmetric_keys(256);
+    const auto strings = string_keys(1 << 16);
+
+    bool all_pass = true;
+    for (bool prime : {false, true}) {
+        Metrics m;
+        m = evaluate(sequential, hasher, prime);
+        print_row(name, "sequential", prime, m);
+        all_pass = all_pass && m.passes();
+        m = evaluate(grid, hasher, prime);
+        print_row(name, "grid", prime, m);
+        all_pass = all_pass && m.passes();
+        m = evaluate(symmetric, hasher, prime);
+        print_row(name, "symmetric", prime, m);
+        all_pass = all_pass && m.passes();
+        m = evaluate(strings, hasher, prime);
+        print_row(name, "strings", prime, m);
+        all_pass = all_pass && m.passes();
+    }
+
+    double bias = avalanche_bias(hasher, 2000);
+    std::cout << std::left << std::setw(22) << name << "avalanche worst bias: "
+              << std::fixed << std::setprecision(3) << bias
+              << (bias <= max_avalanche_bias ? "   ok" : "   FAIL") << std::endl;
+    return all_pass && bias <= max_avalanche_bias;
+}
+
+void test_symmetric_pairs_differ() {
+    std::cout << "Testing symmetric pair hashes..." << std::endl;
+
+    std::hash<IntPair> hasher;
+    for (std::uint32_t a = 0; a < 64; ++a) {
+        assert(hasher(IntPair(a, a)) != 0 || a == 0);
+        for (std::uint32_t b = a + 1; b < 64; ++b) {
+            assert(hasher(IntPair(a, b)) != hasher(IntPair(b, a)));
+        }
+    }
+
+    // pair_hash and std::hash agree, for both my_stl::pair and std::pair
+    my_stl::pair_hash ph;
+    assert(static_cast<std::size_t>(ph(IntPair(3, 4))) == hasher(IntPair(3, 4)));
+    assert(ph(IntPair(3, 4)) == ph(std::pair<std::uint32_t, std::uint32_t>(3, 4)));
+    (void)hasher;
+    (void)ph;
+
+    std::cout << "✓ Symmetric pair hashes passed" << std::endl;
+}
+
+// Returns false when the verdict is wrong, so that the result does not depend on NDEBUG
+bool test_hash_quality() {
+    std::cout << "Testing hash quality..." << std::endl;
+    std::cout << std::left << std::setw(22) << "hasher" << std::setw(12) << "keys"
+              << std::setw(8) << "buckets" << std::right << std::setw(10) << "chi2/df"
+              << std::setw(10) << "mean" << std::setw(8) << "max" << std::setw(10) << "collide" << std::endl;
+
+    bool legacy_ok = run_hasher("legacy h1^(h2<<1)", LegacyPairHash{});
+    bool std_ok = run_hasher("std::hash<pair>", StdPairHash{});
+    bool pair_hash_ok = run_hasher("my_stl::pair_hash", my_stl::pair_hash{});
+
+    // The suite must reject the legacy combiner and accept the shipped hashers
+    if (legacy_ok) {
+        std::cout << "❌ legacy combiner was not rejected" << std::endl;
+        return false;
+    }
+    if (!std_ok || !pair_hash_ok) {
+        std::cout << "❌ shipped hasher failed the quality checks" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Hash quality passed" << std::endl;
+    return true;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Hash Quality Tests ===" << std::endl;
+
+    try {
+        test_symmetric_pairs_differ();
+        if (!test_hash_quality()) return 1;
+
+        std::cout << "\n✅ All hash quality tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/histogram.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using Histogram = my_stl::latency_histogram;
+
+bool within_relative(std::uint64_t actual, std::uint64_t expected, double tolerance) {
+    double diff = std::fabs(static_cast<double>(actual) - static_cast<double>(expected));
+    return diff <= tolerance * static_cast<double>(expected) + 1.0;
+}
+
+// Test bucket boundaries
+void test_bucket_layout() {
+    std::cout << "Testing bucket layout..." << std::endl;
+
+    // Linear region maps one value per bucket
+    for (std::uint64_t v = 0; v < Histogram::sub_bucket_count * 2; ++v) {
+        assert(Histogram::bucket_index(v) == v);
+        assert(Histogram::bucket_lowest(v) == v);
+        assert(Histogram::bucket_highest(v) == v);
+    }
+
+    // Every value lies inside its bucket and the bucket width bounds the error
+    std::mt19937_64 rng(1);
+    const double max_error = 1.0 / static_cast<double>(Histogram::sub_bucket_count);
+    for (int i = 0; i < 100000; ++i) {
+        std::uint64_t v = rng() >> (rng() % 64);
+        std::size_t index = Histogram::bucket_index(v);
+        assert(index < Histogram::bucket_count);
+        std::uint64_t low = Histogram::bucket_lowest(index);
+        std::uint64_t high = Histogram::bucket_highest(index);
+        assert(low <= v && v <= high);
+        assert(static_cast<double>(high - low) <= max_error * static_cast<double>(low) + 1.0);
+        (void)max_error;
+        (void)low;
+        (void)high;
+    }
+
+    // Adjacent buckets tile the value range without gaps
+    for (std::size_t i = 0; i + 1 < Histogram::bucket_count; ++i) {
+        assert(Histogram::bucket_highest(i) + 1 == Histogram::bucket_lowest(i + 1));
+    }
+    assert(Histogram::bucket_highest(Histogram::bucket_count - 1) == std::numeric_limits<std::uint64_t>::max());
+    assert(Histogram::bucket_index(std::numeric_limits<std::uint64_t>::max()) == Histogram::bucket_count - 1);
+
+    std::cout << "✓ Bucket layout passed" << std::endl;
+}
+
+// Test summary statistics and percentiles
+void test_percentiles() {
+    std::cout << "Testing percentiles..." << std::endl;
+
+    Histogram h;
+    assert(h.count() == 0);
+    assert(h.value_at_percentile(50) == 0);
+    assert(h.min() == 0 && h.max() == 0);
+
+    for (std::uint64_t v = 1; v <= 100000; ++v) h.record(v);
+    assert(h.count() == 100000);
+    assert(h.min() == 1);
+    assert(h.max() == 100000);
+    assert(std::fabs(h.mean() - 50000.5) < 1e-6);
+
+    assert(within_relative(h.value_at_percentile(50), 50000, 0.01));
+    assert(within_relative(h.value_at_percentile(99), 99000, 0.01));
+    assert(within_relative(h.value_at_percentile(99.9), 99900, 0.01));
+    assert(h.value_at_percentile(100) == 100000);
+    assert(h.value_at_percentile(0) == 1);
+
+    // A single outlier shows up at the tail but not in the median
+    Histogram tail;
+    for (int i = 0; i < 999; ++i) tail.record(100);
+    tail.record(1000000);
+    assert(tail.value_at_percentile(50) == 100);
+    assert(tail.value_at_percentile(99.9) == 100);
+    assert(within_relative(tail.value_at_percentile(99.95), 1000000, 0.01));
+    assert(tail.max() == 1000000);
+
+    // Weighted record
+    Histogram weighted;
+    weighted.record(10, 90);
+    weighted.record(5000, 10);
+    assert(weighted.count() == 100);
+    assert(weighted.value_at_percentile(90) == 10);
+    assert(within_relative(weighted.value_at_percentile(91), 5000, 0.01));
+
+    h.reset();
+    assert(h.count() == 0 && h.sum() == 0 && h.max() == 0);
+
+    std::cout << "✓ Percentiles passed" << std::endl;
+}
+
+// Test merging per-thread instances
+void test_merge() {
+    std::cout << "Testing merge..." << std::endl;
+
+    Histogram a, b, all;
+    std::mt19937_64 rng(2);
+    for (int i = 0; i < 50000; ++i) {
+        std::uint64_t v = rng() % 1000000;
+        (i % 2 ? a : b).record(v);
+        all.record(v);
+    }
+
+    Histogram merged;
+    merged.merge(a);
+    merged.merge(b);
+    assert(merged.count() == all.count());
+    assert(merged.sum() == all.sum());
+    assert(merged.min() == all.min());
+    assert(merged.max() == all.max());
+    for (std::size_t i = 0; i < Histogram::bucket_count; ++i) {
+        assert(merged.count_at(i) == all.count_at(i));
+    }
+    for (double p : {50.0, 90.0, 99.0, 99.9}) {
+        assert(merged.value_at_percentile(p) == all.value_at_percentile(p));
+        (void)p;
+    }
+
+    // Merge across precisions keeps the count and stays within the coarser error
+    my_stl::basic_histogram<4> coarse;
+    coarse.merge(all);
+    assert(coarse.count() == all.count());
+    assert(within_relative(coarse.value_at_percentile(50), all.value_at_percentile(50), 1.0 / 16));
+
+    // Moving keeps the samples
+    Histogram moved(std::move(merged));
+    assert(moved.count() == all.count());
+    assert(moved.value_at_percentile(99) == all.value_at_percentile(99));
+
+    std::cout << "✓ Merge passed" << std::endl;
+}
+
+// Test concurrent recording into one shared histogram
+void test_concurrent_record() {
+    std::cout << "Testing concurrent record..." << std::endl;
+
+    Histogram shared;
+    const int threads = 4;
+    const int per_thread = 100000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&shared, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                shared.record(static_cast<std::uint64_t>(t * per_thread + i + 1));
+            }
+        });
+    }
+    // Queries may run while writers are active
+    (void)shared.value_at_percentile(99);
+    for (auto& w : workers) w.join();
+
+    const std::uint64_t n = static_cast<std::uint64_t>(threads) * per_thread;
+    assert(shared.count() == n);
+    assert(shared.sum() == n * (n + 1) / 2);
+    assert(shared.min() == 1);
+    assert(shared.max() == n);
+    std::uint64_t bucket_total = 0;
+    shared.for_each_bucket([&](std::uint64_t, std::uint64_t, std::uint64_t c) { bucket_total += c; });
+    assert(bucket_total == n);
+    (void)n;
+
+    // scoped_latency records one sample per scope
+    Histogram timed;
+    {
+        my_stl::scoped_latency<> scope(timed);
+    }
+    assert(timed.count() == 1);
+
+    std::cout << "✓ Concurrent record passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl Latency Histogram Tests ===" << std::endl;
+
+    try {
+        test_bucket_layout();
+        test_percentiles();
+        test_merge();
+        test_concurrent_record();
+
+        std::cout << "\n✅ All histogram tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/hyperloglog.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using isa = my_stl::simd::isa;
+using user_item = my_stl::pair<std::uint32_t, std::uint32_t>;
+using estimator = my_stl::hyperloglog<std::uint32_t, std::uint32_t>;
+
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+// n distinct (user, item) pairs starting at offset, each repeated `repeat` times
+std::vector<user_item> make_pairs(std::size_t n, std::size_t offset, std::size_t repeat = 1) {
+    std::vector<user_item> out;
+    for (std::size_t r = 0; r < repeat; ++r) {
+        for (std::size_t i = offset; i < offset + n; ++i) {
+            out.push_back(user_item(static_cast<std::uint32_t>(i / 97), static_cast<std::uint32_t>(i % 97 + 1000)));
+        }
+    }
+    return out;
+}
+
+double relative_error(double estimate, std::size_t exact) {
+    return exact == 0 ? estimate : std::fabs(estimate - static_cast<double>(exact)) / static_cast<double>(exact);
+}
+
+// Test that sparse entries decode to the same register and rank as the dense update, and the merge kernels
+void test_kernels() {
+    std::cout << "Testing hyperloglog kernels..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 100000; ++i) {
+        std::uint64_t h = rng();
+        // Exercise the all-zero tails too
+        if (i % 4 == 1) h &= ~std::uint64_t(0) << 40;
+        if (i % 4 == 2) h &= ~std::uint64_t(0) << 60;
+        for (unsigned p = my_stl::detail::hll_min_precision; p <= my_stl::detail::hll_max_precision; ++p) {
+            std::uint32_t index;
+            std::uint8_t rank;
+            my_stl::detail::hll_sparse_to_dense(my_stl::detail::hll_sparse_encode(h), p, index, rank);
+            assert(index == h >> (64 - p));
+            assert(rank == std::min(my_stl::detail::hll_leading_zeros(h << p), 64 - p) + 1);
+            (void)index;
+            (void)rank;
+        }
+    }
+
+    for (std::size_t n : {0u, 1u, 15u, 16u, 33u, 64u, 100u, 16384u}) {
+        std::vector<std::uint8_t> a(n), b(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<std::uint8_t>(rng() % 50);
+            b[i] = static_cast<std::uint8_t>(rng() % 50);
+        }
+        auto expected = a;
+        my_stl::detail::hll_merge_scalar(expected.data(), b.data(), n);
+        for (isa level : runnable_levels()) {
+            auto got = a;
+            my_stl::detail::hll_merge_table().resolve(level)(got.data(), b.data(), n);
+            assert(got == expected);
+        }
+    }
+
+    std::cout << "✓ hyperloglog kernels passed" << std::endl;
+}
+
+// Test estimates across the sparse and dense ranges, with duplicates
+void test_estimate() {
+    std::cout << "Testing hyperloglog estimate..." << std::endl;
+
+    estimator empty;
+    assert(empty.estimate() == 0 && empty.is_sparse());
+
+    for (std::size_t n : {1u, 10u, 1000u, 2000u, 5000u, 20000u, 300000u}) {
+        estimator hll(14);
+        auto keys = make_pairs(n, 0, 3);
+        hll.add_batch(keys);
+        const double error = relative_error(hll.estimate(), n);
+        if (n <= 2000) {
+            // Still sparse: linear counting over 2^25 buckets is nearly exact
+            assert(hll.is_sparse() && error < 0.01);
+            assert(hll.memory_usage() <= 16384 + 16384 / 4);
+        } else {
+            assert(!hll.is_sparse() && error < 4 * hll.standard_error());
+            assert(hll.memory_usage() == 16384);
+        }
+        (void)error;
+    }
+
+    // Single adds agree with the batch path
+    estimator single(10), batch(10);
+    auto keys = make_pairs(50000, 7);
+    for (const auto& k : keys) single.add(k);
+    batch.add_batch(keys.data(), keys.size());
+    assert(single.estimate() == batch.estimate());
+    assert(relative_error(batch.estimate(), keys.size()) < 4 * batch.standard_error());
+
+    batch.clear();
+    assert(batch.is_sparse() && batch.estimate() == 0 && batch.memory_usage() == 0);
+
+    std::cout << "✓ hyperloglog estimate passed" << std::endl;
+}
+
+// Test merging every combination of sparse and dense estimators against one estimator over the union
+void test_merge() {
+    std::cout << "Testing hyperloglog merge..." << std::endl;
+
+    for (std::size_t left_n : {100u, 50000u}) {
+        for (std::size_t right_n : {200u, 80000u}) {
+            auto left_keys = make_pairs(left_n, 0);
+            auto right_keys = make_pairs(right_n, left_n / 2);
+            estimator left, right, whole;
+            left.add_batch(left_keys);
+            right.add_batch(right_keys);
+            whole.add_batch(left_keys);
+            whole.add_batch(right_keys);
+            left.merge(right);
+            left.merge(left);
+            const std::size_t exact = std::max(left_n, left_n / 2 + right_n);
+            assert(relative_error(left.estimate(), exact) < 4 * left.standard_error());
+            if (!whole.is_sparse()) assert(!left.is_sparse() && left.estimate() == whole.estimate());
+            else assert(relative_error(left.estimate(), exact) < 0.01);
+            (void)exact;
+        }
+    }
+
+    // Hundreds of windows merged into a total
+    std::vector<estimator> windows(200, estimator(12));
+    for (std::size_t w = 0; w < windows.size(); ++w) {
+        windows[w].add_batch(make_pairs(500, w * 250));
+    }
+    estimator all(12);
+    for (const auto& w : windows) all.merge(w);
+    assert(relative_error(all.estimate(), 199 * 250 + 500) < 4 * all.standard_error());
+
+    std::cout << "✓ hyperloglog merge passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair HyperLogLog Tests ===" << std::endl;
+
+    try {
+        test_kernels();
+        test_estimate();
+        test_merge();
+
+        std::cout << "\n✅ All hyperloglog tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
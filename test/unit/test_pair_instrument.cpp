@@ -0,0 +1,161 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <utility>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#ifndef MYSTL_INSTRUMENT
+#define MYSTL_INSTRUMENT
+#endif
+#include "../../include/my_stl/pair.hpp"
+#include "../../include/my_stl/instrument.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using StringPair = my_stl::pair<std::string, std::string>;
+using IntPair = my_stl::pair<int, int>;
+using my_stl::instrument::op;
+
+void test_copy_and_move_construction() {
+    std::cout << "Testing copy/move construction counters..." << std::endl;
+    my_stl::instrument::reset();
+
+    StringPair p1("a", "b");
+    StringPair p2(p1);
+    StringPair p3(std::move(p2));
+    (void)p3;
+
+    auto e = my_stl::instrument::snapshot_of<StringPair>();
+    assert(e[op::copy_construct] == 1);
+    assert(e[op::move_construct] == 1);
+    assert(e[op::copy_assign] == 0);
+    assert(e[op::move_assign] == 0);
+
+    std::cout << "✓ Copy/move construction counters passed" << std::endl;
+}
+
+void test_assignment() {
+    std::cout << "Testing assignment counters..." << std::endl;
+    my_stl::instrument::reset();
+
+    IntPair a(1, 2);
+    IntPair b;
+    b = a;
+    b = a;
+    b = std::move(a);
+
+    auto e = my_stl::instrument::snapshot_of<IntPair>();
+    assert(e[op::copy_assign] == 2);
+    assert(e[op::move_assign] == 1);
+    assert(e[op::copy_construct] == 0);
+
+    std::cout << "✓ Assignment counters passed" << std::endl;
+}
+
+void test_conversions() {
+    std::cout << "Testing conversion counters..." << std::endl;
+    my_stl::instrument::reset();
+
+    StringPair p("key", "value");
+
+    // Hidden copy through the std::pair conversion operator
+    std::pair<std::string, std::string> s1 = p;
+    std::pair<std::string, std::string> s2 = std::move(p);
+    (void)s1;
+
+    StringPair from_std(s2);
+    StringPair from_std_moved(std::move(s2));
+    (void)from_std;
+    (void)from_std_moved;
+
+    my_stl::pair<long, long> widened(IntPair(1, 2));
+    (void)widened;
+
+    auto e = my_stl::instrument::snapshot_of<StringPair>();
+    assert(e[op::convert_copy] == 2);
+    assert(e[op::convert_move] == 2);
+    assert(e[op::copy_construct] == 0);
+
+    auto w = my_stl::instrument::snapshot_of<my_stl::pair<long, long>>();
+    assert(w[op::convert_move] == 1);
+
+    std::cout << "✓ Conversion counters passed" << std::endl;
+}
+
+void test_vector_growth() {
+    std::cout << "Testing counters under vector reallocation..." << std::endl;
+    my_stl::instrument::reset();
+
+    std::vector<StringPair> vec;
+    for (int i = 0; i < 16; ++i) {
+        vec.emplace_back(std::to_string(i), "x");
+    }
+
+    // noexcept move constructor: reallocation must move, never copy
+    auto e = my_stl::instrument::snapshot_of<StringPair>();
+    assert(e[op::copy_construct] == 0);
+    assert(e[op::move_construct] > 0);
+
+    std::cout << "✓ Vector reallocation counters passed" << std::endl;
+}
+
+#if MYSTL_INSTRUMENT_CONSTEXPR_HOOKS
+// Hooks are skipped during constant evaluation, so instrumented pairs still work in constant expressions
+constexpr IntPair constexpr_copies() {
+    IntPair a(1, 2);
+    IntPair b(a);
+    IntPair c(std::move(b));
+    my_stl::pair<long, long> widened(c);
+    return IntPair(static_cast<int>(widened.first), c.second);
+}
+static_assert(constexpr_copies().first == 1 && constexpr_copies().second == 2);
+#endif
+
+void test_report() {
+    std::cout << "Testing report output..." << std::endl;
+    my_stl::instrument::reset();
+
+    IntPair a(1, 2);
+    IntPair b(a);
+    (void)b;
+
+    auto entries = my_stl::instrument::snapshot();
+    assert(!entries.empty());
+    assert(entries.front().total() == 1);
+    assert(entries.front().type_name.find("pair") != std::string::npos);
+
+    my_stl::instrument::report(std::cout);
+
+    std::cout << "✓ Report output passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Instrumentation Tests ===" << std::endl;
+
+    try {
+        test_copy_and_move_construction();
+        test_assignment();
+        test_conversions();
+        test_vector_growth();
+        test_report();
+
+        std::cout << "\n✅ All instrumentation tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/interval_map.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+template <typename T>
+using entry = my_stl::pair<my_stl::pair<T, T>, int>;
+
+// Sorted ids of the brute-force overlap/stab results
+template <typename T>
+std::vector<int> reference_overlap(const std::vector<entry<T>>& all, T lo, T hi) {
+    std::vector<int> ids;
+    for (const auto& e : all) {
+        if (e.first.first < hi && lo < e.first.second) ids.push_back(e.second);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+template <typename T>
+std::vector<int> reference_stab(const std::vector<entry<T>>& all, T p) {
+    std::vector<int> ids;
+    for (const auto& e : all) {
+        if (!(p < e.first.first) && p < e.first.second) ids.push_back(e.second);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+// Run every query type on a map and compare with the brute-force answers
+template <typename Map, typename T>
+void check_queries(const Map& map, const std::vector<entry<T>>& all, T lo, T hi) {
+    std::vector<int> got;
+    map.for_each_overlap(lo, hi, [&](const my_stl::pair<T, T>& r, const int& id) {
+        assert(r.first < hi && lo < r.second);
+        (void)r;
+        got.push_back(id);
+    });
+    std::sort(got.begin(), got.end());
+    auto expected = reference_overlap(all, lo, hi);
+    assert(got == expected);
+    assert(map.count_overlap(lo, hi) == expected.size());
+    assert(map.overlaps(lo, hi) == !expected.empty());
+
+    got.clear();
+    map.for_each_stab(lo, [&](const my_stl::pair<T, T>&, const int& id) { got.push_back(id); });
+    std::sort(got.begin(), got.end());
+    expected = reference_stab(all, lo);
+    assert(got == expected);
+    assert(map.contains(lo) == !expected.empty());
+}
+
+// Test the dynamic map under random inserts and erases against a linear list
+void test_dynamic() {
+    std::cout << "Testing interval_map..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    my_stl::interval_map<std::uint32_t, int> map;
+    std::vector<entry<std::uint32_t>> all;
+    int next_id = 0;
+
+    for (int round = 0; round < 3000; ++round) {
+        if (all.empty() || rng() % 4 != 0) {
+            auto begin = static_cast<std::uint32_t>(rng() % 10000);
+            auto end = begin + 1 + static_cast<std::uint32_t>(rng() % (rng() % 8 == 0 ? 3000 : 50));
+            map.insert(my_stl::pair<std::uint32_t, std::uint32_t>(begin, end), next_id);
+            all.emplace_back(my_stl::pair<std::uint32_t, std::uint32_t>(begin, end), next_id++);
+        } else {
+            std::size_t victim = rng() % all.size();
+            auto range = all[victim].first;
+            bool erased = map.erase(range);
+            assert(erased);
+            (void)erased;
+            // Which of several identical ranges was erased is unspecified; drop the one that is gone
+            std::vector<int> remaining;
+            map.for_each([&](const my_stl::pair<std::uint32_t, std::uint32_t>& r, const int& id) {
+                if (r == range) remaining.push_back(id);
+            });
+            for (std::size_t i = 0; i < all.size(); ++i) {
+                if (all[i].first == range &&
+                    std::find(remaining.begin(), remaining.end(), all[i].second) == remaining.end()) {
+                    all.erase(all.begin() + static_cast<std::ptrdiff_t>(i));
+                    break;
+                }
+            }
+        }
+        assert(map.size() == all.size());
+        if (round % 50 == 0) {
+            for (int q = 0; q < 20; ++q) {
+                auto lo = static_cast<std::uint32_t>(rng() % 13000);
+                check_queries(map, all, lo, lo + 1 + static_cast<std::uint32_t>(rng() % 200));
+            }
+        }
+    }
+    assert(!map.erase(my_stl::pair<std::uint32_t, std::uint32_t>(50000, 50001)));
+
+    // In-order traversal is sorted by (begin, end)
+    std::vector<my_stl::pair<std::uint32_t, std::uint32_t>> order;
+    map.for_each([&](const my_stl::pair<std::uint32_t, std::uint32_t>& r, const int&) { order.push_back(r); });
+    assert(order.size() == all.size() && std::is_sorted(order.begin(), order.end()));
+
+    map.clear();
+    assert(map.empty() && !map.contains(5));
+
+    std::cout << "✓ interval_map passed" << std::endl;
+}
+
+// Test the static build at sizes around powers of two, where the implicit tree is incomplete
+void test_static() {
+    std::cout << "Testing static_interval_map..." << std::endl;
+
+    std::mt19937_64 rng(2);
+    for (std::size_t n : {0u, 1u, 2u, 3u, 7u, 8u, 9u, 15u, 16u, 17u, 100u, 1023u, 1025u, 5000u}) {
+        std::vector<entry<std::int64_t>> all;
+        for (std::size_t i = 0; i < n; ++i) {
+            auto begin = static_cast<std::int64_t>(rng() % 20000) - 10000;
+            auto end = begin + 1 + static_cast<std::int64_t>(rng() % (i % 10 == 0 ? 5000 : 20));
+            all.emplace_back(my_stl::pair<std::int64_t, std::int64_t>(begin, end), static_cast<int>(i));
+        }
+        my_stl::static_interval_map<std::int64_t, int> map(all.begin(), all.end());
+        assert(map.size() == n);
+        for (std::size_t i = 1; i < n; ++i) assert(!(map.range(i) < map.range(i - 1)));
+        for (int q = 0; q < 200; ++q) {
+            auto lo = static_cast<std::int64_t>(rng() % 30000) - 15000;
+            check_queries(map, all, lo, lo + 1 + static_cast<std::int64_t>(rng() % 100));
+        }
+    }
+
+    std::cout << "✓ static_interval_map passed" << std::endl;
+}
+
+// Fuzz every size up to 300, built directly and through freeze(), so each shape of incomplete tree is covered
+void test_static_fuzz() {
+    std::cout << "Testing static_interval_map fuzz..." << std::endl;
+
+    std::mt19937_64 rng(3);
+    for (std::size_t n = 1; n <= 300; ++n) {
+        std::vector<entry<std::uint32_t>> all;
+        my_stl::interval_map<std::uint32_t, int> dynamic;
+        for (std::size_t i = 0; i < n; ++i) {
+            auto begin = static_cast<std::uint32_t>(rng() % 2000);
+            auto end = begin + 1 + static_cast<std::uint32_t>(rng() % (rng() % 6 == 0 ? 1500 : 30));
+            all.emplace_back(my_stl::pair<std::uint32_t, std::uint32_t>(begin, end), static_cast<int>(i));
+            dynamic.insert(all.back().first, static_cast<int>(i));
+        }
+        my_stl::static_interval_map<std::uint32_t, int> built(all.begin(), all.end());
+        auto frozen = dynamic.freeze();
+        for (int q = 0; q < 100; ++q) {
+            auto lo = static_cast<std::uint32_t>(rng() % 3600);
+            auto hi = lo + 1 + static_cast<std::uint32_t>(rng() % 60);
+            check_queries(built, all, lo, hi);
+            check_queries(frozen, all, lo, hi);
+        }
+    }
+
+    std::cout << "✓ static_interval_map fuzz passed" << std::endl;
+}
+
+// Test IP-range rules with freeze(), floating point time ranges and early termination
+void test_usage() {
+    std::cout << "Testing interval map usage..." << std::endl;
+
+    // 10.0.0.0/8, 10.1.0.0/16, 192.168.0.0/16
+    my_stl::interval_map<std::uint32_t, std::string> rules;
+    rules.insert(my_stl::pair<std::uint32_t, std::uint32_t>(0x0A000000u, 0x0B000000u), "private-10");
+    rules.insert(my_stl::pair<std::uint32_t, std::uint32_t>(0x0A010000u, 0x0A020000u), "lab");
+    rules.insert(my_stl::pair<std::uint32_t, std::uint32_t>(0xC0A80000u, 0xC0A90000u), "private-192");
+    std::vector<std::string> matched;
+    rules.for_each_stab(0x0A010203u, [&](const auto&, const std::string& name) { matched.push_back(name); });
+    std::sort(matched.begin(), matched.end());
+    assert((matched == std::vector<std::string>{"lab", "private-10"}));
+    assert(!rules.contains(0x08080808u));
+
+    auto frozen = rules.freeze();
+    assert(frozen.size() == 3 && frozen.contains(0xC0A80101u) && !frozen.contains(0xC0A90000u));
+    assert(frozen.value(0) == "private-10");
+
+    // Half-open time ranges in seconds
+    my_stl::static_interval_map<double, int> windows(std::vector<my_stl::pair<my_stl::pair<double, double>, int>>{
+        {{0.0, 1.5}, 1}, {{1.5, 3.0}, 2}, {{2.0, 2.5}, 3}});
+    assert(windows.count_overlap(1.5, 2.1) == 2);
+    assert(windows.contains(1.5) && !windows.contains(3.0));
+
+    // Returning false stops the traversal
+    int visited = 0;
+    windows.for_each_overlap(0.0, 10.0, [&](const auto&, const int&) { return ++visited < 2; });
+    assert(visited == 2);
+    (void)visited;
+
+    std::cout << "✓ interval map usage passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Interval Map Tests ===" << std::endl;
+
+    try {
+        test_dynamic();
+        test_static();
+        test_static_fuzz();
+        test_usage();
+
+        std::cout << "\n✅ All interval map tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/layout.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+struct Empty {};
+
+struct NoDefault {
+    explicit NoDefault(int v) : value(v) {}
+    int value;
+};
+
+void test_basic_layout() {
+    std::cout << "Testing basic layout description..." << std::endl;
+
+    auto info = my_stl::describe_layout<my_stl::pair<char, int>>();
+    assert(info.size == sizeof(my_stl::pair<char, int>));
+    assert(info.align == alignof(int));
+    assert(info.first_offset == 0);
+    assert(info.second_offset == alignof(int));
+    assert(info.padding() == info.size - sizeof(char) - sizeof(int));
+    assert(info.trivially_relocatable);
+    assert(info.standard_layout);
+
+    auto std_info = my_stl::describe_layout<std::pair<char, int>>();
+    assert(std_info.size == info.size);
+    assert(std_info.second_offset == info.second_offset);
+
+    std::cout << "✓ Basic layout description passed" << std::endl;
+}
+
+void test_ebco_layout() {
+    std::cout << "Testing EBCO layout description..." << std::endl;
+
+    auto compressed = my_stl::describe_layout<my_stl::detail::pair_impl<Empty, int>>();
+    assert(compressed.size == sizeof(int));
+    assert(compressed.first_size == 0);
+    assert(compressed.padding() == 0);
+    assert(compressed.saved_vs_naive() == compressed.naive_size - sizeof(int));
+
+    auto plain = my_stl::describe_layout<my_stl::pair<Empty, int>>();
+    assert(plain.saved_vs_naive() == 0);
+    assert(plain.padding() == plain.size - sizeof(int));
+
+    std::cout << "✓ EBCO layout description passed" << std::endl;
+}
+
+void test_packed_layout() {
+    std::cout << "Testing packed layout estimate..." << std::endl;
+
+    auto packed = my_stl::packed_layout<std::uint64_t, std::uint32_t>();
+    assert(packed.size == 12);
+    assert(packed.align == 1);
+    assert(packed.second_offset == 8);
+    assert(packed.padding() == 0);
+
+    auto empty = my_stl::packed_layout<Empty, Empty>();
+    assert(empty.size == 1);
+
+    std::cout << "✓ Packed layout estimate passed" << std::endl;
+}
+
+void test_non_default_constructible() {
+    std::cout << "Testing non-default-constructible members..." << std::endl;
+
+    auto info = my_stl::describe_layout<my_stl::pair<NoDefault, double>>();
+    assert(info.first_offset == 0);
+    assert(info.second_offset == alignof(double));
+
+    std::cout << "✓ Non-default-constructible members passed" << std::endl;
+}
+
+void test_reference_members() {
+    std::cout << "Testing reference members..." << std::endl;
+
+    std::vector<my_stl::layout_info> rows;
+    my_stl::describe_all_layouts<int&, long>(rows);
+    assert(rows.size() == 3);
+    for (std::size_t i = 0; i < 2; ++i) {
+        assert(rows[i].first_offset == my_stl::layout_info::unknown_offset);
+        assert(rows[i].second_offset != my_stl::layout_info::unknown_offset);
+        assert(rows[i].second_offset < rows[i].size);
+    }
+
+    std::ostringstream table, json;
+    my_stl::format_table(table, rows);
+    my_stl::format_json(json, rows);
+    assert(table.str().find("n/a") != std::string::npos);
+    assert(json.str().find("\"first_offset\": null") != std::string::npos);
+
+    std::cout << "✓ Reference members passed" << std::endl;
+}
+
+void test_traits() {
+    std::cout << "Testing relocatability traits..." << std::endl;
+
+    static_assert(my_stl::detail::is_trivially_relocatable_v<my_stl::pair<int, double>>);
+    static_assert(my_stl::detail::is_trivially_relocatable_v<std::pair<int, double>>);
+    static_assert(!my_stl::detail::is_trivially_relocatable_v<my_stl::pair<std::string, int>>);
+
+    auto info = my_stl::describe_layout<my_stl::pair<std::string, int>>();
+    assert(!info.trivially_copyable);
+    assert(!info.trivially_relocatable);
+
+    std::cout << "✓ Relocatability traits passed" << std::endl;
+}
+
+void test_output_formats() {
+    std::cout << "Testing table and JSON output..." << std::endl;
+
+    std::vector<my_stl::layout_info> rows;
+    my_stl::describe_all_layouts<std::uint32_t, std::uint64_t>(rows);
+    assert(rows.size() == 4);
+
+    std::ostringstream table;
+    my_stl::format_table(table, rows);
+    assert(table.str().find("compressed") != std::string::npos);
+    assert(table.str().find("packed") != std::string::npos);
+
+    std::ostringstream json;
+    my_stl::format_json(json, rows);
+    assert(json.str().front() == '[');
+    assert(json.str().find("\"second_offset\": 8") != std::string::npos);
+
+    std::cout << table.str();
+    std::cout << "✓ Table and JSON output passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Layout Tests ===" << std::endl;
+
+    try {
+        test_basic_layout();
+        test_ebco_layout();
+        test_packed_layout();
+        test_non_default_constructible();
+        test_reference_members();
+        test_traits();
+        test_output_formats();
+
+        std::cout << "\n✅ All layout tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/learned_index.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+template <typename K, typename V>
+std::size_t reference_lower_bound(const std::vector<my_stl::pair<K, V>>& data, K key) {
+    return static_cast<std::size_t>(
+        std::lower_bound(data.begin(), data.end(), key,
+                         [](const my_stl::pair<K, V>& p, K k) { return p.first < k; }) -
+        data.begin());
+}
+
+// Check every stored key, its neighbours and random probes; for distinct keys the
+// model's bound must contain the answer without falling back to galloping
+template <typename K, typename V>
+void check_index(const std::vector<my_stl::pair<K, V>>& data, std::size_t max_error, bool distinct) {
+    my_stl::learned_index<K, V> index(data.data(), data.data() + data.size(), max_error);
+    assert(index.size() == data.size());
+
+    std::vector<K> probes = {std::numeric_limits<K>::min(), std::numeric_limits<K>::max()};
+    for (const auto& p : data) {
+        probes.push_back(p.first);
+        if (p.first != std::numeric_limits<K>::max()) probes.push_back(static_cast<K>(p.first + 1));
+        if (p.first != std::numeric_limits<K>::min()) probes.push_back(static_cast<K>(p.first - 1));
+    }
+    std::mt19937_64 rng(data.size());
+    for (int i = 0; i < 200; ++i) probes.push_back(static_cast<K>(rng()));
+
+    for (K key : probes) {
+        std::size_t expected = reference_lower_bound(data, key);
+        assert(static_cast<std::size_t>(index.lower_bound(key) - data.data()) == expected);
+        const auto* found = index.find(key);
+        assert((found != nullptr) == (expected < data.size() && data[expected].first == key));
+        if (found) assert(found == data.data() + expected);
+        (void)found;
+        (void)expected;
+    }
+
+    if (distinct) {
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            auto b = index.bound(data[i].first);
+            assert(b.begin <= i && i < b.end + 1);
+            assert(b.end - b.begin <= 2 * max_error + 2);
+            (void)b;
+        }
+    }
+}
+
+// Test near-linear timestamps, where the model should stay tiny
+void test_timestamps() {
+    std::cout << "Testing learned index on timestamp keys..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    std::vector<my_stl::pair<std::uint64_t, std::uint64_t>> table;
+    std::uint64_t ts = 1700000000000000ull;
+    for (std::size_t i = 0; i < 200000; ++i) {
+        ts += 1000 + rng() % 50;   // ~1ms apart with jitter
+        table.emplace_back(ts, i * 64);
+    }
+    check_index(table, 32, true);
+
+    my_stl::learned_index<std::uint64_t, std::uint64_t> index(table.data(), table.data() + table.size(), 32);
+    std::cout << "  " << index.spline_points() << " spline points, " << index.model_size_bytes()
+              << " bytes for " << table.size() << " keys" << std::endl;
+    assert(index.model_size_bytes() < 64 * 1024);
+
+    std::cout << "✓ Learned index on timestamp keys passed" << std::endl;
+}
+
+// Test skewed, random, duplicated and signed key distributions
+void test_distributions() {
+    std::cout << "Testing learned index on other distributions..." << std::endl;
+
+    std::mt19937_64 rng(2);
+
+    // Uniformly random (needs many spline points)
+    std::vector<my_stl::pair<std::uint32_t, std::uint32_t>> random;
+    for (std::uint32_t i = 0; i < 50000; ++i) random.emplace_back(static_cast<std::uint32_t>(rng()), i);
+    std::sort(random.begin(), random.end());
+    random.erase(std::unique(random.begin(), random.end(),
+                             [](const auto& a, const auto& b) { return a.first == b.first; }),
+                 random.end());
+    for (std::size_t err : {1u, 8u, 64u}) check_index(random, err, true);
+
+    // Exponentially growing gaps
+    std::vector<my_stl::pair<std::uint64_t, int>> skewed;
+    for (int i = 0; i < 5000; ++i) skewed.emplace_back(static_cast<std::uint64_t>(std::pow(1.008, i)) + static_cast<std::uint64_t>(i), i);
+    check_index(skewed, 4, true);
+
+    // Heavy duplicates (the bound no longer covers every run, galloping does)
+    std::vector<my_stl::pair<std::int32_t, std::int32_t>> dups;
+    for (std::int32_t k = -500; k < 500; ++k) {
+        int copies = (k % 97 == 0) ? 300 : 1 + (k & 3);
+        for (int c = 0; c < copies; ++c) dups.emplace_back(k * 5, c);
+    }
+    check_index(dups, 4, false);
+
+    // Full-range signed keys
+    std::vector<my_stl::pair<std::int64_t, std::int64_t>> wide;
+    for (int i = 0; i < 3000; ++i) wide.emplace_back(static_cast<std::int64_t>(rng()), i);
+    wide.emplace_back(std::numeric_limits<std::int64_t>::min(), -1);
+    wide.emplace_back(std::numeric_limits<std::int64_t>::max(), -2);
+    std::sort(wide.begin(), wide.end());
+    check_index(wide, 16, true);
+
+    // Tiny inputs
+    std::vector<my_stl::pair<std::uint16_t, char>> tiny;
+    check_index(tiny, 8, true);
+    tiny.emplace_back(7, 'a');
+    check_index(tiny, 8, true);
+    tiny.emplace_back(7, 'b');
+    tiny.emplace_back(9, 'c');
+    check_index(tiny, 0, false);
+
+    std::cout << "✓ Learned index on other distributions passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Learned Index Tests ===" << std::endl;
+
+    try {
+        test_timestamps();
+        test_distributions();
+
+        std::cout << "\n✅ All learned index tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/minmax.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using my_stl::simd::isa;
+
+// Every level the machine can run, from scalar up to the detected one
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+// Test every dispatch level against the scalar kernel, for plain arrays and the first of each pair
+template <typename T>
+void check_kernels(const char* name, T (*make)(std::mt19937_64&)) {
+    std::cout << "Testing minmax kernels on " << name << "..." << std::endl;
+
+    std::mt19937_64 rng(sizeof(T) * 7 + std::is_signed_v<T>);
+    // Strided reads reach offset + 2 * n - 1 for the largest n and offset below
+    std::vector<T> data(2 * 1000 + 5);
+    for (auto& v : data) v = make(rng);
+
+    for (isa level : runnable_levels()) {
+        auto plain = my_stl::detail::minmax_table<T, 1>().resolve(level);
+        auto strided = my_stl::detail::minmax_table<T, 2>().resolve(level);
+        for (std::size_t n : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 17u, 33u, 1000u}) {
+            for (std::size_t offset : {0u, 1u, 5u}) {
+                T lo, hi, ref_lo, ref_hi;
+                plain(data.data() + offset, n, lo, hi);
+                my_stl::detail::minmax_scalar<T, 1>(data.data() + offset, n, ref_lo, ref_hi);
+                assert(lo == ref_lo && hi == ref_hi);
+                strided(data.data() + offset, n, lo, hi);
+                my_stl::detail::minmax_scalar<T, 2>(data.data() + offset, n, ref_lo, ref_hi);
+                assert(lo == ref_lo && hi == ref_hi);
+            }
+        }
+    }
+
+    std::cout << "✓ minmax kernels on " << name << " passed" << std::endl;
+}
+
+void test_kernels() {
+    check_kernels<std::int32_t>("int32_t", [](std::mt19937_64& r) { return static_cast<std::int32_t>(r()); });
+    check_kernels<std::uint32_t>("uint32_t", [](std::mt19937_64& r) { return static_cast<std::uint32_t>(r()); });
+    check_kernels<std::int64_t>("int64_t", [](std::mt19937_64& r) { return static_cast<std::int64_t>(r()); });
+    check_kernels<std::uint64_t>("uint64_t", [](std::mt19937_64& r) { return static_cast<std::uint64_t>(r()); });
+    check_kernels<float>("float", [](std::mt19937_64& r) {
+        return r() % 10 == 0 ? std::nanf("") : static_cast<float>(static_cast<std::int64_t>(r() % 20000) - 10000) / 8.0f;
+    });
+    check_kernels<double>("double", [](std::mt19937_64& r) {
+        return r() % 10 == 0 ? std::nan("") : static_cast<double>(static_cast<std::int64_t>(r())) / 1e9;
+    });
+}
+
+// Test minmax_element against std::minmax_element, including ties across SIMD blocks
+void test_minmax_element() {
+    std::cout << "Testing minmax_element and minmax..." << std::endl;
+
+    std::mt19937_64 rng(3);
+    for (std::size_t n : {1u, 2u, 15u, 100u, 2047u, 2048u, 2049u, 10000u}) {
+        std::vector<std::int32_t> small(n);
+        for (auto& v : small) v = static_cast<std::int32_t>(rng() % 50);   // many duplicates
+        auto got = my_stl::minmax_element(small.data(), small.data() + n);
+        auto expected = std::minmax_element(small.data(), small.data() + n);
+        assert(got.first == expected.first && got.second == expected.second);
+        auto values = my_stl::minmax(small.data(), n);
+        assert(values.first == *expected.first && values.second == *expected.second);
+
+        std::vector<std::uint64_t> wide(n);
+        for (auto& v : wide) v = rng();
+        auto got_wide = my_stl::minmax_element(wide.data(), wide.data() + n);
+        auto expected_wide = std::minmax_element(wide.data(), wide.data() + n);
+        assert(got_wide.first == expected_wide.first && got_wide.second == expected_wide.second);
+        (void)got;
+        (void)values;
+        (void)got_wide;
+        (void)expected;
+        (void)expected_wide;
+    }
+
+    // Extremes at the type limits and in the last element
+    std::vector<std::int64_t> limits(5000, 0);
+    limits[4999] = std::numeric_limits<std::int64_t>::min();
+    limits[17] = std::numeric_limits<std::int64_t>::max();
+    limits[3000] = std::numeric_limits<std::int64_t>::max();
+    auto r = my_stl::minmax_element(limits.data(), limits.data() + limits.size());
+    assert(r.first == limits.data() + 4999 && r.second == limits.data() + 3000);
+    (void)r;
+
+    // Empty range
+    std::vector<float> empty;
+    auto e = my_stl::minmax_element(empty.data(), empty.data());
+    assert(e.first == empty.data() && e.second == empty.data());
+    (void)e;
+
+    std::cout << "✓ minmax_element and minmax passed" << std::endl;
+}
+
+// Test that NaNs are skipped and an all-NaN range points at the first element
+void test_nan() {
+    std::cout << "Testing minmax with NaN..." << std::endl;
+
+    const double nan = std::nan("");
+    std::vector<double> data(5000, nan);
+    auto r = my_stl::minmax_element(data.data(), data.data() + data.size());
+    assert(r.first == data.data() && r.second == data.data());
+    auto values = my_stl::minmax(data.data(), data.size());
+    assert(std::isnan(values.first) && std::isnan(values.second));
+
+    data[2500] = -std::numeric_limits<double>::infinity();
+    data[4000] = -std::numeric_limits<double>::infinity();
+    r = my_stl::minmax_element(data.data(), data.data() + data.size());
+    assert(r.first == data.data() + 2500 && r.second == data.data() + 4000);
+
+    data[10] = 1.5;
+    data[4999] = -2.0;
+    r = my_stl::minmax_element(data.data(), data.data() + data.size());
+    assert(r.first == data.data() + 2500 && r.second == data.data() + 10);
+    values = my_stl::minmax(data.data(), data.size());
+    assert(values.first == -std::numeric_limits<double>::infinity() && values.second == 1.5);
+    (void)r;
+    (void)values;
+
+    std::cout << "✓ minmax with NaN passed" << std::endl;
+}
+
+// Test argmin_pair/argmax_pair on (score, id) arrays, with the SIMD and generic layouts
+void test_arg_extrema() {
+    std::cout << "Testing argmin_pair and argmax_pair..." << std::endl;
+
+    std::mt19937_64 rng(4);
+    for (std::size_t n : {1u, 3u, 8u, 1000u, 4097u}) {
+        std::vector<my_stl::pair<float, std::uint32_t>> scores(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            // Ids are large enough to be bigger/smaller than any score when read as float
+            scores[i] = my_stl::pair<float, std::uint32_t>(static_cast<float>(rng() % 100), static_cast<std::uint32_t>(rng()));
+        }
+        auto by_score = [](const auto& a, const auto& b) { return a.first < b.first; };
+        const auto* lo = my_stl::argmin_pair(scores.data(), scores.data() + n);
+        const auto* hi = my_stl::argmax_pair(scores.data(), scores.data() + n);
+        assert(lo == &*std::min_element(scores.begin(), scores.end(), by_score));
+        assert(hi == &*std::max_element(scores.begin(), scores.end(), by_score));   // first maximum
+
+        std::vector<my_stl::pair<std::int64_t, std::string>> named(n);
+        for (std::size_t i = 0; i < n; ++i) named[i].first = static_cast<std::int64_t>(rng() % 100) - 50;
+        assert(my_stl::argmin_pair(named.data(), named.data() + n) ==
+               &*std::min_element(named.begin(), named.end(), by_score));
+        assert(my_stl::argmax_pair(named.data(), named.data() + n) ==
+               &*std::max_element(named.begin(), named.end(), by_score));
+        (void)lo;
+        (void)hi;
+        (void)by_score;
+    }
+
+    std::vector<my_stl::pair<double, std::uint64_t>> none;
+    assert(my_stl::argmin_pair(none.data(), none.data()) == none.data());
+    assert(my_stl::argmax_pair(none.data(), none.data()) == none.data());
+
+    std::cout << "✓ argmin_pair and argmax_pair passed" << std::endl;
+}
+
+// Test that the parallel variants merge chunks with the serial tie-breaking rules
+void test_parallel() {
+    std::cout << "Testing parallel variants..." << std::endl;
+
+    const std::size_t n = 4 * my_stl::detail::minmax_parallel_grain + 123;
+    std::vector<std::uint32_t> data(n);
+    std::mt19937_64 rng(5);
+    for (auto& v : data) v = static_cast<std::uint32_t>(rng() % 1000 + 10);
+    // Equal extremes in different chunks
+    data[5] = data[n / 2] = 1;
+    data[n / 3] = data[n - 1] = 5000;
+
+    for (unsigned threads : {0u, 1u, 3u, 4u, 64u}) {
+        auto r = my_stl::minmax_element_parallel(data.data(), data.data() + n, threads);
+        assert(r.first == data.data() + 5 && r.second == data.data() + n - 1);
+        auto values = my_stl::minmax_parallel(data.data(), n, threads);
+        assert(values.first == 1 && values.second == 5000);
+        (void)r;
+        (void)values;
+    }
+
+    std::vector<my_stl::pair<double, std::int64_t>> scores(n);
+    for (std::size_t i = 0; i < n; ++i) scores[i] = my_stl::pair<double, std::int64_t>(static_cast<double>(rng() % 1000), static_cast<std::int64_t>(i));
+    scores[n - 10].first = -1.0;
+    scores[n / 4 + 1].first = 2000.0;
+    scores[n - 2].first = 2000.0;
+    for (unsigned threads : {0u, 2u, 4u}) {
+        assert(my_stl::argmin_pair_parallel(scores.data(), scores.data() + n, threads)->second == static_cast<std::int64_t>(n - 10));
+        assert(my_stl::argmax_pair_parallel(scores.data(), scores.data() + n, threads)->second == static_cast<std::int64_t>(n / 4 + 1));
+        (void)threads;
+    }
+
+    std::cout << "✓ parallel variants passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair MinMax Tests ===" << std::endl;
+
+    try {
+        test_kernels();
+        test_minmax_element();
+        test_nan();
+        test_arg_extrema();
+        test_parallel();
+
+        std::cout << "\n✅ All minmax tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
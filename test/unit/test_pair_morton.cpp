@@ -0,0 +1,145 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/morton.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using my_stl::morton_point;
+using my_stl::simd::isa;
+
+// Every level the machine can run, from scalar up to the detected one
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+// Bit-by-bit reference interleave
+std::uint64_t reference_encode(std::uint32_t x, std::uint32_t y) {
+    std::uint64_t code = 0;
+    for (int b = 0; b < 32; ++b) {
+        code |= static_cast<std::uint64_t>((x >> b) & 1) << (2 * b);
+        code |= static_cast<std::uint64_t>((y >> b) & 1) << (2 * b + 1);
+    }
+    return code;
+}
+
+// Test the constexpr single-value functions
+void test_single_value() {
+    std::cout << "Testing constexpr morton_encode/morton_decode..." << std::endl;
+
+    static_assert(my_stl::morton_encode(0, 0) == 0);
+    static_assert(my_stl::morton_encode(1, 0) == 1);
+    static_assert(my_stl::morton_encode(0, 1) == 2);
+    static_assert(my_stl::morton_encode(3, 5) == 0x27);
+    static_assert(my_stl::morton_encode(0xFFFFFFFFu, 0xFFFFFFFFu) == ~0ull);
+    static_assert(my_stl::morton_decode(0x27) == morton_point(3, 5));
+    static_assert(my_stl::morton_decode(0xAAAAAAAAAAAAAAAAull) == morton_point(0, 0xFFFFFFFFu));
+
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 10000; ++i) {
+        auto x = static_cast<std::uint32_t>(rng());
+        auto y = static_cast<std::uint32_t>(rng());
+        std::uint64_t code = my_stl::morton_encode(x, y);
+        assert(code == reference_encode(x, y));
+        assert(my_stl::morton_decode(code) == morton_point(x, y));
+        (void)code;
+    }
+
+    std::cout << "✓ constexpr morton_encode/morton_decode passed" << std::endl;
+}
+
+// Test every dispatch level of the batch kernels against the scalar functions
+void test_batch_kernels() {
+    std::cout << "Testing batch Morton kernels..." << std::endl;
+
+    std::mt19937_64 rng(2);
+    std::vector<morton_point> points(1000);
+    for (auto& p : points) p = morton_point(static_cast<std::uint32_t>(rng()), static_cast<std::uint32_t>(rng()));
+    points[0] = morton_point(0xFFFFFFFFu, 0);
+    points[1] = morton_point(0, 0xFFFFFFFFu);
+
+    for (isa level : runnable_levels()) {
+        auto encode = my_stl::detail::morton_encode_table().resolve(level);
+        auto decode = my_stl::detail::morton_decode_table().resolve(level);
+        for (std::size_t n : {0u, 1u, 7u, 8u, 9u, 17u, 1000u}) {
+            std::vector<std::uint64_t> codes(n + 1, 0x1234);
+            encode(points.data(), n, codes.data());
+            for (std::size_t i = 0; i < n; ++i) assert(codes[i] == my_stl::morton_encode(points[i]));
+            assert(codes[n] == 0x1234);
+
+            std::vector<morton_point> back(n + 1, morton_point(7, 7));
+            decode(codes.data(), n, back.data());
+            for (std::size_t i = 0; i < n; ++i) assert(back[i] == points[i]);
+            assert(back[n] == morton_point(7, 7));
+        }
+    }
+
+    std::cout << "✓ Batch Morton kernels passed" << std::endl;
+}
+
+// Test that morton_sort orders points by code and keeps the multiset of points
+void test_morton_sort() {
+    std::cout << "Testing morton_sort..." << std::endl;
+
+    // Row-major grid, as produced by tile iteration
+    std::vector<morton_point> grid;
+    for (std::uint32_t y = 0; y < 64; ++y) {
+        for (std::uint32_t x = 0; x < 64; ++x) grid.emplace_back(x, y);
+    }
+    my_stl::morton_sort(grid.data(), grid.size());
+    for (std::size_t i = 0; i < grid.size(); ++i) assert(my_stl::morton_encode(grid[i]) == i);
+    // The first 2x2 quad is contiguous
+    assert(grid[0] == morton_point(0, 0) && grid[1] == morton_point(1, 0) && grid[2] == morton_point(0, 1) &&
+           grid[3] == morton_point(1, 1));
+
+    std::mt19937_64 rng(3);
+    for (std::size_t n : {0u, 1u, 100u, 5000u}) {
+        std::vector<morton_point> points(n);
+        for (auto& p : points) p = morton_point(static_cast<std::uint32_t>(rng() % 3000), static_cast<std::uint32_t>(rng()));
+        auto expected = points;
+        std::sort(expected.begin(), expected.end(), [](const morton_point& a, const morton_point& b) {
+            return my_stl::morton_encode(a) < my_stl::morton_encode(b);
+        });
+        my_stl::morton_sort(points.data(), points.size());
+        assert(points == expected);
+    }
+
+    std::cout << "✓ morton_sort passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Morton Tests ===" << std::endl;
+
+    try {
+        test_single_value();
+        test_batch_kernels();
+        test_morton_sort();
+
+        std::cout << "\n✅ All Morton tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/radix_sort.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+// Test radix_sort on unsigned integers of every width, including skipped digits
+void test_radix_sort() {
+    std::cout << "Testing radix_sort..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    for (std::size_t n : {0u, 1u, 255u, 256u, 257u, 10000u}) {
+        std::vector<std::uint64_t> wide(n);
+        for (auto& v : wide) v = rng();
+        auto expected = wide;
+        std::sort(expected.begin(), expected.end());
+        my_stl::radix_sort(wide.data(), n);
+        assert(wide == expected);
+
+        // Only the middle bytes differ
+        std::vector<std::uint64_t> sparse(n);
+        for (auto& v : sparse) v = 0xAB00000000000000ull | ((rng() & 0xFFFF) << 16);
+        expected = sparse;
+        std::sort(expected.begin(), expected.end());
+        my_stl::radix_sort(sparse.data(), n);
+        assert(sparse == expected);
+
+        std::vector<std::uint16_t> narrow(n);
+        for (auto& v : narrow) v = static_cast<std::uint16_t>(rng());
+        auto expected_narrow = narrow;
+        std::sort(expected_narrow.begin(), expected_narrow.end());
+        my_stl::radix_sort(narrow.data(), n);
+        assert(narrow == expected_narrow);
+    }
+
+    std::cout << "✓ radix_sort passed" << std::endl;
+}
+
+// Test radix_sort_first with signed keys and check stability on the second member
+void test_radix_sort_first() {
+    std::cout << "Testing radix_sort_first..." << std::endl;
+
+    std::mt19937_64 rng(2);
+    for (std::size_t n : {3u, 300u, 20000u}) {
+        std::vector<my_stl::pair<std::int32_t, std::uint32_t>> data(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i] = my_stl::pair<std::int32_t, std::uint32_t>(static_cast<std::int32_t>(rng() % 200) - 100,
+                                                                static_cast<std::uint32_t>(i));
+        }
+        data[0].first = std::numeric_limits<std::int32_t>::min();
+        data[n - 1].first = std::numeric_limits<std::int32_t>::max();
+        auto expected = data;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        my_stl::radix_sort_first(data.data(), n);
+        assert(data == expected);
+    }
+
+    // Custom key: sort by second, descending
+    std::vector<my_stl::pair<char, std::uint64_t>> records;
+    for (std::uint64_t i = 0; i < 1000; ++i) records.emplace_back(static_cast<char>('a' + i % 26), rng() % 50);
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+    my_stl::radix_sort_by(records.data(), records.size(),
+                          [](const my_stl::pair<char, std::uint64_t>& p) { return ~p.second; });
+    assert(records == expected);
+
+    std::cout << "✓ radix_sort_first passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Radix Sort Tests ===" << std::endl;
+
+    try {
+        test_radix_sort();
+        test_radix_sort_first();
+
+        std::cout << "\n✅ All radix sort tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
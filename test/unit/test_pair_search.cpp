@@ -0,0 +1,178 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/search.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using my_stl::simd::isa;
+
+// Every level the machine can run, from scalar up to the detected one
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+// Sizes around the window (8 or 16 elements) and a few larger ones
+const std::size_t sizes[] = {0, 1, 2, 7, 8, 9, 15, 16, 17, 31, 33, 100, 1000, 4097};
+
+template <typename K, typename V>
+std::size_t reference_lower_bound(const std::vector<my_stl::pair<K, V>>& data, std::size_t n, K key) {
+    return static_cast<std::size_t>(
+        std::lower_bound(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(n), key,
+                         [](const my_stl::pair<K, V>& p, K k) { return p.first < k; }) -
+        data.begin());
+}
+
+// Sorted keys with duplicates, spread over the whole range including the extremes
+template <typename K, typename V>
+std::vector<my_stl::pair<K, V>> make_sorted(std::size_t n, std::mt19937_64& rng) {
+    std::vector<my_stl::pair<K, V>> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        K k = static_cast<K>(rng() % 3 == 0 ? rng() % 64 : rng());
+        data[i] = my_stl::pair<K, V>(k, static_cast<V>(i));
+    }
+    if (n > 2) {
+        data[0].first = std::numeric_limits<K>::min();
+        data[n - 1].first = std::numeric_limits<K>::max();
+    }
+    std::sort(data.begin(), data.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    return data;
+}
+
+template <typename K, typename V>
+std::vector<K> probe_keys(const std::vector<my_stl::pair<K, V>>& data, std::mt19937_64& rng) {
+    std::vector<K> keys = {std::numeric_limits<K>::min(), std::numeric_limits<K>::max(), K(0), K(1), K(63)};
+    for (const auto& p : data) {
+        keys.push_back(p.first);
+        // Neighbours of the extremes would overflow signed keys; the extremes are already probed
+        if (p.first != std::numeric_limits<K>::max()) keys.push_back(static_cast<K>(p.first + 1));
+        if (p.first != std::numeric_limits<K>::min()) keys.push_back(static_cast<K>(p.first - 1));
+    }
+    for (int i = 0; i < 50; ++i) keys.push_back(static_cast<K>(rng()));
+    return keys;
+}
+
+// Test every dispatch level of the single and batch kernels against std::lower_bound
+template <typename K, typename V>
+void check_kernels(const char* name) {
+    std::cout << "Testing lower_bound kernels for " << name << "..." << std::endl;
+    static_assert(my_stl::detail::is_simd_searchable_v<K, V>, "kernel test needs a packed pair");
+
+    std::mt19937_64 rng(sizeof(K) * 7 + std::is_signed_v<K>);
+    for (std::size_t n : sizes) {
+        auto data = make_sorted<K, V>(n, rng);
+        auto keys = probe_keys(data, rng);
+        const K* raw = reinterpret_cast<const K*>(data.data());
+
+        std::vector<std::size_t> expected(keys.size());
+        for (std::size_t j = 0; j < keys.size(); ++j) expected[j] = reference_lower_bound(data, n, keys[j]);
+
+        for (isa level : runnable_levels()) {
+            auto single = my_stl::detail::lower_bound_table<K>().resolve(level);
+            auto batch = my_stl::detail::lower_bound_batch_table<K>().resolve(level);
+            for (std::size_t j = 0; j < keys.size(); ++j) assert(single(raw, n, keys[j]) == expected[j]);
+            (void)single;
+
+            std::vector<std::size_t> out(keys.size(), ~std::size_t(0));
+            batch(raw, n, keys.data(), keys.size(), out.data());
+            assert(out == expected);
+        }
+        (void)raw;
+    }
+
+    std::cout << "✓ lower_bound kernels for " << name << " passed" << std::endl;
+}
+
+// Test the public entry points, including a pair type that takes the generic path
+void test_public_api() {
+    std::cout << "Testing lower_bound_first/equal_range_first..." << std::endl;
+
+    std::vector<my_stl::pair<int, int>> table;
+    for (int k = -50; k < 50; ++k) {
+        for (int c = 0; c < (k & 3); ++c) table.emplace_back(k * 2, c);
+    }
+    const auto* first = table.data();
+    const auto* last = table.data() + table.size();
+
+    for (int key = -120; key <= 120; ++key) {
+        auto lo = my_stl::lower_bound_first(first, last, key);
+        auto range = my_stl::equal_range_first(first, last, key);
+        auto expected = std::equal_range(table.begin(), table.end(), my_stl::pair<int, int>(key, 0),
+                                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        assert(lo == first + (expected.first - table.begin()));
+        assert(range.first == lo);
+        assert(range.second == first + (expected.second - table.begin()));
+        (void)lo;
+        (void)range;
+        (void)expected;
+    }
+
+    // Batch lookups agree with single lookups
+    std::vector<int> keys;
+    for (int key = -120; key <= 120; key += 3) keys.push_back(key);
+    std::vector<std::size_t> out(keys.size());
+    my_stl::lower_bound_first_batch(first, last, keys.data(), keys.size(), out.data());
+    for (std::size_t j = 0; j < keys.size(); ++j) {
+        assert(first + out[j] == my_stl::lower_bound_first(first, last, keys[j]));
+    }
+
+    // Padded pair (uint32_t key, uint64_t value) uses the scalar branchless search
+    std::vector<my_stl::pair<std::uint32_t, std::uint64_t>> padded;
+    for (std::uint32_t k = 0; k < 500; ++k) padded.emplace_back(k * 3, k);
+    auto range = my_stl::equal_range_first(padded.data(), padded.data() + padded.size(), std::uint32_t(300));
+    assert(range.second - range.first == 1 && range.first->second == 100);
+    range = my_stl::equal_range_first(padded.data(), padded.data() + padded.size(), std::uint32_t(301));
+    assert(range.first == range.second && range.first->first == 303);
+    std::vector<std::uint32_t> pkeys = {0, 1, 1497, 1498, 4000000000u};
+    std::vector<std::size_t> pout(pkeys.size());
+    my_stl::lower_bound_first_batch(padded.data(), padded.data() + padded.size(), pkeys.data(), pkeys.size(), pout.data());
+    assert((pout == std::vector<std::size_t>{0, 1, 499, 500, 500}));
+
+    // Upper end of the key range
+    std::vector<my_stl::pair<std::uint64_t, std::uint64_t>> top(20, my_stl::pair<std::uint64_t, std::uint64_t>(~0ull, 0));
+    auto all = my_stl::equal_range_first(top.data(), top.data() + top.size(), ~0ull);
+    assert(all.first == top.data() && all.second == top.data() + top.size());
+    (void)all;
+
+    std::cout << "✓ lower_bound_first/equal_range_first passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Search Tests ===" << std::endl;
+
+    try {
+        check_kernels<std::uint32_t, std::uint32_t>("uint32 keys");
+        check_kernels<std::int32_t, float>("int32 keys");
+        check_kernels<std::uint64_t, std::uint64_t>("uint64 keys");
+        check_kernels<std::int64_t, double>("int64 keys");
+        test_public_api();
+
+        std::cout << "\n✅ All search tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/sketch.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using isa = my_stl::simd::isa;
+using flow = my_stl::pair<std::uint32_t, std::uint16_t>;
+
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+// Skewed stream of (src_ip, dst_port) flows: a few heavy flows and a long tail
+std::vector<flow> make_stream(std::size_t n, std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<flow> stream(n);
+    for (auto& f : stream) {
+        std::uint64_t r = rng();
+        if (r % 10 < 3) f = flow(static_cast<std::uint32_t>(r >> 32) % 10, 443);
+        else f = flow(static_cast<std::uint32_t>(r >> 16) % 50000, static_cast<std::uint16_t>(r >> 48));
+    }
+    return stream;
+}
+
+// Test every dispatch level against the scalar kernels, for both update modes and several depths
+void test_kernels() {
+    std::cout << "Testing count-min kernels..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    std::vector<std::uint64_t> hashes(1000);
+    for (auto& h : hashes) h = rng();
+    for (std::size_t depth : {1u, 3u, 4u, 8u, 10u}) {
+        const std::size_t width = 256;
+        for (bool conservative : {false, true}) {
+            std::vector<std::uint32_t> reference(width * depth, 0);
+            // Start near the top so saturation is exercised
+            for (std::size_t i = 0; i < reference.size(); i += 7) reference[i] = 0xFFFFFFF0u;
+            const auto initial = reference;
+            my_stl::detail::cms_update_scalar(reference.data(), width, depth, hashes.data(), hashes.size(), 3, conservative);
+            std::vector<std::uint32_t> expected(hashes.size());
+            my_stl::detail::cms_estimate_scalar(reference.data(), width, depth, hashes.data(), hashes.size(),
+                                                expected.data());
+            for (isa level : runnable_levels()) {
+                auto table = initial;
+                my_stl::detail::cms_update_table().resolve(level)(table.data(), width, depth, hashes.data(),
+                                                                  hashes.size(), 3, conservative);
+                assert(table == reference);
+                std::vector<std::uint32_t> got(hashes.size());
+                my_stl::detail::cms_estimate_table().resolve(level)(table.data(), width, depth, hashes.data(),
+                                                                    hashes.size(), got.data());
+                assert(got == expected);
+            }
+        }
+    }
+
+    std::cout << "✓ count-min kernels passed" << std::endl;
+}
+
+// Test that estimates never undercount, stay within the error bound, and that conservative update is tighter
+void test_count_min() {
+    std::cout << "Testing count_min_sketch..." << std::endl;
+
+    auto stream = make_stream(200000, 2);
+    std::unordered_map<flow, std::uint32_t> exact;
+    for (const auto& f : stream) ++exact[f];
+
+    const double epsilon = 0.001;
+    auto standard = my_stl::count_min_sketch<std::uint32_t, std::uint16_t>::from_error(epsilon, 0.01);
+    auto conservative =
+        my_stl::count_min_sketch<std::uint32_t, std::uint16_t>::from_error(epsilon, 0.01, my_stl::cms_update::conservative);
+    assert(standard.width() == 4096 && standard.depth() == 5);
+    standard.add_batch(stream.data(), stream.size());
+    for (const auto& f : stream) conservative.add(f);
+    assert(standard.total() == stream.size() && conservative.total() == stream.size());
+
+    std::size_t over_bound = 0;
+    std::uint64_t standard_error = 0, conservative_error = 0;
+    for (const auto& kv : exact) {
+        std::uint32_t s = standard.estimate(kv.first);
+        std::uint32_t c = conservative.estimate(kv.first);
+        assert(s >= kv.second && c >= kv.second && c <= s);
+        over_bound += s - kv.second > epsilon * static_cast<double>(stream.size());
+        standard_error += s - kv.second;
+        conservative_error += c - kv.second;
+    }
+    assert(over_bound <= exact.size() / 50);
+    assert(conservative_error < standard_error);
+    (void)over_bound;
+
+    // Batch estimates agree with single ones
+    std::vector<std::uint32_t> batch(1000);
+    standard.estimate_batch(stream.data(), batch.size(), batch.data());
+    for (std::size_t i = 0; i < batch.size(); ++i) assert(batch[i] == standard.estimate(stream[i]));
+
+    // Sketches built per thread and merged equal one sketch over the whole stream
+    my_stl::count_min_sketch<std::uint32_t, std::uint16_t> left(4096, 5), right(4096, 5);
+    left.add_batch(stream.data(), stream.size() / 2);
+    right.add_batch(stream.data() + stream.size() / 2, stream.size() - stream.size() / 2);
+    left.merge(right);
+    for (std::size_t i = 0; i < 1000; ++i) assert(left.estimate(stream[i]) == standard.estimate(stream[i]));
+    assert(left.total() == standard.total());
+
+    left.clear();
+    assert(left.estimate(stream[0]) == 0 && left.total() == 0);
+
+    std::cout << "✓ count_min_sketch passed" << std::endl;
+}
+
+// Test that Space-Saving finds every flow above total / k with bounds that hold, also after merging
+void test_space_saving() {
+    std::cout << "Testing space_saving..." << std::endl;
+
+    auto stream = make_stream(100000, 3);
+    std::unordered_map<flow, std::uint64_t> exact;
+    for (const auto& f : stream) ++exact[f];
+
+    auto check = [&](const my_stl::space_saving<std::uint32_t, std::uint16_t>& top_k) {
+        for (const auto& kv : exact) {
+            const auto* e = top_k.find(kv.first);
+            if (kv.second * top_k.capacity() > top_k.total()) assert(e != nullptr);
+            if (e) assert(e->count - e->error <= kv.second && kv.second <= e->count);
+            else assert(kv.second <= top_k.min_count());
+        }
+        auto top = top_k.top(10);
+        assert(top.size() == 10);
+        for (std::size_t i = 1; i < top.size(); ++i) assert(top[i - 1].count >= top[i].count);
+        // The ten heavy flows all go to port 443
+        for (const auto& c : top) {
+            assert(c.key.second == 443 && c.key.first < 10);
+            (void)c;
+        }
+    };
+
+    my_stl::space_saving<std::uint32_t, std::uint16_t> whole(64);
+    whole.offer_batch(stream.data(), stream.size());
+    assert(whole.size() == 64 && whole.total() == stream.size());
+    check(whole);
+
+    my_stl::space_saving<std::uint32_t, std::uint16_t> first(64), second(64);
+    first.offer_batch(stream.data(), stream.size() / 3);
+    second.offer_batch(stream.data() + stream.size() / 3, stream.size() - stream.size() / 3);
+    first.merge(second);
+    assert(first.size() == 64 && first.total() == stream.size());
+    check(first);
+
+    // Weighted offers and a summary that is not full
+    my_stl::space_saving<std::uint32_t, std::uint16_t> small(4);
+    small.offer(flow(1, 80), 5);
+    small.offer(flow(2, 80));
+    assert(small.min_count() == 0 && small.find(flow(1, 80))->count == 5 && !small.find(flow(3, 80)));
+    small.clear();
+    assert(small.size() == 0 && small.total() == 0);
+
+    std::cout << "✓ space_saving passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Sketch Tests ===" << std::endl;
+
+    try {
+        test_kernels();
+        test_count_min();
+        test_space_saving();
+
+        std::cout << "\n✅ All sketch tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
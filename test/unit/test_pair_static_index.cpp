@@ -0,0 +1,125 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/static_index.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using entry = my_stl::pair<std::uint32_t, std::uint64_t>;
+
+// Test point, predecessor and successor queries against a sorted vector
+void test_queries() {
+    std::cout << "Testing static_index queries..." << std::endl;
+
+    std::mt19937 rng(3);
+    for (std::size_t n : {0u, 1u, 2u, 3u, 7u, 15u, 16u, 17u, 100u, 1000u, 4099u}) {
+        // Unique even keys, inserted unsorted
+        std::vector<entry> data;
+        for (std::size_t i = 0; i < n; ++i) data.emplace_back(static_cast<std::uint32_t>(2 * i + 10), i * 7);
+        std::shuffle(data.begin(), data.end(), rng);
+        my_stl::static_index<std::uint32_t, std::uint64_t> index(data.begin(), data.end());
+        assert(index.size() == n);
+
+        std::sort(data.begin(), data.end());
+        for (std::uint32_t key = 0; key < 2 * n + 14; ++key) {
+            auto lo = std::lower_bound(data.begin(), data.end(), key,
+                                       [](const entry& e, std::uint32_t k) { return e.first < k; });
+            auto hi = std::upper_bound(data.begin(), data.end(), key,
+                                       [](std::uint32_t k, const entry& e) { return k < e.first; });
+
+            const std::uint64_t* v = index.find(key);
+            bool present = lo != data.end() && lo->first == key;
+            assert((v != nullptr) == present);
+            if (present) assert(*v == lo->second);
+            assert(index.contains(key) == present);
+
+            auto succ = index.successor(key);
+            assert(succ.has_value() == (lo != data.end()));
+            if (succ) assert(*succ == *lo);
+
+            auto pred = index.predecessor(key);
+            assert(pred.has_value() == (hi != data.begin()));
+            if (pred) assert(*pred == *(hi - 1));
+            (void)v;
+            (void)hi;
+            (void)present;
+        }
+
+        // for_each visits in key order
+        std::vector<entry> visited;
+        index.for_each([&](std::uint32_t k, std::uint64_t v) { visited.emplace_back(k, v); });
+        assert(visited == data);
+    }
+
+    std::cout << "✓ static_index queries passed" << std::endl;
+}
+
+// Test extreme keys, signed keys, duplicates and non-trivial values
+void test_edge_cases() {
+    std::cout << "Testing static_index edge cases..." << std::endl;
+
+    // Keys at both ends of the range
+    std::vector<my_stl::pair<std::int64_t, int>> extremes = {
+        {std::numeric_limits<std::int64_t>::min(), 1}, {-5, 2}, {0, 3}, {std::numeric_limits<std::int64_t>::max(), 4}};
+    my_stl::static_index<std::int64_t, int> index(extremes);
+    assert(*index.find(std::numeric_limits<std::int64_t>::min()) == 1);
+    assert(*index.find(std::numeric_limits<std::int64_t>::max()) == 4);
+    assert(index.predecessor(-6)->second == 1);
+    assert(index.successor(1)->second == 4);
+    assert(!index.find(1));
+
+    // Duplicate keys: find/successor return the first in sorted order, predecessor the last
+    std::vector<my_stl::pair<int, std::string>> dups = {{5, "b"}, {1, "x"}, {5, "a"}, {5, "c"}, {9, "z"}};
+    my_stl::static_index<int, std::string> names(dups.begin(), dups.end());
+    assert(*names.find(5) == "b");
+    assert(names.successor(2)->second == "b");
+    assert(names.predecessor(5)->second == "c");
+    assert(names.predecessor(8)->second == "c");
+    assert(!names.predecessor(0));
+    assert(!names.successor(10));
+
+    // Empty index
+    my_stl::static_index<int, int> empty;
+    assert(empty.empty() && !empty.find(0) && !empty.predecessor(0) && !empty.successor(0));
+
+    // Copies keep working (and the key array stays cache-line aligned)
+    auto copy = index;
+    assert(*copy.find(0) == 3);
+    assert(copy.memory_usage() >= 5 * sizeof(std::int64_t));
+
+    std::cout << "✓ static_index edge cases passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Static Index Tests ===" << std::endl;
+
+    try {
+        test_queries();
+        test_edge_cases();
+
+        std::cout << "\n✅ All static index tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
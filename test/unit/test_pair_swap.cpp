@@ -0,0 +1,191 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/swap.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using my_stl::simd::isa;
+
+// Every level the machine can run, from scalar up to the detected one
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+// Test the byte-block swap at every level, with unaligned starts and odd lengths
+void test_swap_bytes_kernels() {
+    std::cout << "Testing swap_ranges kernels..." << std::endl;
+
+    std::mt19937_64 rng(1);
+    std::vector<unsigned char> a(600), b(600);
+    for (auto& c : a) c = static_cast<unsigned char>(rng());
+    for (auto& c : b) c = static_cast<unsigned char>(rng());
+
+    for (isa level : runnable_levels()) {
+        auto fn = my_stl::detail::swap_bytes_table().resolve(level);
+        for (std::size_t bytes : {0u, 1u, 7u, 8u, 15u, 16u, 31u, 63u, 64u, 65u, 129u, 513u}) {
+            for (std::size_t offset : {0u, 3u}) {
+                auto x = a, y = b;
+                fn(x.data() + offset, y.data() + offset, bytes);
+                for (std::size_t i = 0; i < a.size(); ++i) {
+                    bool inside = i >= offset && i < offset + bytes;
+                    assert(x[i] == (inside ? b[i] : a[i]));
+                    assert(y[i] == (inside ? a[i] : b[i]));
+                    (void)inside;
+                }
+            }
+        }
+    }
+
+    std::cout << "✓ swap_ranges kernels passed" << std::endl;
+}
+
+// Test the member-swap kernel for one member width at every level
+template <typename U>
+void check_swap_members(const char* name) {
+    std::mt19937_64 rng(sizeof(U));
+    std::vector<U> data(2 * 300);
+    for (auto& v : data) v = static_cast<U>(rng());
+
+    for (isa level : runnable_levels()) {
+        auto fn = my_stl::detail::swap_members_table<U>().resolve(level);
+        for (std::size_t n : {0u, 1u, 2u, 3u, 4u, 7u, 8u, 9u, 16u, 31u, 33u, 64u, 65u, 299u}) {
+            auto got = data;
+            fn(got.data() + 2, n);   // offset by one pair, so the loads are unaligned
+            for (std::size_t i = 0; i < data.size() / 2; ++i) {
+                bool inside = i >= 1 && i < 1 + n;
+                assert(got[2 * i] == (inside ? data[2 * i + 1] : data[2 * i]));
+                assert(got[2 * i + 1] == (inside ? data[2 * i] : data[2 * i + 1]));
+                (void)inside;
+            }
+        }
+    }
+    std::cout << "  " << name << " ok" << std::endl;
+}
+
+void test_swap_members_kernels() {
+    std::cout << "Testing swap_members kernels..." << std::endl;
+
+    check_swap_members<std::uint8_t>("8-bit");
+    check_swap_members<std::uint16_t>("16-bit");
+    check_swap_members<std::uint32_t>("32-bit");
+    check_swap_members<std::uint64_t>("64-bit");
+
+    std::cout << "✓ swap_members kernels passed" << std::endl;
+}
+
+// Test the public entry points, including types that take the element-wise paths
+void test_public_api() {
+    std::cout << "Testing swap_ranges and swap_members public API..." << std::endl;
+
+    // Edge reversal
+    std::vector<my_stl::pair<std::uint32_t, std::uint32_t>> edges;
+    for (std::uint32_t u = 0; u < 1000; ++u) edges.emplace_back(u, (u * 7 + 1) % 1000);
+    auto reversed = edges;
+    my_stl::swap_members(reversed.data(), reversed.size());
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        assert(reversed[i].first == edges[i].second && reversed[i].second == edges[i].first);
+    }
+
+    std::vector<my_stl::pair<double, double>> points = {{1.5, -2.0}, {0.0, 3.25}, {-1.0, 8.0}};
+    my_stl::swap_members(points.data(), points.size());
+    assert(points[0] == my_stl::make_pair(-2.0, 1.5) && points[2] == my_stl::make_pair(8.0, -1.0));
+
+    std::vector<my_stl::pair<std::string, std::string>> names = {{"a", "b"}, {"long string value", "c"}};
+    my_stl::swap_members(names.data(), names.size());
+    assert(names[0].first == "b" && names[1].first == "c" && names[1].second == "long string value");
+
+    // Trivially copyable with padding, the whole object is swapped bytewise
+    static_assert(my_stl::detail::is_bitwise_copyable_v<my_stl::pair<char, double>>);
+    std::vector<my_stl::pair<char, double>> left(100), right(100);
+    // Distinct padding bytes on each side: only the byte-block path moves them
+    std::memset(static_cast<void*>(left.data()), 0xAA, left.size() * sizeof(left[0]));
+    std::memset(static_cast<void*>(right.data()), 0x55, right.size() * sizeof(right[0]));
+    for (int i = 0; i < 100; ++i) {
+        left[i].first = static_cast<char>('a' + i % 26);
+        left[i].second = i * 0.5;
+        right[i].first = static_cast<char>('A' + i % 26);
+        right[i].second = -i * 1.0;
+    }
+    auto left_copy = left, right_copy = right;
+    std::memcpy(static_cast<void*>(left_copy.data()), left.data(), left.size() * sizeof(left[0]));
+    std::memcpy(static_cast<void*>(right_copy.data()), right.data(), right.size() * sizeof(right[0]));
+    auto* end = my_stl::swap_ranges(left.data() + 10, left.data() + 90, right.data() + 5);
+    assert(end == right.data() + 85);
+    for (int i = 0; i < 100; ++i) {
+        bool inside = i >= 10 && i < 90;
+        assert(left[i] == (inside ? right_copy[i - 5] : left_copy[i]));
+        (void)inside;
+    }
+    for (int i = 0; i < 100; ++i) {
+        bool inside = i >= 5 && i < 85;
+        assert(right[i] == (inside ? left_copy[i + 5] : right_copy[i]));
+        (void)inside;
+    }
+    for (int i = 10; i < 90; ++i) assert(std::memcmp(&left[i], &right_copy[i - 5], sizeof(left[i])) == 0);
+    (void)end;
+
+    // Non-trivially-copyable pairs go through pair::swap
+    std::vector<my_stl::pair<int, std::string>> x = {{1, "one"}, {2, "two"}}, y = {{3, "three"}, {4, "four"}};
+    my_stl::swap_ranges(x.data(), x.data() + 2, y.data());
+    assert(x[0].second == "three" && x[1].first == 4 && y[0].second == "one" && y[1].first == 2);
+
+    // Empty ranges
+    assert(my_stl::swap_ranges(left.data(), left.data(), right.data()) == right.data());
+    my_stl::swap_members(edges.data(), 0);
+    assert(edges[0].first == 0);
+
+    std::cout << "✓ swap_ranges and swap_members public API passed" << std::endl;
+}
+
+// Pairs with const members must be rejected at compile time. Each block is built only by
+// the matching compile_fail_* test in CMakeLists.txt, which expects the static_assert message
+#if defined(MYSTL_COMPILE_FAIL_SWAP_RANGES_CONST)
+void reject_const_members() {
+    my_stl::pair<const int, int> a[4] = {}, b[4] = {};
+    my_stl::swap_ranges(a, a + 4, b);
+}
+#elif defined(MYSTL_COMPILE_FAIL_SWAP_MEMBERS_CONST)
+void reject_const_members() {
+    my_stl::pair<const int, const int> a[4] = {};
+    my_stl::swap_members(a, 4);
+}
+#endif
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Swap Tests ===" << std::endl;
+
+    try {
+        test_swap_bytes_kernels();
+        test_swap_members_kernels();
+        test_public_api();
+
+        std::cout << "\n✅ All swap tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include "../../include/my_stl/transpose.hpp"
+
+// Set console encoding to UTF-8
+void setup_console_encoding() {
+#ifdef _WIN32
+    // Set console code page to UTF-8
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+#endif
+}
+
+using my_stl::simd::isa;
+
+// Every level the machine can run, from scalar up to the detected one
+std::vector<isa> runnable_levels() {
+    std::vector<isa> levels;
+    for (int l = 0; l <= static_cast<int>(my_stl::simd::detected_isa()); ++l) {
+        levels.push_back(static_cast<isa>(l));
+    }
+    return levels;
+}
+
+// Sizes around every vector width (up to 64 elements per register for 8-bit members)
+const std::size_t sizes[] = {0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 129, 1000};
+
+// Test one member width against the scalar reference at every dispatch level
+template <typename U>
+void check_width(const char* name) {
+    std::cout << "Testing " << name << " transpose kernels..." << std::endl;
+
+    std::mt19937_64 rng(sizeof(U));
+    const std::size_t max_n = 1100;
+    std::vector<U> interleaved(2 * max_n + 2);
+    for (auto& v : interleaved) v = static_cast<U>(rng());
+
+    for (isa level : runnable_levels()) {
+        auto deinterleave = my_stl::detail::deinterleave_table<U>().resolve(level);
+        auto interleave = my_stl::detail::interleave_table<U>().resolve(level);
+        for (std::size_t n : sizes) {
+            // Offset by one element so the vector loads and stores are unaligned
+            const U* in = interleaved.data() + 1;
+            std::vector<U> first(n + 2, 0), second(n + 2, 0);
+            deinterleave(in, n, first.data() + 1, second.data() + 1);
+            for (std::size_t i = 0; i < n; ++i) {
+                assert(first[i + 1] == in[2 * i]);
+                assert(second[i + 1] == in[2 * i + 1]);
+            }
+            // Nothing written outside the destination ranges
+            assert(first[0] == 0 && first[n + 1] == 0);
+            assert(second[0] == 0 && second[n + 1] == 0);
+
+            std::vector<U> out(2 * n + 2, 0);
+            interleave(first.data() + 1, second.data() + 1, n, out.data() + 1);
+            assert(std::memcmp(out.data() + 1, in, 2 * n * sizeof(U)) == 0);
+            assert(out[0] == 0 && out[2 * n + 1] == 0);
+        }
+    }
+
+    std::cout << "✓ " << name << " transpose kernels passed" << std::endl;
+}
+
+// Test the public pair entry points for integer, floating point and signed members
+template <typename T>
+void check_pairs(T (*make)(std::size_t)) {
+    std::vector<my_stl::pair<T, T>> pairs;
+    for (std::size_t i = 0; i < 777; ++i) pairs.emplace_back(make(2 * i), make(2 * i + 1));
+
+    std::vector<T> first(pairs.size()), second(pairs.size());
+    my_stl::deinterleave(pairs.data(), pairs.size(), first.data(), second.data());
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        assert(first[i] == pairs[i].first);
+        assert(second[i] == pairs[i].second);
+    }
+
+    std::vector<my_stl::pair<T, T>> back(pairs.size());
+    my_stl::interleave(first.data(), second.data(), first.size(), back.data());
+    assert(back == pairs);
+}
+
+void test_public_api() {
+    std::cout << "Testing deinterleave/interleave on pairs..." << std::endl;
+
+    check_pairs<std::int8_t>([](std::size_t i) { return static_cast<std::int8_t>(i * 37); });
+    check_pairs<std::int16_t>([](std::size_t i) { return static_cast<std::int16_t>(-static_cast<int>(i)); });
+    check_pairs<std::uint32_t>([](std::size_t i) { return static_cast<std::uint32_t>(i * 2654435761u); });
+    check_pairs<float>([](std::size_t i) { return static_cast<float>(i) * 0.5f - 100.0f; });
+    check_pairs<double>([](std::size_t i) { return static_cast<double>(i) / 3.0; });
+    check_pairs<std::uint64_t>([](std::size_t i) { return static_cast<std::uint64_t>(i) << 40; });
+
+    // Members that are not 1/2/4/8 bytes take the element-wise path
+    struct rgb { std::uint8_t r, g, b; bool operator==(const rgb& o) const { return r == o.r && g == o.g && b == o.b; } };
+    check_pairs<rgb>([](std::size_t i) { return rgb{static_cast<std::uint8_t>(i), 1, 2}; });
+
+    std::cout << "✓ deinterleave/interleave on pairs passed" << std::endl;
+}
+
+int main() {
+    setup_console_encoding();
+    std::cout << "=== my_stl::pair Transpose Tests ===" << std::endl;
+
+    try {
+        check_width<std::uint8_t>("8-bit");
+        check_width<std::uint16_t>("16-bit");
+        check_width<std::uint32_t>("32-bit");
+        check_width<std::uint64_t>("64-bit");
+        test_public_api();
+
+        std::cout << "\n✅ All transpose tests passed!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
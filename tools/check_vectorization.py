@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Check that the pair kernels in tools/vectorization_kernels.cpp still vectorize.
+
+Usage:
+    python3 tools/check_vectorization.py --compiler g++ [--flags="-march=x86-64-v3"]
+
+The source is compiled at -O3 with the compiler's vectorization remarks enabled
+(GCC: -fopt-info-vec-all, Clang: -Rpass=loop-vectorize and friends). Every loop
+marked "// VEC-EXPECT: <name>" must be reported as vectorized; loops marked
+"// VEC-INFO: <name>" are only reported. Exits with status 1 when an expected
+loop did not vectorize, printing the compiler's reasons for that line.
+"""
+
+import argparse
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+MARKER_RE = re.compile(r"//\s*VEC-(EXPECT|INFO):\s*([A-Za-z_]\w*)\s*$")
+REMARK_RE = re.compile(r"^(?P<file>[^:]+):(?P<line>\d+):(?P<col>\d+):\s*(?P<kind>[a-z ]+):\s*(?P<msg>.*)$")
+
+
+def find_markers(source):
+    markers = []
+    with open(source) as f:
+        for lineno, line in enumerate(f, 1):
+            m = MARKER_RE.search(line)
+            # Markers sit at the end of the loop's first line, after code
+            if m and line[:m.start()].strip():
+                markers.append((lineno, m.group(2), m.group(1) == "EXPECT"))
+    return markers
+
+
+def is_clang(compiler):
+    out = subprocess.run([compiler, "--version"], capture_output=True, text=True, check=False)
+    return "clang" in out.stdout.lower()
+
+
+def compile_with_remarks(compiler, source, include_dir, extra_flags):
+    cmd = [compiler, "-std=c++17", "-O3", "-c", source, "-o", os.devnull]
+    if include_dir:
+        cmd += ["-I", include_dir]
+    if is_clang(compiler):
+        cmd += ["-Rpass=loop-vectorize", "-Rpass-missed=loop-vectorize", "-Rpass-analysis=loop-vectorize"]
+    else:
+        cmd += ["-fopt-info-vec-all"]
+    cmd += extra_flags
+    result = subprocess.run(cmd, capture_output=True, text=True, check=False)
+    if result.returncode != 0:
+        sys.stderr.write(result.stderr)
+        raise SystemExit("compilation failed: " + " ".join(cmd))
+    return result.stderr
+
+
+def parse_remarks(output, source):
+    """Return {line: (vectorized, [messages])} for remarks located in source."""
+    base = os.path.basename(source)
+    remarks = {}
+    for raw in output.splitlines():
+        m = REMARK_RE.match(raw.strip())
+        if not m or os.path.basename(m.group("file")) != base:
+            continue
+        line = int(m.group("line"))
+        msg = m.group("msg")
+        vectorized, messages = remarks.get(line, (False, []))
+        # GCC: "optimized: loop vectorized using 16 byte vectors"
+        # Clang: "remark: vectorized loop (vectorization width: 4, ...)"
+        if (m.group("kind") == "optimized" and "loop vectorized" in msg) or msg.startswith("vectorized loop"):
+            vectorized = True
+        if not msg.startswith("*****"):
+            messages.append(msg)
+        remarks[line] = (vectorized, messages)
+    return remarks
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--source", default=os.path.join(here, "vectorization_kernels.cpp"))
+    parser.add_argument("--include", default=os.path.join(os.path.dirname(here), "include"),
+                        help="directory containing my_stl/, passed to the compiler as -I")
+    parser.add_argument("--flags", default="", help="extra compiler flags, e.g. '-march=x86-64-v3'")
+    args = parser.parse_args()
+
+    markers = find_markers(args.source)
+    if not markers:
+        raise SystemExit("no VEC-EXPECT/VEC-INFO markers in " + args.source)
+
+    output = compile_with_remarks(args.compiler, args.source, args.include, shlex.split(args.flags))
+    remarks = parse_remarks(output, args.source)
+
+    failures = 0
+    width = max(len(name) for _, name, _ in markers)
+    for line, name, expected in markers:
+        vectorized, messages = remarks.get(line, (False, []))
+        if vectorized:
+            status = "vectorized"
+        elif expected:
+            status = "NOT VECTORIZED (regression)"
+            failures += 1
+        else:
+            status = "not vectorized"
+        print("%-*s  line %4d  %s" % (width, name, line, status))
+        if not vectorized:
+            # The reasons are often reported on statements inside the loop body
+            for offset in range(1, 4):
+                messages = messages + remarks.get(line + offset, (False, []))[1]
+            for msg in sorted(set(messages)):
+                print("%-*s      %s" % (width, "", msg))
+
+    expected_count = sum(1 for _, _, e in markers if e)
+    print("%d/%d expected loops vectorized" % (expected_count - failures, expected_count))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
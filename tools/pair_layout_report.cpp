@@ -0,0 +1,58 @@
+// pair 内存布局报告工具
+//
+// 用法: pair_layout_report [--table | --json | --both]
+// 类型列表见 pair_layout_types.def
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../include/my_stl/layout.hpp"
+
+#ifndef MYSTL_LAYOUT_TYPES_FILE
+#define MYSTL_LAYOUT_TYPES_FILE "pair_layout_types.def"
+#endif
+
+namespace layout_types {
+#define MYSTL_LAYOUT_DECLARATIONS
+#include MYSTL_LAYOUT_TYPES_FILE
+#undef MYSTL_LAYOUT_DECLARATIONS
+} // namespace layout_types
+
+std::vector<my_stl::layout_info> collect_layouts() {
+    using namespace layout_types;
+    std::vector<my_stl::layout_info> rows;
+#define MYSTL_LAYOUT_PAIR(T1, T2) my_stl::describe_all_layouts<T1, T2>(rows);
+#include MYSTL_LAYOUT_TYPES_FILE
+#undef MYSTL_LAYOUT_PAIR
+    return rows;
+}
+
+int main(int argc, char** argv) {
+    bool table = true;
+    bool json = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            table = false;
+            json = true;
+        } else if (std::strcmp(argv[i], "--table") == 0) {
+            table = true;
+            json = false;
+        } else if (std::strcmp(argv[i], "--both") == 0) {
+            table = true;
+            json = true;
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--table | --json | --both]" << std::endl;
+            return 2;
+        }
+    }
+
+    auto rows = collect_layouts();
+    if (table) my_stl::format_table(std::cout, rows);
+    if (table && json) std::cout << std::endl;
+    if (json) my_stl::format_json(std::cout, rows);
+    return 0;
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Plot throughput curves from container_scale_benchmark CSV output.
+
+Usage:
+    python3 tools/plot_scaling.py scale.csv [-o scale.png]
+
+One subplot per operation; x axis is the working-set size in bytes (log scale),
+y axis is throughput in million items per second. Vertical lines mark the
+L1d/L2/L3 sizes recorded in the CSV header.
+"""
+
+import argparse
+import csv
+import sys
+from collections import defaultdict
+
+
+def load(path):
+    caches = {}
+    rows = []
+    with open(path) as f:
+        lines = []
+        for line in f:
+            if line.startswith("# cache"):
+                for field in line[len("# cache"):].split():
+                    key, _, value = field.partition("=")
+                    if value.lstrip("-").isdigit() and int(value) > 0:
+                        caches[key] = int(value)
+            elif not line.startswith("#"):
+                lines.append(line)
+        for row in csv.DictReader(lines):
+            rows.append(row)
+    return caches, rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("csv")
+    parser.add_argument("-o", "--output", default="scaling.png")
+    args = parser.parse_args()
+
+    try:
+        import matplotlib
+        matplotlib.use("Agg")
+        import matplotlib.pyplot as plt
+    except ImportError:
+        print("matplotlib is required: pip install matplotlib", file=sys.stderr)
+        return 1
+
+    caches, rows = load(args.csv)
+    series = defaultdict(lambda: defaultdict(list))
+    for row in rows:
+        label = "%s / %s" % (row["pair"], row["dist"])
+        series[row["op"]][label].append((int(row["bytes"]), float(row["mitems_per_s"])))
+
+    ops = sorted(series)
+    cols = 2
+    rows_count = (len(ops) + cols - 1) // cols
+    fig, axes = plt.subplots(rows_count, cols, figsize=(12, 3.5 * rows_count), squeeze=False)
+
+    for ax, op in zip(axes.flat, ops):
+        for label, points in sorted(series[op].items()):
+            points.sort()
+            ax.plot([p[0] for p in points], [p[1] for p in points], marker="o", markersize=3, label=label)
+        for name, size in caches.items():
+            ax.axvline(size, color="grey", linestyle=":", linewidth=1)
+            ax.text(size, ax.get_ylim()[1], name, fontsize=7, va="top", color="grey")
+        ax.set_xscale("log")
+        ax.set_title(op)
+        ax.set_xlabel("working set (bytes)")
+        ax.set_ylabel("Mitems/s")
+        ax.legend(fontsize=7)
+
+    for ax in list(axes.flat)[len(ops):]:
+        ax.axis("off")
+
+    fig.tight_layout()
+    fig.savefig(args.output, dpi=120)
+    print("wrote %s" % args.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,354 @@
+#!/usr/bin/env python3
+"""Run a benchmark binary repeatedly on pinned cores until results converge.
+
+Usage:
+    python3 tools/run_benchmarks.py [options] -- ./benchmark_pair [args...]
+
+The runner
+  * checks the machine state (frequency governor, turbo, SMT, isolated cores,
+    load average) and warns, or fails with --strict, when results would be noisy;
+  * pins the benchmark to isolated cores (from /sys/devices/system/cpu/isolated,
+    or --cpus);
+  * repeats the benchmark until the 95% confidence interval of every metric is
+    within --target-ci of its mean (or --max-runs is reached);
+  * writes a JSON result file stamped with environment metadata.
+
+Metrics are parsed from the benchmark output:
+  * text format (benchmark_pair, optimized_benchmark, test_pair_performance):
+    lines like "my_stl::pair: 1.23 ns/op" or "Ratio (my_stl/std): 0.98x",
+    prefixed with the most recent "=== Section ===" header;
+  * csv format (container_scale_benchmark, concurrent_scaling_benchmark):
+    --csv-keys names the columns that identify a row, --csv-values the
+    numeric columns to track.
+"""
+
+import argparse
+import csv
+import datetime
+import glob
+import json
+import math
+import os
+import platform
+import re
+import socket
+import statistics
+import subprocess
+import sys
+
+# Two-sided 95% Student t critical values by degrees of freedom
+T_95 = {
+    1: 12.706, 2: 4.303, 3: 3.182, 4: 2.776, 5: 2.571, 6: 2.447, 7: 2.365,
+    8: 2.306, 9: 2.262, 10: 2.228, 11: 2.201, 12: 2.179, 13: 2.160, 14: 2.145,
+    15: 2.131, 16: 2.120, 17: 2.110, 18: 2.101, 19: 2.093, 20: 2.086,
+    25: 2.060, 30: 2.042, 40: 2.021, 60: 2.000, 120: 1.980,
+}
+
+SECTION_RE = re.compile(r"^\s*=+\s*(.+?)\s*=+\s*$")
+METRIC_RE = re.compile(
+    r"^\s*(?P<label>[^=#\s].*?)\s*:\s*"
+    r"(?P<value>[-+]?\d+(?:\.\d+)?(?:[eE][-+]?\d+)?)\s*"
+    r"(?P<unit>ns/op|ns|us|ms|s|x|bytes)?\b")
+
+
+def read_file(path, default=None):
+    try:
+        with open(path) as f:
+            return f.read().strip()
+    except OSError:
+        return default
+
+
+def parse_cpu_list(text):
+    cpus = []
+    for part in (text or "").split(","):
+        part = part.strip()
+        if not part:
+            continue
+        if "-" in part:
+            lo, hi = part.split("-")
+            cpus.extend(range(int(lo), int(hi) + 1))
+        else:
+            cpus.append(int(part))
+    return cpus
+
+
+# ============================================================================
+# Environment
+# ============================================================================
+
+def cpu_model():
+    for line in (read_file("/proc/cpuinfo", "") or "").splitlines():
+        if line.startswith("model name"):
+            return line.split(":", 1)[1].strip()
+    return platform.processor() or "unknown"
+
+
+def governors():
+    values = set()
+    for path in glob.glob("/sys/devices/system/cpu/cpu[0-9]*/cpufreq/scaling_governor"):
+        value = read_file(path)
+        if value:
+            values.add(value)
+    return sorted(values)
+
+
+def turbo_state():
+    no_turbo = read_file("/sys/devices/system/cpu/intel_pstate/no_turbo")
+    if no_turbo is not None:
+        return "off" if no_turbo == "1" else "on"
+    boost = read_file("/sys/devices/system/cpu/cpufreq/boost")
+    if boost is not None:
+        return "on" if boost == "1" else "off"
+    return "unknown"
+
+
+def smt_state():
+    active = read_file("/sys/devices/system/cpu/smt/active")
+    if active is None:
+        return "unknown"
+    return "on" if active == "1" else "off"
+
+
+def git_commit():
+    try:
+        out = subprocess.run(["git", "rev-parse", "HEAD"], capture_output=True, text=True,
+                             cwd=os.path.dirname(os.path.abspath(__file__)), check=False)
+        commit = out.stdout.strip()
+        dirty = subprocess.run(["git", "status", "--porcelain", "--untracked-files=no"],
+                               capture_output=True, text=True,
+                               cwd=os.path.dirname(os.path.abspath(__file__)), check=False)
+        return commit + ("-dirty" if dirty.stdout.strip() else "") if commit else None
+    except OSError:
+        return None
+
+
+def build_type(binary):
+    # Look for the CMake cache next to or above the benchmark binary
+    directory = os.path.dirname(os.path.abspath(binary))
+    for _ in range(3):
+        cache = read_file(os.path.join(directory, "CMakeCache.txt"))
+        if cache:
+            for line in cache.splitlines():
+                if line.startswith("CMAKE_BUILD_TYPE:"):
+                    return line.split("=", 1)[1] or "(empty)"
+        directory = os.path.dirname(directory)
+    return None
+
+
+def collect_environment(binary, pinned):
+    isolated = parse_cpu_list(read_file("/sys/devices/system/cpu/isolated", ""))
+    return {
+        "timestamp": datetime.datetime.now(datetime.timezone.utc).isoformat(),
+        "host": socket.gethostname(),
+        "kernel": platform.release(),
+        "cpu_model": cpu_model(),
+        "logical_cpus": os.cpu_count(),
+        "governors": governors(),
+        "turbo": turbo_state(),
+        "smt": smt_state(),
+        "isolated_cpus": isolated,
+        "pinned_cpus": pinned,
+        "load_average": list(os.getloadavg()) if hasattr(os, "getloadavg") else None,
+        "git_commit": git_commit(),
+        "build_type": build_type(binary),
+    }
+
+
+def check_environment(env):
+    warnings = []
+    if env["governors"] and env["governors"] != ["performance"]:
+        warnings.append("CPU frequency governor is %s, expected 'performance'" % ",".join(env["governors"]))
+    if env["turbo"] == "on":
+        warnings.append("turbo boost is enabled; frequency depends on temperature and load")
+    if env["smt"] == "on":
+        warnings.append("SMT is enabled; pinned cores may share execution units with other work")
+    if not env["isolated_cpus"]:
+        warnings.append("no isolated cores (isolcpus=); the scheduler may interrupt the benchmark")
+    if env["load_average"] and env["logical_cpus"] and env["load_average"][0] > 0.5:
+        warnings.append("1-minute load average is %.2f" % env["load_average"][0])
+    if env["build_type"] and env["build_type"] not in ("Release", "RelWithDebInfo"):
+        warnings.append("benchmark was built with CMAKE_BUILD_TYPE=%s" % env["build_type"])
+    return warnings
+
+
+# ============================================================================
+# Metric parsing
+# ============================================================================
+
+def parse_text(output):
+    metrics = {}
+    section = ""
+    for line in output.splitlines():
+        m = SECTION_RE.match(line)
+        if m:
+            section = m.group(1)
+            continue
+        m = METRIC_RE.match(line)
+        if m:
+            label = m.group("label").strip()
+            name = "%s / %s" % (section, label) if section else label
+            if m.group("unit"):
+                name += " [%s]" % m.group("unit")
+            metrics[name] = float(m.group("value"))
+    return metrics
+
+
+def parse_csv(output, key_cols, value_cols):
+    lines = [l for l in output.splitlines() if l and not l.startswith("#")]
+    metrics = {}
+    for row in csv.DictReader(lines):
+        key = "/".join(row.get(k, "") for k in key_cols)
+        for col in value_cols:
+            try:
+                metrics["%s [%s]" % (key, col)] = float(row[col])
+            except (KeyError, ValueError):
+                pass
+    return metrics
+
+
+# ============================================================================
+# Statistics
+# ============================================================================
+
+def t_critical(df):
+    if df <= 0:
+        return float("inf")
+    for bound in sorted(T_95):
+        if df <= bound:
+            return T_95[bound]
+    return 1.960
+
+
+def summarize(samples):
+    n = len(samples)
+    mean = statistics.fmean(samples)
+    stdev = statistics.stdev(samples) if n > 1 else 0.0
+    half_width = t_critical(n - 1) * stdev / math.sqrt(n) if n > 1 else float("inf")
+    rel = half_width / abs(mean) if mean else (0.0 if half_width == 0 else float("inf"))
+    return {
+        "runs": n,
+        "mean": mean,
+        "median": statistics.median(samples),
+        "min": min(samples),
+        "max": max(samples),
+        "stdev": stdev,
+        "ci95_half_width": half_width,
+        "ci95_relative": rel,
+        "samples": samples,
+    }
+
+
+# ============================================================================
+# Runner
+# ============================================================================
+
+def choose_cpus(requested):
+    if requested:
+        return parse_cpu_list(requested)
+    isolated = parse_cpu_list(read_file("/sys/devices/system/cpu/isolated", ""))
+    if isolated:
+        return isolated
+    allowed = sorted(os.sched_getaffinity(0)) if hasattr(os, "sched_getaffinity") else []
+    # Avoid CPU 0, which usually handles most interrupts
+    return allowed[-1:] if allowed else []
+
+
+def run_once(command, cpus):
+    def pin():
+        if cpus and hasattr(os, "sched_setaffinity"):
+            os.sched_setaffinity(0, cpus)
+
+    result = subprocess.run(command, capture_output=True, text=True, preexec_fn=pin, check=False)
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout + result.stderr)
+        raise SystemExit("benchmark exited with status %d" % result.returncode)
+    return result.stdout
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cpus", help="CPU list to pin to, e.g. '2,3' or '4-7' (default: isolated cores)")
+    parser.add_argument("--min-runs", type=int, default=5)
+    parser.add_argument("--max-runs", type=int, default=30)
+    parser.add_argument("--target-ci", type=float, default=0.02,
+                        help="stop when every metric's 95%% CI half-width is below this fraction of its mean")
+    parser.add_argument("--warmup", type=int, default=1, help="discarded runs before measuring")
+    parser.add_argument("--format", choices=["text", "csv"], default="text")
+    parser.add_argument("--csv-keys", default="op,pair,dist,n")
+    parser.add_argument("--csv-values", default="ns_per_item")
+    parser.add_argument("--metrics", help="regex; only matching metrics are kept and must converge")
+    parser.add_argument("--strict", action="store_true", help="fail if the environment checks warn")
+    parser.add_argument("-o", "--output", help="JSON result file (default: <binary>-<timestamp>.json)")
+    parser.add_argument("command", nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+
+    command = args.command[1:] if args.command and args.command[0] == "--" else args.command
+    if not command:
+        parser.error("missing benchmark command")
+
+    cpus = choose_cpus(args.cpus)
+    env = collect_environment(command[0], cpus)
+    warnings = check_environment(env)
+    for w in warnings:
+        print("warning: " + w, file=sys.stderr)
+    if warnings and args.strict:
+        raise SystemExit("environment checks failed (--strict)")
+
+    selected = re.compile(args.metrics) if args.metrics else None
+
+    def parse(output):
+        if args.format == "csv":
+            metrics = parse_csv(output, args.csv_keys.split(","), args.csv_values.split(","))
+        else:
+            metrics = parse_text(output)
+        if selected:
+            metrics = {k: v for k, v in metrics.items() if selected.search(k)}
+        return metrics
+
+    for _ in range(args.warmup):
+        run_once(command, cpus)
+
+    samples = {}
+    converged = False
+    runs = 0
+    while runs < args.max_runs:
+        metrics = parse(run_once(command, cpus))
+        runs += 1
+        for name, value in metrics.items():
+            samples.setdefault(name, []).append(value)
+        if runs >= args.min_runs and samples:
+            worst = max(summarize(v)["ci95_relative"] for v in samples.values())
+            print("run %d: worst relative CI %.2f%%" % (runs, worst * 100), file=sys.stderr)
+            if worst <= args.target_ci:
+                converged = True
+                break
+
+    results = {name: summarize(values) for name, values in samples.items()}
+    report = {
+        "command": command,
+        "environment": env,
+        "warnings": warnings,
+        "target_ci": args.target_ci,
+        "converged": converged,
+        "runs": runs,
+        "metrics": results,
+    }
+
+    output = args.output
+    if not output:
+        stamp = datetime.datetime.now().strftime("%Y%m%d-%H%M%S")
+        output = "%s-%s.json" % (os.path.basename(command[0]), stamp)
+    with open(output, "w") as f:
+        json.dump(report, f, indent=2)
+
+    width = max((len(n) for n in results), default=10)
+    for name in sorted(results):
+        r = results[name]
+        print("%-*s  mean %12.4g  ±%6.2f%%  (n=%d)" % (width, name, r["mean"], r["ci95_relative"] * 100, r["runs"]))
+    print("%s after %d runs; results written to %s" % ("converged" if converged else "NOT converged", runs, output))
+    return 0 if converged else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
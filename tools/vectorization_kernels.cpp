@@ -0,0 +1,98 @@
+// 向量化检查用的 pair 内核
+//
+// tools/check_vectorization.py 以 -O3 编译本文件 (头文件目录由其 --include 参数以 -I 传入)
+// 并解析编译器的向量化报告
+// (GCC: -fopt-info-vec, Clang: -Rpass=loop-vectorize)。带有
+//   // VEC-EXPECT: <name>
+// 标记的循环必须被向量化，否则检查失败；带有
+//   // VEC-INFO: <name>
+// 标记的循环只报告结果，用于跟踪尚未向量化的内核。
+//
+// 内核都是 extern "C" 的非内联函数，保证循环按原样出现在目标文件中。
+
+#include <cstddef>
+#include <cstdint>
+#include <my_stl/pair.hpp>
+#include <my_stl/detail/hash.hpp>
+
+using pair_i32 = my_stl::pair<std::int32_t, std::int32_t>;
+using pair_u32 = my_stl::pair<std::uint32_t, std::uint32_t>;
+using pair_u64 = my_stl::pair<std::uint64_t, std::uint64_t>;
+using pair_f32 = my_stl::pair<float, float>;
+
+extern "C" {
+
+// ============================================================================
+// 拷贝/赋值
+// ============================================================================
+
+void vk_copy_assign_i32(pair_i32* __restrict dst, const pair_i32* __restrict src, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) dst[i] = src[i];  // VEC-EXPECT: copy_assign_i32
+}
+
+void vk_copy_assign_u64(pair_u64* __restrict dst, const pair_u64* __restrict src, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) dst[i] = src[i];  // VEC-EXPECT: copy_assign_u64
+}
+
+void vk_convert_assign(pair_u64* __restrict dst, const pair_u32* __restrict src, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) dst[i] = src[i];  // VEC-EXPECT: convert_assign_u32_u64
+}
+
+void vk_fill(pair_u32* __restrict dst, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {  // VEC-EXPECT: fill_construct
+        dst[i] = pair_u32(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i * 2));
+    }
+}
+
+void vk_swap_members(pair_u32* __restrict dst, const pair_u32* __restrict src, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {  // VEC-EXPECT: swap_members
+        dst[i] = pair_u32(src[i].second, src[i].first);
+    }
+}
+
+// ============================================================================
+// 比较
+// ============================================================================
+
+std::size_t vk_count_equal(const pair_u32* __restrict data, std::size_t n, pair_u32 key) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += data[i] == key;  // VEC-EXPECT: count_equal
+    return count;
+}
+
+std::size_t vk_count_less(const pair_u32* __restrict data, std::size_t n, pair_u32 key) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += data[i] < key;  // VEC-EXPECT: count_less
+    return count;
+}
+
+std::size_t vk_count_less_f32(const pair_f32* __restrict data, std::size_t n, pair_f32 key) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += data[i] < key;  // VEC-EXPECT: count_less_f32
+    return count;
+}
+
+void vk_less_mask(std::uint8_t* __restrict out, const pair_i32* __restrict a, const pair_i32* __restrict b,
+                  std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] < b[i];  // VEC-EXPECT: less_mask
+}
+
+// ============================================================================
+// 归约与哈希
+// ============================================================================
+
+std::uint64_t vk_sum_first(const pair_u32* __restrict data, std::size_t n) {
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) sum += data[i].first;  // VEC-EXPECT: sum_first
+    return sum;
+}
+
+std::uint64_t vk_hash_u32(const pair_u32* __restrict data, std::size_t n) {
+    std::uint64_t acc = 0;
+    for (std::size_t i = 0; i < n; ++i) {  // VEC-INFO: hash_combine_u32
+        acc += my_stl::detail::hash_combine64(data[i].first, data[i].second);
+    }
+    return acc;
+}
+
+} // extern "C"